@@ -58,6 +58,8 @@ uint8_t mcp9600_basic_init(mcp9600_address_t addr_pin, mcp9600_thermocouple_type
     DRIVER_MCP9600_LINK_IIC_INIT(&gs_handle, mcp9600_interface_iic_init);
     DRIVER_MCP9600_LINK_IIC_DEINIT(&gs_handle, mcp9600_interface_iic_deinit);
     DRIVER_MCP9600_LINK_IIC_READ_COMMAND(&gs_handle, mcp9600_interface_iic_read_cmd);
+    DRIVER_MCP9600_LINK_IIC_READ(&gs_handle, mcp9600_interface_iic_read);
+    DRIVER_MCP9600_LINK_IIC_READ_BATCH(&gs_handle, mcp9600_interface_iic_read_batch);
     DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND(&gs_handle, mcp9600_interface_iic_write_cmd);
     DRIVER_MCP9600_LINK_IIC_DELAY_MS(&gs_handle, mcp9600_interface_delay_ms);
     DRIVER_MCP9600_LINK_DEBUG_PRINT(&gs_handle, mcp9600_interface_debug_print);
@@ -71,6 +73,15 @@ uint8_t mcp9600_basic_init(mcp9600_address_t addr_pin, mcp9600_thermocouple_type
         return 1;
     }
     
+    /* enable register cache */
+    res = mcp9600_set_register_cache(&gs_handle, MCP9600_BOOL_TRUE);
+    if (res != 0)
+    {
+        mcp9600_interface_debug_print("mcp9600: set register cache failed.\n");
+        
+        return 1;
+    }
+    
     /* chip init */
     res = mcp9600_init(&gs_handle);
     if (res != 0)
@@ -572,3 +583,36 @@ uint8_t mcp9600_basic_read(int16_t *hot_raw, float *hot_s,
     
     return 0;
 }
+
+/**
+ * @brief      basic example scan
+ * @param[out] *addr pointer to an address list buffer with at least 8 members
+ * @param[out] *num pointer to a found number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 scan failed
+ * @note       none
+ */
+uint8_t mcp9600_basic_scan(mcp9600_address_t *addr, uint8_t *num)
+{
+    mcp9600_handle_t handle;
+    
+    /* link interface function */
+    DRIVER_MCP9600_LINK_INIT(&handle, mcp9600_handle_t);
+    DRIVER_MCP9600_LINK_IIC_INIT(&handle, mcp9600_interface_iic_init);
+    DRIVER_MCP9600_LINK_IIC_DEINIT(&handle, mcp9600_interface_iic_deinit);
+    DRIVER_MCP9600_LINK_IIC_READ_COMMAND(&handle, mcp9600_interface_iic_read_cmd);
+    DRIVER_MCP9600_LINK_IIC_READ(&handle, mcp9600_interface_iic_read);
+    DRIVER_MCP9600_LINK_IIC_READ_BATCH(&handle, mcp9600_interface_iic_read_batch);
+    DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND(&handle, mcp9600_interface_iic_write_cmd);
+    DRIVER_MCP9600_LINK_IIC_DELAY_MS(&handle, mcp9600_interface_delay_ms);
+    DRIVER_MCP9600_LINK_DEBUG_PRINT(&handle, mcp9600_interface_debug_print);
+    
+    /* scan the bus */
+    if (mcp9600_scan(&handle, addr, num) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
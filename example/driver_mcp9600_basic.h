@@ -122,6 +122,17 @@ uint8_t mcp9600_basic_deinit(void);
 uint8_t mcp9600_basic_read(int16_t *hot_raw, float *hot_s,
                            int16_t *delta_raw, float *delta_s, int16_t *cold_raw, float *cold_s);
 
+/**
+ * @brief      basic example scan
+ * @param[out] *addr pointer to an address list buffer with at least 8 members
+ * @param[out] *num pointer to a found number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 scan failed
+ * @note       none
+ */
+uint8_t mcp9600_basic_scan(mcp9600_address_t *addr, uint8_t *num);
+
 /**
  * @}
  */
@@ -58,9 +58,12 @@ uint8_t mcp9600_interrupt_init(mcp9600_address_t addr_pin, mcp9600_thermocouple_
     DRIVER_MCP9600_LINK_IIC_INIT(&gs_handle, mcp9600_interface_iic_init);
     DRIVER_MCP9600_LINK_IIC_DEINIT(&gs_handle, mcp9600_interface_iic_deinit);
     DRIVER_MCP9600_LINK_IIC_READ_COMMAND(&gs_handle, mcp9600_interface_iic_read_cmd);
+    DRIVER_MCP9600_LINK_IIC_READ(&gs_handle, mcp9600_interface_iic_read);
+    DRIVER_MCP9600_LINK_IIC_READ_BATCH(&gs_handle, mcp9600_interface_iic_read_batch);
     DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND(&gs_handle, mcp9600_interface_iic_write_cmd);
     DRIVER_MCP9600_LINK_IIC_DELAY_MS(&gs_handle, mcp9600_interface_delay_ms);
     DRIVER_MCP9600_LINK_DEBUG_PRINT(&gs_handle, mcp9600_interface_debug_print);
+    DRIVER_MCP9600_LINK_TIMESTAMP(&gs_handle, mcp9600_interface_timestamp);
     
     /* set mcp9600 iic address */
     res = mcp9600_set_addr_pin(&gs_handle, addr_pin);
@@ -71,6 +74,15 @@ uint8_t mcp9600_interrupt_init(mcp9600_address_t addr_pin, mcp9600_thermocouple_
         return 1;
     }
     
+    /* enable register cache */
+    res = mcp9600_set_register_cache(&gs_handle, MCP9600_BOOL_TRUE);
+    if (res != 0)
+    {
+        mcp9600_interface_debug_print("mcp9600: set register cache failed.\n");
+        
+        return 1;
+    }
+    
     /* chip init */
     res = mcp9600_init(&gs_handle);
     if (res != 0)
@@ -573,6 +585,73 @@ uint8_t mcp9600_interrupt_read(int16_t *hot_raw, float *hot_s,
     return 0;
 }
 
+/**
+ * @brief      interrupt example read after an alert event
+ * @param[in]  timestamp alert event timestamp in ns
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *hot_s pointer to a converted hot temperature buffer
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *delta_s pointer to a converted delta temperature buffer
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *cold_s pointer to a converted cold temperature buffer
+ * @param[out] *us pointer to a latency buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the latency from the alert edge to the completed reading is recorded in the histogram
+ *             when MCP9600_STATS is enabled
+ */
+uint8_t mcp9600_interrupt_event_read(uint64_t timestamp, int16_t *hot_raw, float *hot_s,
+                                     int16_t *delta_raw, float *delta_s, int16_t *cold_raw, float *cold_s,
+                                     uint32_t *us)
+{
+    uint8_t res;
+    
+    /* continuous read */
+    res = mcp9600_continuous_read(&gs_handle, hot_raw, hot_s, delta_raw, delta_s, cold_raw, cold_s);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+#if (MCP9600_STATS != 0)
+    /* record latency */
+    res = mcp9600_latency_record(&gs_handle, timestamp, us);
+    if (res != 0)
+    {
+        return 1;
+    }
+#else
+    /* get latency */
+    *us = (uint32_t)((mcp9600_interface_timestamp() - timestamp) / 1000);
+#endif
+    
+    return 0;
+}
+
+#if (MCP9600_STATS != 0)
+/**
+ * @brief      interrupt example get the alert latency statistics
+ * @param[out] *latency pointer to an mcp9600 latency structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t mcp9600_interrupt_get_latency(mcp9600_latency_t *latency)
+{
+    uint8_t res;
+    
+    res = mcp9600_latency_get(&gs_handle, latency);
+    if (res != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+#endif
+
 /**
  * @brief     interrupt example clear
  * @param[in] alert alert type
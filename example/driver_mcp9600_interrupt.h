@@ -120,6 +120,38 @@ uint8_t mcp9600_interrupt_deinit(void);
 uint8_t mcp9600_interrupt_read(int16_t *hot_raw, float *hot_s,
                                int16_t *delta_raw, float *delta_s, int16_t *cold_raw, float *cold_s);
 
+/**
+ * @brief      interrupt example read after an alert event
+ * @param[in]  timestamp alert event timestamp in ns
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *hot_s pointer to a converted hot temperature buffer
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *delta_s pointer to a converted delta temperature buffer
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *cold_s pointer to a converted cold temperature buffer
+ * @param[out] *us pointer to a latency buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the latency from the alert edge to the completed reading is recorded in the histogram
+ *             when MCP9600_STATS is enabled
+ */
+uint8_t mcp9600_interrupt_event_read(uint64_t timestamp, int16_t *hot_raw, float *hot_s,
+                                     int16_t *delta_raw, float *delta_s, int16_t *cold_raw, float *cold_s,
+                                     uint32_t *us);
+
+#if (MCP9600_STATS != 0)
+/**
+ * @brief      interrupt example get the alert latency statistics
+ * @param[out] *latency pointer to an mcp9600 latency structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       none
+ */
+uint8_t mcp9600_interrupt_get_latency(mcp9600_latency_t *latency);
+#endif
+
 /**
  * @brief     interrupt example clear
  * @param[in] alert alert type
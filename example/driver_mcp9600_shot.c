@@ -58,6 +58,8 @@ uint8_t mcp9600_shot_init(mcp9600_address_t addr_pin, mcp9600_thermocouple_type_
     DRIVER_MCP9600_LINK_IIC_INIT(&gs_handle, mcp9600_interface_iic_init);
     DRIVER_MCP9600_LINK_IIC_DEINIT(&gs_handle, mcp9600_interface_iic_deinit);
     DRIVER_MCP9600_LINK_IIC_READ_COMMAND(&gs_handle, mcp9600_interface_iic_read_cmd);
+    DRIVER_MCP9600_LINK_IIC_READ(&gs_handle, mcp9600_interface_iic_read);
+    DRIVER_MCP9600_LINK_IIC_READ_BATCH(&gs_handle, mcp9600_interface_iic_read_batch);
     DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND(&gs_handle, mcp9600_interface_iic_write_cmd);
     DRIVER_MCP9600_LINK_IIC_DELAY_MS(&gs_handle, mcp9600_interface_delay_ms);
     DRIVER_MCP9600_LINK_DEBUG_PRINT(&gs_handle, mcp9600_interface_debug_print);
@@ -71,6 +73,24 @@ uint8_t mcp9600_shot_init(mcp9600_address_t addr_pin, mcp9600_thermocouple_type_
         return 1;
     }
     
+    /* enable register cache */
+    res = mcp9600_set_register_cache(&gs_handle, MCP9600_BOOL_TRUE);
+    if (res != 0)
+    {
+        mcp9600_interface_debug_print("mcp9600: set register cache failed.\n");
+        
+        return 1;
+    }
+    
+    /* set conversion guard band */
+    res = mcp9600_set_conversion_guard(&gs_handle, MCP9600_SHOT_DEFAULT_CONVERSION_GUARD);
+    if (res != 0)
+    {
+        mcp9600_interface_debug_print("mcp9600: set conversion guard failed.\n");
+        
+        return 1;
+    }
+    
     /* chip init */
     res = mcp9600_init(&gs_handle);
     if (res != 0)
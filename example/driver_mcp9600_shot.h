@@ -55,6 +55,7 @@ extern "C"{
 #define MCP9600_SHOT_DEFAULT_COLD_JUNCTION_RESOLUTION              MCP9600_COLD_JUNCTION_RESOLUTION_0P0625            /**< cold junction resolution 0.0625C */
 #define MCP9600_SHOT_DEFAULT_ADC_RESOLUTION                        MCP9600_ADC_RESOLUTION_18_BIT                      /**< adc resolution 18 bit */
 #define MCP9600_SHOT_DEFAULT_BURST_MODE_SAMPLE                     MCP9600_BURST_MODE_SAMPLE_2                        /**< burst mode sample 2 */
+#define MCP9600_SHOT_DEFAULT_CONVERSION_GUARD                      10                                                 /**< conversion guard band 10 ms */
 #define MCP9600_SHOT_DEFAULT_ALERT1_LIMIT                          30.0f                                              /**< alert1 limit */
 #define MCP9600_SHOT_DEFAULT_ALERT2_LIMIT                          31.0f                                              /**< alert2 limit */
 #define MCP9600_SHOT_DEFAULT_ALERT3_LIMIT                          32.0f                                              /**< alert3 limit */
@@ -92,6 +92,47 @@ uint8_t mcp9600_interface_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len
  */
 uint8_t mcp9600_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief      interface iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       write the register pointer and read the data in one repeated start transaction
+ */
+uint8_t mcp9600_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      interface iic bus read several registers
+ * @param[in]  addr iic device write address
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the data of each register is stored one after another in buf
+ */
+uint8_t mcp9600_interface_iic_read_batch(uint8_t addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf);
+
+/**
+ * @brief      interface iic bus read registers of several devices
+ * @param[in]  *addr pointer to an iic device write address list
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the data of each register is stored one after another in buf
+ */
+uint8_t mcp9600_interface_iic_read_multi(uint8_t *addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf);
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -106,6 +147,119 @@ void mcp9600_interface_delay_ms(uint32_t ms);
  */
 void mcp9600_interface_debug_print(const char *const fmt, ...);
 
+/**
+ * @brief  interface get the monotonic timestamp
+ * @return timestamp in ns
+ * @note   none
+ */
+uint64_t mcp9600_interface_timestamp(void);
+
+/**
+ * @brief     interface iic bus init with a user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      none
+ */
+uint8_t mcp9600_interface_iic_init_ctx(void *user);
+
+/**
+ * @brief     interface iic bus deinit with a user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+uint8_t mcp9600_interface_iic_deinit_ctx(void *user);
+
+/**
+ * @brief     interface iic bus write command with a user context
+ * @param[in] *user pointer to a user context
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t mcp9600_interface_iic_write_cmd_ctx(void *user, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      interface iic bus read command with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9600_interface_iic_read_cmd_ctx(void *user, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      interface iic bus read with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       write the register pointer and read the data in one repeated start transaction
+ */
+uint8_t mcp9600_interface_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      interface iic bus read several registers with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  addr iic device write address
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the data of each register is stored one after another in buf
+ */
+uint8_t mcp9600_interface_iic_read_batch_ctx(void *user, uint8_t addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf);
+
+/**
+ * @brief      interface iic bus read registers of several devices with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  *addr pointer to an iic device write address list
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the data of each register is stored one after another in buf
+ */
+uint8_t mcp9600_interface_iic_read_multi_ctx(void *user, uint8_t *addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf);
+
+/**
+ * @brief     interface delay ms with a user context
+ * @param[in] *user pointer to a user context
+ * @param[in] ms time
+ * @note      none
+ */
+void mcp9600_interface_delay_ms_ctx(void *user, uint32_t ms);
+
+/**
+ * @brief     interface get the monotonic timestamp with a user context
+ * @param[in] *user pointer to a user context
+ * @return    timestamp in ns
+ * @note      none
+ */
+uint64_t mcp9600_interface_timestamp_ctx(void *user);
+
 /**
  * @}
  */
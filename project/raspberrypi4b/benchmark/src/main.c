@@ -0,0 +1,883 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      main.c
+ * @brief     benchmark main source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9600.h"
+#include "driver_mcp9600_emulator.h"
+#include <getopt.h>
+#include <stdarg.h>
+#include <stdlib.h>
+#include <time.h>
+
+/**
+ * @brief benchmark definition
+ */
+#define BENCHMARK_ITERATION          1000        /**< default calls of each function */
+#define BENCHMARK_RESULT_MAX         256         /**< max result number */
+
+/**
+ * @brief benchmark counting bus structure definition
+ */
+typedef struct benchmark_bus_s
+{
+    mcp9600_emulator_t emulator;        /**< emulated chip */
+    uint32_t syscall;                   /**< transport calls, each one is an ioctl on the board */
+    uint32_t transaction;               /**< iic messages */
+    uint32_t byte;                      /**< data bytes moved */
+    uint32_t delay;                     /**< delay in ms */
+} benchmark_bus_t;
+
+/**
+ * @brief benchmark result structure definition
+ */
+typedef struct benchmark_result_s
+{
+    char variant[16];                   /**< transport variant */
+    char function[64];                  /**< function name */
+    double transaction;                 /**< iic messages per call */
+    double syscall;                     /**< transport calls per call */
+    double byte;                        /**< data bytes per call */
+    double delay;                       /**< delay ms per call */
+    double ns;                          /**< wall time ns per call */
+} benchmark_result_t;
+
+/**
+ * @brief benchmark function name list
+ */
+static const char *const gsc_benchmark_name[] =
+{
+    "mcp9600_info",
+    "mcp9600_set_addr_pin",
+    "mcp9600_get_addr_pin",
+    "mcp9600_scan",
+    "mcp9600_init/mcp9600_deinit",
+    "mcp9600_start_continuous_read",
+    "mcp9600_stop_continuous_read",
+    "mcp9600_continuous_read",
+    "mcp9600_fast_read",
+    "mcp9600_single_read",
+    "mcp9600_single_read_start/poll/collect",
+    "mcp9600_get_hot_junction_temperature",
+    "mcp9600_get_junction_thermocouple_delta",
+    "mcp9600_get_cold_junction_temperature",
+    "mcp9600_get_raw_adc",
+    "mcp9600_set_filter_coefficient",
+    "mcp9600_get_filter_coefficient",
+    "mcp9600_set_thermocouple_type",
+    "mcp9600_get_thermocouple_type",
+    "mcp9600_get_status_burst_complete_flag",
+    "mcp9600_clear_status_burst_complete_flag",
+    "mcp9600_get_status_temperature_update_flag",
+    "mcp9600_clear_status_temperature_update_flag",
+    "mcp9600_get_status_input_range",
+    "mcp9600_get_alert_status",
+    "mcp9600_set_cold_junction_resolution",
+    "mcp9600_get_cold_junction_resolution",
+    "mcp9600_set_adc_resolution",
+    "mcp9600_get_adc_resolution",
+    "mcp9600_set_burst_mode_sample",
+    "mcp9600_get_burst_mode_sample",
+    "mcp9600_set_mode",
+    "mcp9600_get_mode",
+    "mcp9600_alert_limit_convert_to_register",
+    "mcp9600_alert_limit_convert_to_data",
+    "mcp9600_set_alert_limit",
+    "mcp9600_get_alert_limit",
+    "mcp9600_alert_hysteresis_convert_to_register",
+    "mcp9600_alert_hysteresis_convert_to_data",
+    "mcp9600_set_alert_hysteresis",
+    "mcp9600_get_alert_hysteresis",
+    "mcp9600_clear_interrupt",
+    "mcp9600_get_interrupt",
+    "mcp9600_set_temperature_maintain_detect",
+    "mcp9600_get_temperature_maintain_detect",
+    "mcp9600_set_detect_edge",
+    "mcp9600_get_detect_edge",
+    "mcp9600_set_active_level",
+    "mcp9600_get_active_level",
+    "mcp9600_set_interrupt_mode",
+    "mcp9600_get_interrupt_mode",
+    "mcp9600_set_alert_output",
+    "mcp9600_get_alert_output",
+    "mcp9600_get_device_id_revision",
+    "mcp9600_set_conversion_guard",
+    "mcp9600_get_conversion_guard",
+    "mcp9600_get_conversion_time",
+    "mcp9600_get_single_read_poll_count",
+    "mcp9600_set_register_cache",
+    "mcp9600_get_register_cache",
+    "mcp9600_refresh_register_cache",
+    "mcp9600_latency_record",
+    "mcp9600_latency_get",
+    "mcp9600_latency_reset",
+    "mcp9600_set_stats",
+    "mcp9600_get_stats",
+    "mcp9600_reset_stats",
+    "mcp9600_set_reg",
+    "mcp9600_get_reg",
+    "mcp9600_continuous_read_fixed",
+    "mcp9600_fast_read_fixed",
+    "mcp9600_single_read_fixed",
+    "mcp9600_single_read_start/poll/collect_fixed",
+    "mcp9600_get_hot_junction_temperature_fixed",
+    "mcp9600_get_junction_thermocouple_delta_fixed",
+    "mcp9600_get_cold_junction_temperature_fixed",
+    "mcp9600_get_raw_adc_fixed",
+    "mcp9600_alert_limit_convert_to_register_fixed",
+    "mcp9600_alert_limit_convert_to_data_fixed",
+    "mcp9600_alert_hysteresis_convert_to_register_fixed",
+    "mcp9600_alert_hysteresis_convert_to_data_fixed",
+    "mcp9600_fast_read_raw",
+};
+
+/**
+ * @brief global var definition
+ */
+static benchmark_bus_t gs_bus;                                       /**< counting bus */
+static mcp9600_handle_t gs_handle;                                   /**< mcp9600 handle */
+static benchmark_result_t gs_result[BENCHMARK_RESULT_MAX];           /**< result list */
+static uint32_t gs_result_num;                                       /**< result number */
+
+/**
+ * @brief     counting iic bus init
+ * @param[in] *user pointer to a counting bus
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_benchmark_iic_init(void *user)
+{
+    benchmark_bus_t *bus = (benchmark_bus_t *)user;
+    
+    bus->syscall++;
+    
+    return mcp9600_emulator_iic_init(&bus->emulator);
+}
+
+/**
+ * @brief     counting iic bus deinit
+ * @param[in] *user pointer to a counting bus
+ * @return    status code
+ *            - 0 success
+ * @note      none
+ */
+static uint8_t a_benchmark_iic_deinit(void *user)
+{
+    benchmark_bus_t *bus = (benchmark_bus_t *)user;
+    
+    bus->syscall++;
+    
+    return mcp9600_emulator_iic_deinit(&bus->emulator);
+}
+
+/**
+ * @brief     counting iic bus write command
+ * @param[in] *user pointer to a counting bus
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_benchmark_iic_write_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    benchmark_bus_t *bus = (benchmark_bus_t *)user;
+    
+    bus->syscall++;
+    bus->transaction++;
+    bus->byte += len;
+    
+    return mcp9600_emulator_iic_write_cmd(&bus->emulator, addr, buf, len);
+}
+
+/**
+ * @brief      counting iic bus read command
+ * @param[in]  *user pointer to a counting bus
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_benchmark_iic_read_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    benchmark_bus_t *bus = (benchmark_bus_t *)user;
+    
+    bus->syscall++;
+    bus->transaction++;
+    bus->byte += len;
+    
+    return mcp9600_emulator_iic_read_cmd(&bus->emulator, addr, buf, len);
+}
+
+/**
+ * @brief      counting iic bus read
+ * @param[in]  *user pointer to a counting bus
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       one call is one repeated start transfer of two messages
+ */
+static uint8_t a_benchmark_iic_read(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    benchmark_bus_t *bus = (benchmark_bus_t *)user;
+    
+    bus->syscall++;
+    bus->transaction += 2;
+    bus->byte += 1 + len;
+    if (mcp9600_emulator_iic_write_cmd(&bus->emulator, addr, &reg, 1) != 0)
+    {
+        return 1;
+    }
+    
+    return mcp9600_emulator_iic_read_cmd(&bus->emulator, addr, buf, len);
+}
+
+/**
+ * @brief      counting iic bus read several registers
+ * @param[in]  *user pointer to a counting bus
+ * @param[in]  addr iic device write address
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       one call is one transfer of two messages per register
+ */
+static uint8_t a_benchmark_iic_read_batch(void *user, uint8_t addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    benchmark_bus_t *bus = (benchmark_bus_t *)user;
+    uint8_t i;
+    
+    bus->syscall++;
+    for (i = 0; i < num; i++)
+    {
+        bus->transaction += 2;
+        bus->byte += 1 + len[i];
+        if (mcp9600_emulator_iic_write_cmd(&bus->emulator, addr, &reg[i], 1) != 0)
+        {
+            return 1;
+        }
+        if (mcp9600_emulator_iic_read_cmd(&bus->emulator, addr, buf, len[i]) != 0)
+        {
+            return 1;
+        }
+        buf += len[i];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     counting delay ms
+ * @param[in] *user pointer to a counting bus
+ * @param[in] ms time
+ * @note      the emulated time is advanced instead of sleeping
+ */
+static void a_benchmark_delay_ms(void *user, uint32_t ms)
+{
+    benchmark_bus_t *bus = (benchmark_bus_t *)user;
+    
+    bus->delay += ms;
+    mcp9600_emulator_delay_ms(&bus->emulator, ms);
+}
+
+/**
+ * @brief     benchmark print format data
+ * @param[in] fmt format data
+ * @note      the driver messages go to stderr to keep stdout machine readable
+ */
+static void a_benchmark_debug_print(const char *const fmt, ...)
+{
+    va_list args;
+    
+    va_start(args, fmt);
+    (void)vfprintf(stderr, fmt, args);
+    va_end(args);
+}
+
+/**
+ * @brief  benchmark emulated timestamp
+ * @return timestamp in ns
+ * @note   none
+ */
+static uint64_t a_benchmark_timestamp(void)
+{
+    return (uint64_t)gs_bus.emulator.now * 1000000ULL;
+}
+
+/**
+ * @brief  benchmark wall clock
+ * @return timestamp in ns
+ * @note   none
+ */
+static uint64_t a_benchmark_clock(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     set up a fresh chip and handle
+ * @param[in] fast 0 for the command only transport, 1 for the repeated start and batch transport with the register cache
+ * @return    status code
+ *            - 0 success
+ *            - 1 setup failed
+ * @note      none
+ */
+static uint8_t a_benchmark_setup(uint8_t fast)
+{
+    (void)mcp9600_emulator_init(&gs_bus.emulator, MCP9600_ADDRESS_0);
+    (void)mcp9600_emulator_set_ramp(&gs_bus.emulator, 0.1f);
+    
+    DRIVER_MCP9600_LINK_INIT(&gs_handle, mcp9600_handle_t);
+    DRIVER_MCP9600_LINK_IIC_INIT_CTX(&gs_handle, a_benchmark_iic_init);
+    DRIVER_MCP9600_LINK_IIC_DEINIT_CTX(&gs_handle, a_benchmark_iic_deinit);
+    DRIVER_MCP9600_LINK_IIC_READ_COMMAND_CTX(&gs_handle, a_benchmark_iic_read_cmd);
+    DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND_CTX(&gs_handle, a_benchmark_iic_write_cmd);
+    DRIVER_MCP9600_LINK_IIC_DELAY_MS_CTX(&gs_handle, a_benchmark_delay_ms);
+    DRIVER_MCP9600_LINK_DEBUG_PRINT(&gs_handle, a_benchmark_debug_print);
+    DRIVER_MCP9600_LINK_TIMESTAMP(&gs_handle, a_benchmark_timestamp);
+    DRIVER_MCP9600_LINK_USER(&gs_handle, &gs_bus);
+    if (fast != 0)
+    {
+        DRIVER_MCP9600_LINK_IIC_READ_CTX(&gs_handle, a_benchmark_iic_read);
+        DRIVER_MCP9600_LINK_IIC_READ_BATCH_CTX(&gs_handle, a_benchmark_iic_read_batch);
+    }
+    if (mcp9600_set_addr_pin(&gs_handle, MCP9600_ADDRESS_0) != 0)
+    {
+        return 1;
+    }
+    if (fast != 0)
+    {
+        if (mcp9600_set_register_cache(&gs_handle, MCP9600_BOOL_TRUE) != 0)
+        {
+            return 1;
+        }
+    }
+    if (mcp9600_init(&gs_handle) != 0)
+    {
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     call one function
+ * @param[in] index function index
+ * @return    status code
+ *            - 0 success
+ *            - 1 call failed
+ * @note      the set functions write back the power on value, so the chip state is stable over the iterations,
+ *            the cache refresh is a no-op on the transport without the register cache
+ */
+static uint8_t a_benchmark_call(uint32_t index)
+{
+    uint8_t res;
+    uint8_t reg8;
+    uint8_t id;
+    uint8_t buf[2];
+    int16_t hot_raw;
+    int16_t delta_raw;
+    int16_t cold_raw;
+    int16_t reg16;
+    int32_t raw32;
+    int32_t hot_mc;
+    int32_t delta_mc;
+    int32_t cold_mc;
+    int32_t nv;
+    uint32_t ms;
+    float hot_s;
+    float delta_s;
+    float cold_s;
+    float c;
+    double uv;
+    mcp9600_info_t info;
+    mcp9600_address_t addr[8];
+    mcp9600_bool_t flag;
+    mcp9600_latency_t latency;
+    mcp9600_stats_t stats;
+    mcp9600_filter_coefficient_t coefficient;
+    mcp9600_thermocouple_type_t type;
+    mcp9600_input_range_t range;
+    mcp9600_alert_status_t alert_status;
+    mcp9600_cold_junction_resolution_t cold_resolution;
+    mcp9600_adc_resolution_t adc_resolution;
+    mcp9600_burst_mode_sample_t sample;
+    mcp9600_mode_t mode;
+    mcp9600_temperature_maintain_detect_t maintain_detect;
+    mcp9600_detect_edge_t edge;
+    mcp9600_active_level_t level;
+    mcp9600_interrupt_mode_t interrupt_mode;
+    
+    switch (index)
+    {
+        case 0 : res = mcp9600_info(&info); break;
+        case 1 : res = mcp9600_set_addr_pin(&gs_handle, MCP9600_ADDRESS_0); break;
+        case 2 : res = mcp9600_get_addr_pin(&gs_handle, &addr[0]); break;
+        case 3 : res = mcp9600_scan(&gs_handle, addr, &reg8); break;
+        case 4 :
+        {
+            res = mcp9600_deinit(&gs_handle);
+            res |= mcp9600_init(&gs_handle);
+            
+            break;
+        }
+        case 5 : res = mcp9600_start_continuous_read(&gs_handle); break;
+        case 6 :
+        {
+            res = mcp9600_stop_continuous_read(&gs_handle);
+            res |= mcp9600_set_mode(&gs_handle, MCP9600_MODE_NORMAL);
+            
+            break;
+        }
+        case 7 : res = mcp9600_continuous_read(&gs_handle, &hot_raw, &hot_s, &delta_raw, &delta_s, &cold_raw, &cold_s); break;
+        case 8 : res = mcp9600_fast_read(&gs_handle, &hot_raw, &hot_s, &delta_raw, &delta_s, &cold_raw, &cold_s, &reg8); break;
+        case 9 : res = mcp9600_single_read(&gs_handle, &hot_raw, &hot_s, &delta_raw, &delta_s, &cold_raw, &cold_s); break;
+        case 10 :
+        {
+            res = mcp9600_single_read_start(&gs_handle, &ms);
+            flag = MCP9600_BOOL_FALSE;
+            while ((res == 0) && (flag == MCP9600_BOOL_FALSE))
+            {
+                gs_handle.delay_ms_ctx(gs_handle.user, ms);
+                res = mcp9600_single_read_poll(&gs_handle, &flag);
+            }
+            res |= mcp9600_single_read_collect(&gs_handle, &hot_raw, &hot_s, &delta_raw, &delta_s, &cold_raw, &cold_s);
+            
+            break;
+        }
+        case 11 : res = mcp9600_get_hot_junction_temperature(&gs_handle, &hot_raw, &hot_s); break;
+        case 12 : res = mcp9600_get_junction_thermocouple_delta(&gs_handle, &delta_raw, &delta_s); break;
+        case 13 : res = mcp9600_get_cold_junction_temperature(&gs_handle, &cold_raw, &cold_s); break;
+        case 14 : res = mcp9600_get_raw_adc(&gs_handle, &raw32, &uv); break;
+        case 15 : res = mcp9600_set_filter_coefficient(&gs_handle, MCP9600_FILTER_COEFFICIENT_0); break;
+        case 16 : res = mcp9600_get_filter_coefficient(&gs_handle, &coefficient); break;
+        case 17 : res = mcp9600_set_thermocouple_type(&gs_handle, MCP9600_THERMOCOUPLE_TYPE_K); break;
+        case 18 : res = mcp9600_get_thermocouple_type(&gs_handle, &type); break;
+        case 19 : res = mcp9600_get_status_burst_complete_flag(&gs_handle, &flag); break;
+        case 20 : res = mcp9600_clear_status_burst_complete_flag(&gs_handle); break;
+        case 21 : res = mcp9600_get_status_temperature_update_flag(&gs_handle, &flag); break;
+        case 22 : res = mcp9600_clear_status_temperature_update_flag(&gs_handle); break;
+        case 23 : res = mcp9600_get_status_input_range(&gs_handle, &range); break;
+        case 24 : res = mcp9600_get_alert_status(&gs_handle, MCP9600_ALERT_1, &alert_status); break;
+        case 25 : res = mcp9600_set_cold_junction_resolution(&gs_handle, MCP9600_COLD_JUNCTION_RESOLUTION_0P0625); break;
+        case 26 : res = mcp9600_get_cold_junction_resolution(&gs_handle, &cold_resolution); break;
+        case 27 : res = mcp9600_set_adc_resolution(&gs_handle, MCP9600_ADC_RESOLUTION_18_BIT); break;
+        case 28 : res = mcp9600_get_adc_resolution(&gs_handle, &adc_resolution); break;
+        case 29 : res = mcp9600_set_burst_mode_sample(&gs_handle, MCP9600_BURST_MODE_SAMPLE_1); break;
+        case 30 : res = mcp9600_get_burst_mode_sample(&gs_handle, &sample); break;
+        case 31 : res = mcp9600_set_mode(&gs_handle, MCP9600_MODE_NORMAL); break;
+        case 32 : res = mcp9600_get_mode(&gs_handle, &mode); break;
+        case 33 : res = mcp9600_alert_limit_convert_to_register(&gs_handle, 30.0f, &reg16); break;
+        case 34 : res = mcp9600_alert_limit_convert_to_data(&gs_handle, 480, &c); break;
+        case 35 : res = mcp9600_set_alert_limit(&gs_handle, MCP9600_ALERT_1, 0); break;
+        case 36 : res = mcp9600_get_alert_limit(&gs_handle, MCP9600_ALERT_1, &reg16); break;
+        case 37 : res = mcp9600_alert_hysteresis_convert_to_register(&gs_handle, 2.0f, &reg8); break;
+        case 38 : res = mcp9600_alert_hysteresis_convert_to_data(&gs_handle, 2, &c); break;
+        case 39 : res = mcp9600_set_alert_hysteresis(&gs_handle, MCP9600_ALERT_1, 0); break;
+        case 40 : res = mcp9600_get_alert_hysteresis(&gs_handle, MCP9600_ALERT_1, &reg8); break;
+        case 41 : res = mcp9600_clear_interrupt(&gs_handle, MCP9600_ALERT_1); break;
+        case 42 : res = mcp9600_get_interrupt(&gs_handle, MCP9600_ALERT_1, &reg8); break;
+        case 43 : res = mcp9600_set_temperature_maintain_detect(&gs_handle, MCP9600_ALERT_1, MCP9600_TEMPERATURE_MAINTAIN_DETECT_HOT_JUNCTION); break;
+        case 44 : res = mcp9600_get_temperature_maintain_detect(&gs_handle, MCP9600_ALERT_1, &maintain_detect); break;
+        case 45 : res = mcp9600_set_detect_edge(&gs_handle, MCP9600_ALERT_1, MCP9600_DETECT_EDGE_RISING); break;
+        case 46 : res = mcp9600_get_detect_edge(&gs_handle, MCP9600_ALERT_1, &edge); break;
+        case 47 : res = mcp9600_set_active_level(&gs_handle, MCP9600_ALERT_1, MCP9600_ACTIVE_LEVEL_LOW); break;
+        case 48 : res = mcp9600_get_active_level(&gs_handle, MCP9600_ALERT_1, &level); break;
+        case 49 : res = mcp9600_set_interrupt_mode(&gs_handle, MCP9600_ALERT_1, MCP9600_INTERRUPT_MODE_COMPARATOR); break;
+        case 50 : res = mcp9600_get_interrupt_mode(&gs_handle, MCP9600_ALERT_1, &interrupt_mode); break;
+        case 51 : res = mcp9600_set_alert_output(&gs_handle, MCP9600_ALERT_1, MCP9600_BOOL_FALSE); break;
+        case 52 : res = mcp9600_get_alert_output(&gs_handle, MCP9600_ALERT_1, &flag); break;
+        case 53 : res = mcp9600_get_device_id_revision(&gs_handle, &id, &reg8); break;
+        case 54 : res = mcp9600_set_conversion_guard(&gs_handle, 0); break;
+        case 55 : res = mcp9600_get_conversion_guard(&gs_handle, &ms); break;
+        case 56 : res = mcp9600_get_conversion_time(&gs_handle, &ms); break;
+        case 57 : res = mcp9600_get_single_read_poll_count(&gs_handle, &ms); break;
+        case 58 : res = mcp9600_set_register_cache(&gs_handle, gs_handle.cache_enable ? MCP9600_BOOL_TRUE : MCP9600_BOOL_FALSE); break;
+        case 59 : res = mcp9600_get_register_cache(&gs_handle, &flag); break;
+        case 60 : res = (gs_handle.cache_enable != 0) ? mcp9600_refresh_register_cache(&gs_handle) : 0; break;
+        case 61 : res = mcp9600_latency_record(&gs_handle, a_benchmark_timestamp(), &ms); break;
+        case 62 : res = mcp9600_latency_get(&gs_handle, &latency); break;
+        case 63 : res = mcp9600_latency_reset(&gs_handle); break;
+        case 64 : res = mcp9600_set_stats(&gs_handle, MCP9600_BOOL_FALSE); break;
+        case 65 : res = mcp9600_get_stats(&gs_handle, &stats); break;
+        case 66 : res = mcp9600_reset_stats(&gs_handle); break;
+        case 67 :
+        {
+            buf[0] = 0x00;
+            res = mcp9600_set_reg(&gs_handle, 0x05, buf, 1);
+            
+            break;
+        }
+        case 68 : res = mcp9600_get_reg(&gs_handle, 0x05, buf, 1); break;
+        case 69 : res = mcp9600_continuous_read_fixed(&gs_handle, &hot_raw, &hot_mc, &delta_raw, &delta_mc, &cold_raw, &cold_mc); break;
+        case 70 : res = mcp9600_fast_read_fixed(&gs_handle, &hot_raw, &hot_mc, &delta_raw, &delta_mc, &cold_raw, &cold_mc, &reg8); break;
+        case 71 : res = mcp9600_single_read_fixed(&gs_handle, &hot_raw, &hot_mc, &delta_raw, &delta_mc, &cold_raw, &cold_mc); break;
+        case 72 :
+        {
+            res = mcp9600_single_read_start(&gs_handle, &ms);
+            flag = MCP9600_BOOL_FALSE;
+            while ((res == 0) && (flag == MCP9600_BOOL_FALSE))
+            {
+                gs_handle.delay_ms_ctx(gs_handle.user, ms);
+                res = mcp9600_single_read_poll(&gs_handle, &flag);
+            }
+            res |= mcp9600_single_read_collect_fixed(&gs_handle, &hot_raw, &hot_mc, &delta_raw, &delta_mc, &cold_raw, &cold_mc);
+            
+            break;
+        }
+        case 73 : res = mcp9600_get_hot_junction_temperature_fixed(&gs_handle, &hot_raw, &hot_mc); break;
+        case 74 : res = mcp9600_get_junction_thermocouple_delta_fixed(&gs_handle, &delta_raw, &delta_mc); break;
+        case 75 : res = mcp9600_get_cold_junction_temperature_fixed(&gs_handle, &cold_raw, &cold_mc); break;
+        case 76 : res = mcp9600_get_raw_adc_fixed(&gs_handle, &raw32, &nv); break;
+        case 77 : res = mcp9600_alert_limit_convert_to_register_fixed(&gs_handle, 30000, &reg16); break;
+        case 78 : res = mcp9600_alert_limit_convert_to_data_fixed(&gs_handle, 480, &hot_mc); break;
+        case 79 : res = mcp9600_alert_hysteresis_convert_to_register_fixed(&gs_handle, 2000, &reg8); break;
+        case 80 : res = mcp9600_alert_hysteresis_convert_to_data_fixed(&gs_handle, 2, &hot_mc); break;
+        case 81 : res = mcp9600_fast_read_raw(&gs_handle, &hot_raw, &delta_raw, &cold_raw, &reg8); break;
+        default : res = 1; break;
+    }
+    
+    return res;
+}
+
+/**
+ * @brief     run all the functions on one transport variant
+ * @param[in] fast 0 for the command only transport, 1 for the repeated start and batch transport with the register cache
+ * @param[in] iteration calls of each function
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed
+ * @note      every function starts from a freshly initialized chip and handle
+ */
+static uint8_t a_benchmark_run(uint8_t fast, uint32_t iteration)
+{
+    uint32_t i;
+    uint32_t j;
+    uint64_t start;
+    uint64_t stop;
+    benchmark_result_t *result;
+    
+    for (i = 0; i < sizeof(gsc_benchmark_name) / sizeof(gsc_benchmark_name[0]); i++)
+    {
+        if (gs_result_num >= BENCHMARK_RESULT_MAX)
+        {
+            return 1;
+        }
+        if (a_benchmark_setup(fast) != 0)
+        {
+            a_benchmark_debug_print("benchmark: setup failed.\n");
+            
+            return 1;
+        }
+        gs_bus.syscall = 0;
+        gs_bus.transaction = 0;
+        gs_bus.byte = 0;
+        gs_bus.delay = 0;
+        start = a_benchmark_clock();
+        for (j = 0; j < iteration; j++)
+        {
+            if (a_benchmark_call(i) != 0)
+            {
+                a_benchmark_debug_print("benchmark: %s failed.\n", gsc_benchmark_name[i]);
+                
+                return 1;
+            }
+        }
+        stop = a_benchmark_clock();
+        result = &gs_result[gs_result_num++];
+        memset(result, 0, sizeof(benchmark_result_t));
+        snprintf(result->variant, sizeof(result->variant), "%s", (fast != 0) ? "fast" : "basic");
+        snprintf(result->function, sizeof(result->function), "%s", gsc_benchmark_name[i]);
+        result->transaction = (double)gs_bus.transaction / iteration;
+        result->syscall = (double)gs_bus.syscall / iteration;
+        result->byte = (double)gs_bus.byte / iteration;
+        result->delay = (double)gs_bus.delay / iteration;
+        result->ns = (double)(stop - start) / iteration;
+        (void)mcp9600_deinit(&gs_handle);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     print the results
+ * @param[in] *fp pointer to an output file
+ * @param[in] json 0 for csv, 1 for json
+ * @param[in] ns 0 to leave out the host dependent wall time
+ * @note      none
+ */
+static void a_benchmark_print(FILE *fp, uint8_t json, uint8_t ns)
+{
+    uint32_t i;
+    benchmark_result_t *r;
+    
+    if (json != 0)
+    {
+        fprintf(fp, "[\n");
+    }
+    else
+    {
+        fprintf(fp, "variant,function,transactions,syscalls,bytes,delay_ms%s\n", (ns != 0) ? ",ns" : "");
+    }
+    for (i = 0; i < gs_result_num; i++)
+    {
+        r = &gs_result[i];
+        if (json != 0)
+        {
+            fprintf(fp, "  {\"variant\": \"%s\", \"function\": \"%s\", \"transactions\": %.2f, \"syscalls\": %.2f, "
+                    "\"bytes\": %.2f, \"delay_ms\": %.2f, \"ns\": %.0f}%s\n",
+                    r->variant, r->function, r->transaction, r->syscall, r->byte, r->delay, r->ns,
+                    (i + 1 < gs_result_num) ? "," : "");
+        }
+        else if (ns != 0)
+        {
+            fprintf(fp, "%s,%s,%.2f,%.2f,%.2f,%.2f,%.0f\n",
+                    r->variant, r->function, r->transaction, r->syscall, r->byte, r->delay, r->ns);
+        }
+        else
+        {
+            fprintf(fp, "%s,%s,%.2f,%.2f,%.2f,%.2f\n",
+                    r->variant, r->function, r->transaction, r->syscall, r->byte, r->delay);
+        }
+    }
+    if (json != 0)
+    {
+        fprintf(fp, "]\n");
+    }
+}
+
+/**
+ * @brief     compare the results with a baseline
+ * @param[in] *path pointer to a baseline csv path
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed or regression found
+ * @note      transactions, syscalls, bytes and delay are compared exactly, the wall time is not gated
+ */
+static uint8_t a_benchmark_compare(const char *path)
+{
+    FILE *fp;
+    char line[256];
+    uint32_t i;
+    uint8_t res;
+    uint8_t found;
+    benchmark_result_t b;
+    
+    fp = fopen(path, "r");
+    if (fp == NULL)
+    {
+        a_benchmark_debug_print("benchmark: open %s failed.\n", path);
+        
+        return 1;
+    }
+    res = 0;
+    while (fgets(line, sizeof(line), fp) != NULL)
+    {
+        memset(&b, 0, sizeof(benchmark_result_t));
+        if (sscanf(line, "%15[^,],%63[^,],%lf,%lf,%lf,%lf", b.variant, b.function,
+                   &b.transaction, &b.syscall, &b.byte, &b.delay) != 6)
+        {
+            continue;
+        }
+        found = 0;
+        for (i = 0; i < gs_result_num; i++)
+        {
+            benchmark_result_t *r = &gs_result[i];
+            
+            if ((strcmp(r->variant, b.variant) != 0) || (strcmp(r->function, b.function) != 0))
+            {
+                continue;
+            }
+            found = 1;
+            if ((r->transaction > b.transaction + 0.005) || (r->syscall > b.syscall + 0.005) ||
+                (r->byte > b.byte + 0.005) || (r->delay > b.delay + 0.005))
+            {
+                a_benchmark_debug_print("benchmark: regression %s %s transactions %.2f/%.2f syscalls %.2f/%.2f "
+                                        "bytes %.2f/%.2f delay %.2f/%.2f.\n",
+                                        r->variant, r->function, r->transaction, b.transaction, r->syscall, b.syscall,
+                                        r->byte, b.byte, r->delay, b.delay);
+                res = 1;
+            }
+            else if ((r->transaction < b.transaction - 0.005) || (r->syscall < b.syscall - 0.005) ||
+                     (r->byte < b.byte - 0.005) || (r->delay < b.delay - 0.005))
+            {
+                a_benchmark_debug_print("benchmark: improvement %s %s, please update the baseline.\n",
+                                        r->variant, r->function);
+            }
+            else
+            {
+                
+            }
+        }
+        if (found == 0)
+        {
+            a_benchmark_debug_print("benchmark: %s %s is not benchmarked any more.\n", b.variant, b.function);
+            res = 1;
+        }
+    }
+    fclose(fp);
+    
+    return res;
+}
+
+/**
+ * @brief     main function
+ * @param[in] argc arg numbers
+ * @param[in] **argv arg address
+ * @return    status code
+ *            - 0 success
+ *            - 1 run failed or regression found
+ * @note      none
+ */
+int main(int argc, char **argv)
+{
+    int c;
+    int longindex = 0;
+    const char short_options[] = "hjn:b:w:";
+    const struct option long_options[] =
+    {
+        {"help", no_argument, NULL, 'h'},
+        {"json", no_argument, NULL, 'j'},
+        {"iteration", required_argument, NULL, 'n'},
+        {"baseline", required_argument, NULL, 'b'},
+        {"write", required_argument, NULL, 'w'},
+        {NULL, 0, NULL, 0},
+    };
+    uint8_t json = 0;
+    uint32_t iteration = BENCHMARK_ITERATION;
+    const char *baseline = NULL;
+    const char *write = NULL;
+    FILE *fp;
+    
+    /* parse */
+    while ((c = getopt_long(argc, argv, short_options, long_options, &longindex)) != -1)
+    {
+        switch (c)
+        {
+            case 'j' :
+            {
+                json = 1;
+                
+                break;
+            }
+            case 'n' :
+            {
+                iteration = (uint32_t)atol(optarg);
+                if (iteration == 0)
+                {
+                    iteration = 1;
+                }
+                
+                break;
+            }
+            case 'b' :
+            {
+                baseline = optarg;
+                
+                break;
+            }
+            case 'w' :
+            {
+                write = optarg;
+                
+                break;
+            }
+            default :
+            {
+                printf("Usage:\n");
+                printf("  mcp9600_benchmark [-j | --json] [-n <count> | --iteration=<count>]\n");
+                printf("                    [-b <csv> | --baseline=<csv>] [-w <csv> | --write=<csv>]\n");
+                printf("\n");
+                printf("Options:\n");
+                printf("  -b <csv>, --baseline=<csv>    Fail when any call needs more transactions, syscalls, bytes or delay than the baseline.\n");
+                printf("  -h, --help                    Show the help.\n");
+                printf("  -j, --json                    Print the results as json instead of csv.\n");
+                printf("  -n <count>, --iteration=<count>\n");
+                printf("                                Set the calls of each function.([default: 1000])\n");
+                printf("  -w <csv>, --write=<csv>       Write the results as a new baseline.\n");
+                
+                return (c == 'h') ? 0 : 1;
+            }
+        }
+    }
+    
+    /* run both transports */
+    if ((a_benchmark_run(0, iteration) != 0) || (a_benchmark_run(1, iteration) != 0))
+    {
+        return 1;
+    }
+    a_benchmark_print(stdout, json, 1);
+    
+    /* write the baseline */
+    if (write != NULL)
+    {
+        fp = fopen(write, "w");
+        if (fp == NULL)
+        {
+            a_benchmark_debug_print("benchmark: open %s failed.\n", write);
+            
+            return 1;
+        }
+        a_benchmark_print(fp, 0, 0);
+        fclose(fp);
+    }
+    
+    /* compare with the baseline */
+    if (baseline != NULL)
+    {
+        if (a_benchmark_compare(baseline) != 0)
+        {
+            return 1;
+        }
+    }
+    
+    return 0;
+}
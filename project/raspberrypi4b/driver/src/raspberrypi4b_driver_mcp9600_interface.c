@@ -37,6 +37,7 @@
 #include "driver_mcp9600_interface.h"
 #include "iic.h"
 #include <stdarg.h>
+#include <time.h>
 
 /**
  * @brief iic device name definition
@@ -102,6 +103,56 @@ uint8_t mcp9600_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
     return iic_read_cmd(gs_fd, addr, buf, len);
 }
 
+/**
+ * @brief      interface iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       write the register pointer and read the data in one repeated start transaction
+ */
+uint8_t mcp9600_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return iic_read(gs_fd, addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read several registers
+ * @param[in]  addr iic device write address
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the data of each register is stored one after another in buf
+ */
+uint8_t mcp9600_interface_iic_read_batch(uint8_t addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    return iic_read_batch(gs_fd, addr, reg, len, num, buf);
+}
+
+/**
+ * @brief      interface iic bus read registers of several devices
+ * @param[in]  *addr pointer to an iic device write address list
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the data of each register is stored one after another in buf
+ */
+uint8_t mcp9600_interface_iic_read_multi(uint8_t *addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    return iic_read_multi(gs_fd, addr, reg, len, num, buf);
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -129,3 +180,164 @@ void mcp9600_interface_debug_print(const char *const fmt, ...)
     
     (void)printf((uint8_t *)str);
 }
+
+/**
+ * @brief  interface get the monotonic timestamp
+ * @return timestamp in ns
+ * @note   it shares the clock with the gpiod event timestamp
+ */
+uint64_t mcp9600_interface_timestamp(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     interface iic bus init with a user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      none
+ */
+uint8_t mcp9600_interface_iic_init_ctx(void *user)
+{
+    iic_bus_t *bus = (iic_bus_t *)user;
+    
+    return iic_init(bus->name, &bus->fd);
+}
+
+/**
+ * @brief     interface iic bus deinit with a user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+uint8_t mcp9600_interface_iic_deinit_ctx(void *user)
+{
+    iic_bus_t *bus = (iic_bus_t *)user;
+    
+    return iic_deinit(bus->fd);
+}
+
+/**
+ * @brief     interface iic bus write command with a user context
+ * @param[in] *user pointer to a user context
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t mcp9600_interface_iic_write_cmd_ctx(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    iic_bus_t *bus = (iic_bus_t *)user;
+    
+    return iic_write_cmd(bus->fd, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read command with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9600_interface_iic_read_cmd_ctx(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    iic_bus_t *bus = (iic_bus_t *)user;
+    
+    return iic_read_cmd(bus->fd, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       write the register pointer and read the data in one repeated start transaction
+ */
+uint8_t mcp9600_interface_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    iic_bus_t *bus = (iic_bus_t *)user;
+    
+    return iic_read(bus->fd, addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read several registers with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  addr iic device write address
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the data of each register is stored one after another in buf
+ */
+uint8_t mcp9600_interface_iic_read_batch_ctx(void *user, uint8_t addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    iic_bus_t *bus = (iic_bus_t *)user;
+    
+    return iic_read_batch(bus->fd, addr, reg, len, num, buf);
+}
+
+/**
+ * @brief      interface iic bus read registers of several devices with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  *addr pointer to an iic device write address list
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the data of each register is stored one after another in buf
+ */
+uint8_t mcp9600_interface_iic_read_multi_ctx(void *user, uint8_t *addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    iic_bus_t *bus = (iic_bus_t *)user;
+    
+    return iic_read_multi(bus->fd, addr, reg, len, num, buf);
+}
+
+/**
+ * @brief     interface delay ms with a user context
+ * @param[in] *user pointer to a user context
+ * @param[in] ms time
+ * @note      none
+ */
+void mcp9600_interface_delay_ms_ctx(void *user, uint32_t ms)
+{
+    usleep(1000 * ms);
+}
+
+/**
+ * @brief     interface get the monotonic timestamp with a user context
+ * @param[in] *user pointer to a user context
+ * @return    timestamp in ns
+ * @note      all the buses share the clock with the gpiod event timestamp
+ */
+uint64_t mcp9600_interface_timestamp_ctx(void *user)
+{
+    return mcp9600_interface_timestamp();
+}
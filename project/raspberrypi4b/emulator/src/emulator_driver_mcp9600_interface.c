@@ -0,0 +1,344 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      emulator_driver_mcp9600_interface.c
+ * @brief     emulator driver mcp9600 interface source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9600_interface.h"
+#include "driver_mcp9600_emulator.h"
+#include <stdarg.h>
+
+/**
+ * @brief emulated chip definition
+ */
+extern mcp9600_emulator_t g_emulator;        /**< emulated chip */
+
+/**
+ * @brief  interface iic bus init
+ * @return status code
+ *         - 0 success
+ *         - 1 iic init failed
+ * @note   none
+ */
+uint8_t mcp9600_interface_iic_init(void)
+{
+    return mcp9600_emulator_iic_init(&g_emulator);
+}
+
+/**
+ * @brief  interface iic bus deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 iic deinit failed
+ * @note   none
+ */
+uint8_t mcp9600_interface_iic_deinit(void)
+{
+    return mcp9600_emulator_iic_deinit(&g_emulator);
+}
+
+/**
+ * @brief     interface iic bus write command
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t mcp9600_interface_iic_write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return mcp9600_emulator_iic_write_cmd(&g_emulator, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read command
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9600_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return mcp9600_emulator_iic_read_cmd(&g_emulator, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       write the register pointer and read the data in one repeated start transaction
+ */
+uint8_t mcp9600_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    if (mcp9600_emulator_iic_write_cmd(&g_emulator, addr, &reg, 1) != 0)
+    {
+        return 1;
+    }
+    
+    return mcp9600_emulator_iic_read_cmd(&g_emulator, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read several registers
+ * @param[in]  addr iic device write address
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the data of each register is stored one after another in buf
+ */
+uint8_t mcp9600_interface_iic_read_batch(uint8_t addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    uint8_t i;
+    
+    for (i = 0; i < num; i++)
+    {
+        if (mcp9600_interface_iic_read(addr, reg[i], buf, len[i]) != 0)
+        {
+            return 1;
+        }
+        buf += len[i];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      interface iic bus read registers of several devices
+ * @param[in]  *addr pointer to an iic device write address list
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the data of each register is stored one after another in buf
+ */
+uint8_t mcp9600_interface_iic_read_multi(uint8_t *addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    uint8_t i;
+    
+    for (i = 0; i < num; i++)
+    {
+        if (mcp9600_interface_iic_read(addr[i], reg[i], buf, len[i]) != 0)
+        {
+            return 1;
+        }
+        buf += len[i];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface delay ms
+ * @param[in] ms time
+ * @note      the emulated time is advanced instead of sleeping
+ */
+void mcp9600_interface_delay_ms(uint32_t ms)
+{
+    mcp9600_emulator_delay_ms(&g_emulator, ms);
+}
+
+/**
+ * @brief     interface print format data
+ * @param[in] fmt format data
+ * @note      none
+ */
+void mcp9600_interface_debug_print(const char *const fmt, ...)
+{
+    char str[256];
+    va_list args;
+    
+    memset((char *)str, 0, sizeof(char) * 256); 
+    va_start(args, fmt);
+    vsnprintf((char *)str, 255, (char const *)fmt, args);
+    va_end(args);
+    
+    (void)printf("%s", str);
+}
+
+/**
+ * @brief  interface get the monotonic timestamp
+ * @return timestamp in ns
+ * @note   it follows the emulated time
+ */
+uint64_t mcp9600_interface_timestamp(void)
+{
+    return (uint64_t)g_emulator.now * 1000000ULL;
+}
+
+/**
+ * @brief     interface iic bus init with a user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      user points to an mcp9600 emulator structure
+ */
+uint8_t mcp9600_interface_iic_init_ctx(void *user)
+{
+    return mcp9600_emulator_iic_init(user);
+}
+
+/**
+ * @brief     interface iic bus deinit with a user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      user points to an mcp9600 emulator structure
+ */
+uint8_t mcp9600_interface_iic_deinit_ctx(void *user)
+{
+    return mcp9600_emulator_iic_deinit(user);
+}
+
+/**
+ * @brief     interface iic bus write command with a user context
+ * @param[in] *user pointer to a user context
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      user points to an mcp9600 emulator structure
+ */
+uint8_t mcp9600_interface_iic_write_cmd_ctx(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return mcp9600_emulator_iic_write_cmd(user, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read command with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       user points to an mcp9600 emulator structure
+ */
+uint8_t mcp9600_interface_iic_read_cmd_ctx(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return mcp9600_emulator_iic_read_cmd(user, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       user points to an mcp9600 emulator structure
+ */
+uint8_t mcp9600_interface_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    if (mcp9600_emulator_iic_write_cmd(user, addr, &reg, 1) != 0)
+    {
+        return 1;
+    }
+    
+    return mcp9600_emulator_iic_read_cmd(user, addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read several registers with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  addr iic device write address
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       user points to an mcp9600 emulator structure
+ */
+uint8_t mcp9600_interface_iic_read_batch_ctx(void *user, uint8_t addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    uint8_t i;
+    
+    for (i = 0; i < num; i++)
+    {
+        if (mcp9600_interface_iic_read_ctx(user, addr, reg[i], buf, len[i]) != 0)
+        {
+            return 1;
+        }
+        buf += len[i];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     interface delay ms with a user context
+ * @param[in] *user pointer to a user context
+ * @param[in] ms time
+ * @note      user points to an mcp9600 emulator structure
+ */
+void mcp9600_interface_delay_ms_ctx(void *user, uint32_t ms)
+{
+    mcp9600_emulator_delay_ms(user, ms);
+}
+
+/**
+ * @brief     interface get the monotonic timestamp with a user context
+ * @param[in] *user pointer to a user context
+ * @return    timestamp in ns
+ * @note      user points to an mcp9600 emulator structure and it follows its emulated time
+ */
+uint64_t mcp9600_interface_timestamp_ctx(void *user)
+{
+    return (uint64_t)((mcp9600_emulator_t *)user)->now * 1000000ULL;
+}
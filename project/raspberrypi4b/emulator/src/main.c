@@ -0,0 +1,1408 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      main.c
+ * @brief     emulator main source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9600_register_test.h"
+#include "driver_mcp9600_read_test.h"
+#include "driver_mcp9600_interrupt_test.h"
+#include "driver_mcp9600_emulator.h"
+#include "driver_mcp9600_convert.h"
+#include "driver_mcp9600_linearization.h"
+#include "trace.h"
+#include "engine.h"
+#include "driver_mcp9600_fleet.h"
+#include "driver_mcp9600_bus.h"
+#include <math.h>
+
+/**
+ * @brief global var definition
+ */
+mcp9600_emulator_t g_emulator;        /**< emulated chip */
+
+#if (MCP9600_STATIC_BINDING == 0)
+/**
+ * @brief      read the hot junction a few times on a trace
+ * @param[in]  *trace pointer to an opened trace
+ * @param[out] *hot pointer to a hot junction buffer
+ * @param[in]  num read times
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       none
+ */
+static uint8_t a_trace_session(trace_t *trace, int16_t *hot, uint8_t num)
+{
+    uint8_t i;
+    uint8_t res;
+    float hot_s;
+    mcp9600_handle_t handle;
+    
+    DRIVER_MCP9600_LINK_INIT(&handle, mcp9600_handle_t);
+    DRIVER_MCP9600_LINK_IIC_INIT_CTX(&handle, trace_iic_init);
+    DRIVER_MCP9600_LINK_IIC_DEINIT_CTX(&handle, trace_iic_deinit);
+    DRIVER_MCP9600_LINK_IIC_READ_COMMAND_CTX(&handle, trace_iic_read_cmd);
+    DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND_CTX(&handle, trace_iic_write_cmd);
+    DRIVER_MCP9600_LINK_IIC_DELAY_MS_CTX(&handle, trace_delay_ms);
+    DRIVER_MCP9600_LINK_DEBUG_PRINT(&handle, mcp9600_interface_debug_print);
+    DRIVER_MCP9600_LINK_USER(&handle, trace);
+    res = mcp9600_set_addr_pin(&handle, MCP9600_ADDRESS_0);
+    res |= mcp9600_init(&handle);
+    for (i = 0; (res == 0) && (i < num); i++)
+    {
+        trace_delay_ms(trace, 1000);
+        res = mcp9600_get_hot_junction_temperature(&handle, &hot[i], &hot_s);
+    }
+    (void)mcp9600_deinit(&handle);
+    
+    return res;
+}
+#endif
+
+/**
+ * @brief  check the batch convert paths against the getter formulas
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   every int16 value and a sweep of the int32 range are checked on each available path
+ */
+static uint8_t a_convert_check(void)
+{
+    static int16_t raw16[65536];
+    static int32_t raw32[65536];
+    static float f[65536];
+    static double d[65536];
+    uint32_t i;
+    uint8_t p;
+    uint8_t r;
+    double resolution;
+    float cold;
+    
+    for (i = 0; i < 65536; i++)
+    {
+        raw16[i] = (int16_t)(i - 32768);
+        raw32[i] = (int32_t)((i - 32768) * 65537);
+    }
+    raw32[65535] = 0x7FFFFFFF;
+    for (p = 0; p <= (uint8_t)MCP9600_CONVERT_PATH_NEON; p++)
+    {
+        if (mcp9600_convert_set_path((mcp9600_convert_path_t)p) != 0)
+        {
+            continue;
+        }
+        
+        /* odd length to run the tails */
+        (void)mcp9600_convert_temperature(raw16, 65535, f);
+        (void)mcp9600_convert_temperature_double(raw16, 65535, d);
+        for (i = 0; i < 65535; i++)
+        {
+            if ((f[i] != (float)(raw16[i]) / 16.0f) || (d[i] != (double)((float)(raw16[i]) / 16.0f)))
+            {
+                printf("mcp9600: convert path %d temperature differs.\n", p);
+                
+                return 1;
+            }
+        }
+        for (r = 0; r < 2; r++)
+        {
+            (void)mcp9600_convert_cold_junction((mcp9600_cold_junction_resolution_t)r, raw16, 65535, f);
+            (void)mcp9600_convert_cold_junction_double((mcp9600_cold_junction_resolution_t)r, raw16, 65535, d);
+            for (i = 0; i < 65535; i++)
+            {
+                cold = (r == 0) ? ((float)(raw16[i]) / 16.0f) : ((float)(raw16[i]) / 4.0f);
+                if ((f[i] != cold) || (d[i] != (double)cold))
+                {
+                    printf("mcp9600: convert path %d cold junction differs.\n", p);
+                    
+                    return 1;
+                }
+            }
+        }
+        for (r = 0; r < 4; r++)
+        {
+            resolution = (r == 0) ? 2.0 : ((r == 1) ? 8.0 : ((r == 2) ? 32.0 : 128.0));
+            (void)mcp9600_convert_raw_adc((mcp9600_adc_resolution_t)r, raw32, 65535, d);
+            (void)mcp9600_convert_raw_adc_float((mcp9600_adc_resolution_t)r, raw32, 65535, f);
+            for (i = 0; i < 65535; i++)
+            {
+                if ((d[i] != (double)(raw32[i]) * resolution) || (f[i] != (float)((double)(raw32[i]) * resolution)))
+                {
+                    printf("mcp9600: convert path %d raw adc differs.\n", p);
+                    
+                    return 1;
+                }
+            }
+        }
+        printf("mcp9600: convert path %d matches the getters.\n", p);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  check the linearization against the nist its-90 tables
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   table points, reference segment boundaries, round trips inside the stated inverse error and the batch api are checked
+ */
+static uint8_t a_linearization_check(void)
+{
+    /* table points in mV, the tables are rounded to 1 uV */
+    static const struct
+    {
+        uint8_t type;
+        double c;
+        double mv;
+    } point[] =
+    {
+        {MCP9600_THERMOCOUPLE_TYPE_K, -100.0, -3.554}, {MCP9600_THERMOCOUPLE_TYPE_K, 500.0, 20.644},
+        {MCP9600_THERMOCOUPLE_TYPE_K, 1000.0, 41.276}, {MCP9600_THERMOCOUPLE_TYPE_J, -100.0, -4.633},
+        {MCP9600_THERMOCOUPLE_TYPE_J, 500.0, 27.393},  {MCP9600_THERMOCOUPLE_TYPE_J, 1000.0, 57.953},
+        {MCP9600_THERMOCOUPLE_TYPE_T, -100.0, -3.379}, {MCP9600_THERMOCOUPLE_TYPE_T, 200.0, 9.288},
+        {MCP9600_THERMOCOUPLE_TYPE_T, 400.0, 20.872},  {MCP9600_THERMOCOUPLE_TYPE_N, -100.0, -2.407},
+        {MCP9600_THERMOCOUPLE_TYPE_N, 500.0, 16.748},  {MCP9600_THERMOCOUPLE_TYPE_N, 1000.0, 36.256},
+        {MCP9600_THERMOCOUPLE_TYPE_S, 100.0, 0.646},   {MCP9600_THERMOCOUPLE_TYPE_S, 1000.0, 9.587},
+        {MCP9600_THERMOCOUPLE_TYPE_S, 1500.0, 15.582}, {MCP9600_THERMOCOUPLE_TYPE_E, -100.0, -5.237},
+        {MCP9600_THERMOCOUPLE_TYPE_E, 500.0, 37.005},  {MCP9600_THERMOCOUPLE_TYPE_E, 1000.0, 76.373},
+        {MCP9600_THERMOCOUPLE_TYPE_B, 500.0, 1.242},   {MCP9600_THERMOCOUPLE_TYPE_B, 1000.0, 4.834},
+        {MCP9600_THERMOCOUPLE_TYPE_B, 1800.0, 13.591}, {MCP9600_THERMOCOUPLE_TYPE_R, 100.0, 0.647},
+        {MCP9600_THERMOCOUPLE_TYPE_R, 1000.0, 10.506}, {MCP9600_THERMOCOUPLE_TYPE_R, 1500.0, 17.451},
+    };
+    
+    /* reference polynomial segment boundaries in C */
+    static const struct
+    {
+        uint8_t type;
+        double c;
+    } boundary[] =
+    {
+        {MCP9600_THERMOCOUPLE_TYPE_K, 0.0},     {MCP9600_THERMOCOUPLE_TYPE_J, 760.0},
+        {MCP9600_THERMOCOUPLE_TYPE_T, 0.0},     {MCP9600_THERMOCOUPLE_TYPE_N, 0.0},
+        {MCP9600_THERMOCOUPLE_TYPE_S, 1064.18}, {MCP9600_THERMOCOUPLE_TYPE_S, 1664.5},
+        {MCP9600_THERMOCOUPLE_TYPE_E, 0.0},     {MCP9600_THERMOCOUPLE_TYPE_B, 630.615},
+        {MCP9600_THERMOCOUPLE_TYPE_R, 1064.18}, {MCP9600_THERMOCOUPLE_TYPE_R, 1664.5},
+    };
+    
+    /* inverse polynomial ranges with the stated error in C, unit is the last stated digit */
+    static const struct
+    {
+        uint8_t type;
+        double min;
+        double max;
+        double lo;
+        double hi;
+        double unit;
+    } range[] =
+    {
+        {MCP9600_THERMOCOUPLE_TYPE_K, -200.0, 0.0, -0.02, 0.04, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_K, 0.0, 500.0, -0.05, 0.04, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_K, 500.0, 1372.0, -0.05, 0.06, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_J, -210.0, 0.0, -0.05, 0.03, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_J, 0.0, 760.0, -0.04, 0.04, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_J, 760.0, 1200.0, -0.04, 0.03, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_T, -200.0, 0.0, -0.02, 0.04, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_T, 0.0, 400.0, -0.03, 0.03, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_N, -200.0, 0.0, -0.02, 0.03, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_N, 0.0, 600.0, -0.02, 0.03, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_N, 600.0, 1300.0, -0.04, 0.02, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_S, -50.0, 250.0, -0.02, 0.02, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_S, 250.0, 1200.0, -0.01, 0.01, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_S, 1200.0, 1664.5, -0.0002, 0.0002, 0.0001},
+        {MCP9600_THERMOCOUPLE_TYPE_S, 1664.5, 1768.1, -0.002, 0.002, 0.001},
+        {MCP9600_THERMOCOUPLE_TYPE_E, -200.0, 0.0, -0.01, 0.03, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_E, 0.0, 1000.0, -0.02, 0.02, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_B, 250.0, 700.0, -0.02, 0.03, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_B, 700.0, 1820.0, -0.01, 0.02, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_R, -50.0, 250.0, -0.02, 0.02, 0.01},
+        {MCP9600_THERMOCOUPLE_TYPE_R, 250.0, 1200.0, -0.005, 0.005, 0.001},
+        {MCP9600_THERMOCOUPLE_TYPE_R, 1200.0, 1664.5, -0.0005, 0.001, 0.0001},
+        {MCP9600_THERMOCOUPLE_TYPE_R, 1664.5, 1768.1, -0.001, 0.002, 0.001},
+    };
+    int32_t raw[4];
+    float hot[4];
+    float ref;
+    uint32_t i;
+    uint32_t k;
+    double c;
+    double uv;
+    double uv2;
+    double t;
+    
+    for (i = 0; i < sizeof(point) / sizeof(point[0]); i++)
+    {
+        if ((mcp9600_linearization_emf((mcp9600_thermocouple_type_t)point[i].type, point[i].c, &uv) != 0) ||
+            (fabs(uv - point[i].mv * 1000.0) > 0.5))
+        {
+            printf("mcp9600: linearization type %d at %0.1fC differs from the nist table.\n", point[i].type, point[i].c);
+            
+            return 1;
+        }
+    }
+    for (i = 0; i < sizeof(boundary) / sizeof(boundary[0]); i++)
+    {
+        /* both sides of the boundary must meet inside 1 nV */
+        if ((mcp9600_linearization_emf((mcp9600_thermocouple_type_t)boundary[i].type, boundary[i].c, &uv) != 0) ||
+            (mcp9600_linearization_emf((mcp9600_thermocouple_type_t)boundary[i].type, boundary[i].c + 1.0e-9, &uv2) != 0) ||
+            (fabs(uv2 - uv) > 0.001))
+        {
+            printf("mcp9600: linearization type %d steps at %0.3fC.\n", boundary[i].type, boundary[i].c);
+            
+            return 1;
+        }
+    }
+    for (i = 0; i < sizeof(range) / sizeof(range[0]); i++)
+    {
+        /* a shared lower bound belongs to the previous range */
+        k = ((i != 0) && (range[i - 1].type == range[i].type)) ? 1 : 0;
+        for (c = range[i].min + (double)k * 0.01; c <= range[i].max + 1.0e-9; c = range[i].min + (double)(++k) * 0.01)
+        {
+            if ((mcp9600_linearization_emf((mcp9600_thermocouple_type_t)range[i].type, c, &uv) != 0) ||
+                (mcp9600_linearization_temperature((mcp9600_thermocouple_type_t)range[i].type, uv, &t) != 0) ||
+                (t - c < range[i].lo - range[i].unit / 2.0) || (t - c > range[i].hi + range[i].unit / 2.0))
+            {
+                printf("mcp9600: linearization type %d round trip at %0.2fC is out of the nist error.\n", range[i].type, c);
+                
+                return 1;
+            }
+        }
+    }
+    
+    /* the inputs out of the nist range must be rejected */
+    if ((mcp9600_linearization_emf(MCP9600_THERMOCOUPLE_TYPE_K, 1372.1, &uv) == 0) ||
+        (mcp9600_linearization_emf(MCP9600_THERMOCOUPLE_TYPE_B, -0.1, &uv) == 0) ||
+        (mcp9600_linearization_temperature(MCP9600_THERMOCOUPLE_TYPE_K, 54900.0, &t) == 0) ||
+        (mcp9600_linearization_emf((mcp9600_thermocouple_type_t)8, 25.0, &uv) == 0))
+    {
+        printf("mcp9600: linearization accepted an input out of range.\n");
+        
+        return 1;
+    }
+    
+    /* 2 uV per lsb at 18 bit, the last two samples run off both ends of type k */
+    raw[0] = 0;
+    raw[1] = 160;
+    raw[2] = 27500;
+    raw[3] = -4000;
+    if (mcp9600_linearization_convert_batch(MCP9600_THERMOCOUPLE_TYPE_K, MCP9600_ADC_RESOLUTION_18_BIT, 
+                                            raw, 4, 25.0f, hot) != 1)
+    {
+        printf("mcp9600: linearization batch missed the out of range samples.\n");
+        
+        return 1;
+    }
+    for (i = 0; i < 2; i++)
+    {
+        if ((mcp9600_linearization_convert(MCP9600_THERMOCOUPLE_TYPE_K, (double)raw[i] * 2.0, 25.0f, &ref) != 0) ||
+            (hot[i] != ref))
+        {
+            printf("mcp9600: linearization batch differs from the single convert.\n");
+            
+            return 1;
+        }
+    }
+    if ((isnan(hot[2]) == 0) || (isnan(hot[3]) == 0))
+    {
+        printf("mcp9600: linearization batch converted an out of range sample.\n");
+        
+        return 1;
+    }
+    if ((mcp9600_linearization_convert_batch(MCP9600_THERMOCOUPLE_TYPE_K, MCP9600_ADC_RESOLUTION_12_BIT, 
+                                             raw, 2, 25.0f, hot) != 0) ||
+        (mcp9600_linearization_convert_batch(MCP9600_THERMOCOUPLE_TYPE_K, MCP9600_ADC_RESOLUTION_18_BIT, 
+                                             raw, 2, 1400.0f, hot) != 1) ||
+        (mcp9600_linearization_convert_batch(MCP9600_THERMOCOUPLE_TYPE_K, MCP9600_ADC_RESOLUTION_18_BIT, 
+                                             NULL, 2, 25.0f, hot) != 1))
+    {
+        printf("mcp9600: linearization batch return code is wrong.\n");
+        
+        return 1;
+    }
+    printf("mcp9600: linearization matches the nist tables.\n");
+    
+    return 0;
+}
+
+#if (MCP9600_STATIC_BINDING == 0)
+/**
+ * @brief lock check var definition
+ */
+static uint32_t gs_lock_count;             /**< bus_lock calls */
+static uint32_t gs_unlock_count;           /**< bus_unlock calls */
+static uint32_t gs_unlocked_transfer;      /**< transfers outside the lock */
+static uint8_t gs_lock_held;               /**< lock held flag */
+
+/**
+ * @brief     count a bus lock
+ * @param[in] *user pointer to the user context
+ * @note      a nested lock is counted as an error
+ */
+static void a_lock(void *user)
+{
+    (void)user;
+    if (gs_lock_held != 0)
+    {
+        gs_unlocked_transfer++;
+    }
+    gs_lock_held = 1;
+    gs_lock_count++;
+}
+
+/**
+ * @brief     count a bus unlock
+ * @param[in] *user pointer to the user context
+ * @note      none
+ */
+static void a_unlock(void *user)
+{
+    (void)user;
+    gs_lock_held = 0;
+    gs_unlock_count++;
+}
+
+/**
+ * @brief     write the emulated chip and check the lock
+ * @param[in] *user pointer to the emulated chip
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code of the emulated write
+ * @note      none
+ */
+static uint8_t a_lock_write_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    if (gs_lock_held == 0)
+    {
+        gs_unlocked_transfer++;
+    }
+    
+    return mcp9600_emulator_iic_write_cmd(user, addr, buf, len);
+}
+
+/**
+ * @brief      read the emulated chip and check the lock
+ * @param[in]  *user pointer to the emulated chip
+ * @param[in]  addr iic device read address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code of the emulated read
+ * @note       none
+ */
+static uint8_t a_lock_read_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    if (gs_lock_held == 0)
+    {
+        gs_unlocked_transfer++;
+    }
+    
+    return mcp9600_emulator_iic_read_cmd(user, addr, buf, len);
+}
+
+/**
+ * @brief  check the bus lock scopes
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   every transfer must be locked, a read-modify-write setter must take the lock once
+ *         and the burst wait must not hold it
+ */
+static uint8_t a_lock_check(void)
+{
+    uint8_t res;
+    uint32_t count;
+    int16_t hot_raw;
+    int16_t delta_raw;
+    int16_t cold_raw;
+    int32_t hot_mc;
+    int32_t delta_mc;
+    int32_t cold_mc;
+    mcp9600_handle_t handle;
+    
+    DRIVER_MCP9600_LINK_INIT(&handle, mcp9600_handle_t);
+    DRIVER_MCP9600_LINK_IIC_INIT_CTX(&handle, mcp9600_emulator_iic_init);
+    DRIVER_MCP9600_LINK_IIC_DEINIT_CTX(&handle, mcp9600_emulator_iic_deinit);
+    DRIVER_MCP9600_LINK_IIC_READ_COMMAND_CTX(&handle, a_lock_read_cmd);
+    DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND_CTX(&handle, a_lock_write_cmd);
+    DRIVER_MCP9600_LINK_IIC_DELAY_MS_CTX(&handle, mcp9600_emulator_delay_ms);
+    DRIVER_MCP9600_LINK_DEBUG_PRINT(&handle, mcp9600_interface_debug_print);
+    DRIVER_MCP9600_LINK_BUS_LOCK(&handle, a_lock);
+    DRIVER_MCP9600_LINK_BUS_UNLOCK(&handle, a_unlock);
+    DRIVER_MCP9600_LINK_USER(&handle, &g_emulator);
+    (void)mcp9600_emulator_init(&g_emulator, MCP9600_ADDRESS_0);
+    res = mcp9600_set_addr_pin(&handle, MCP9600_ADDRESS_0);
+    res |= mcp9600_init(&handle);
+    count = gs_lock_count;
+    res |= mcp9600_set_thermocouple_type(&handle, MCP9600_THERMOCOUPLE_TYPE_J);
+    if ((res == 0) && (gs_lock_count != count + 1))
+    {
+        printf("mcp9600: setter took the lock %d times.\n", (int)(gs_lock_count - count));
+        
+        res = 1;
+    }
+    res |= mcp9600_single_read_fixed(&handle, &hot_raw, &hot_mc, &delta_raw, &delta_mc, &cold_raw, &cold_mc);
+    res |= mcp9600_deinit(&handle);
+    if ((res != 0) || (gs_unlocked_transfer != 0) || (gs_lock_count != gs_unlock_count) ||
+        (gs_lock_held != 0) || (handle.lock_depth != 0))
+    {
+        printf("mcp9600: bus lock check failed.\n");
+        
+        return 1;
+    }
+    printf("mcp9600: bus lock check passed with %d locks.\n", (int)gs_lock_count);
+    
+    return 0;
+}
+#endif
+
+#if (MCP9600_STATIC_BINDING == 0)
+/**
+ * @brief batch fallback check var definition
+ */
+static uint32_t gs_batch_refused;        /**< refused batch transfers */
+
+/**
+ * @brief      refuse every batch transfer like an adapter that only takes a read as the last message
+ * @param[in]  *user pointer to the emulated chip
+ * @param[in]  addr iic device write address
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_batch_refuse_read_batch(void *user, uint8_t addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    (void)user;
+    (void)addr;
+    (void)reg;
+    (void)len;
+    (void)num;
+    (void)buf;
+    gs_batch_refused++;
+    
+    return 1;
+}
+
+/**
+ * @brief  check a refused batch transfer falls back to the one by one reads
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   none
+ */
+static uint8_t a_batch_fallback_check(void)
+{
+    uint8_t res;
+    uint8_t status;
+    int16_t hot_raw;
+    int16_t delta_raw;
+    int16_t cold_raw;
+    int16_t raw;
+    int32_t mc;
+    mcp9600_emulator_t emulator;
+    mcp9600_handle_t handle;
+    
+    DRIVER_MCP9600_LINK_INIT(&handle, mcp9600_handle_t);
+    DRIVER_MCP9600_LINK_IIC_INIT_CTX(&handle, mcp9600_emulator_iic_init);
+    DRIVER_MCP9600_LINK_IIC_DEINIT_CTX(&handle, mcp9600_emulator_iic_deinit);
+    DRIVER_MCP9600_LINK_IIC_READ_COMMAND_CTX(&handle, mcp9600_emulator_iic_read_cmd);
+    DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND_CTX(&handle, mcp9600_emulator_iic_write_cmd);
+    DRIVER_MCP9600_LINK_IIC_READ_BATCH_CTX(&handle, a_batch_refuse_read_batch);
+    DRIVER_MCP9600_LINK_IIC_DELAY_MS_CTX(&handle, mcp9600_emulator_delay_ms);
+    DRIVER_MCP9600_LINK_DEBUG_PRINT(&handle, mcp9600_interface_debug_print);
+    DRIVER_MCP9600_LINK_USER(&handle, &emulator);
+    (void)mcp9600_emulator_init(&emulator, MCP9600_ADDRESS_0);
+    (void)mcp9600_emulator_set_temperature(&emulator, 150.0f, 25.0f);
+    res = mcp9600_set_addr_pin(&handle, MCP9600_ADDRESS_0);
+    res |= mcp9600_init(&handle);
+    (void)mcp9600_emulator_advance(&emulator, 1000);
+    res |= mcp9600_fast_read_raw(&handle, &hot_raw, &delta_raw, &cold_raw, &status);
+    res |= mcp9600_get_hot_junction_temperature_fixed(&handle, &raw, &mc);
+    (void)mcp9600_deinit(&handle);
+    if ((res != 0) || (gs_batch_refused == 0) || (hot_raw != raw))
+    {
+        printf("mcp9600: refused batch transfer did not fall back.\n");
+        
+        return 1;
+    }
+    printf("mcp9600: refused batch transfer fell back to one by one reads.\n");
+    
+    return 0;
+}
+#endif
+
+#if (MCP9600_STATIC_BINDING == 0) && (MCP9600_STATS != 0)
+/**
+ * @brief  check the latency with a context timestamp
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   only the context timestamp is linked, it follows the clock of its own emulated chip
+ */
+static uint8_t a_latency_check(void)
+{
+    uint8_t res;
+    uint32_t us;
+    uint64_t start;
+    int16_t hot_raw;
+    int16_t delta_raw;
+    int16_t cold_raw;
+    int32_t hot_mc;
+    int32_t delta_mc;
+    int32_t cold_mc;
+    mcp9600_latency_t latency;
+    mcp9600_emulator_t emulator;
+    mcp9600_handle_t handle;
+    
+    DRIVER_MCP9600_LINK_INIT(&handle, mcp9600_handle_t);
+    DRIVER_MCP9600_LINK_IIC_INIT_CTX(&handle, mcp9600_emulator_iic_init);
+    DRIVER_MCP9600_LINK_IIC_DEINIT_CTX(&handle, mcp9600_emulator_iic_deinit);
+    DRIVER_MCP9600_LINK_IIC_READ_COMMAND_CTX(&handle, mcp9600_emulator_iic_read_cmd);
+    DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND_CTX(&handle, mcp9600_emulator_iic_write_cmd);
+    DRIVER_MCP9600_LINK_IIC_DELAY_MS_CTX(&handle, mcp9600_emulator_delay_ms);
+    DRIVER_MCP9600_LINK_DEBUG_PRINT(&handle, mcp9600_interface_debug_print);
+    DRIVER_MCP9600_LINK_TIMESTAMP_CTX(&handle, mcp9600_interface_timestamp_ctx);
+    DRIVER_MCP9600_LINK_USER(&handle, &emulator);
+    (void)mcp9600_emulator_init(&emulator, MCP9600_ADDRESS_0);
+    (void)mcp9600_emulator_advance(&emulator, 1000);
+    res = mcp9600_set_addr_pin(&handle, MCP9600_ADDRESS_0);
+    res |= mcp9600_init(&handle);
+    res |= mcp9600_set_mode(&handle, MCP9600_MODE_SHUTDOWN);
+    start = mcp9600_interface_timestamp_ctx(&emulator);
+    res |= mcp9600_single_read_fixed(&handle, &hot_raw, &hot_mc, &delta_raw, &delta_mc, &cold_raw, &cold_mc);
+    res |= mcp9600_latency_record(&handle, start, &us);
+    res |= mcp9600_latency_get(&handle, &latency);
+    res |= mcp9600_deinit(&handle);
+    if ((res != 0) || (us == 0) || (latency.count != 1) || (latency.max_us != us) ||
+        ((uint64_t)us != (mcp9600_interface_timestamp_ctx(&emulator) - start) / 1000))
+    {
+        printf("mcp9600: latency check failed.\n");
+        
+        return 1;
+    }
+    printf("mcp9600: latency check passed with %d us.\n", (int)us);
+    
+    return 0;
+}
+#endif
+
+#if (MCP9600_STATIC_BINDING == 0)
+static mcp9600_emulator_t gs_bus_emulator[4];        /**< emulated chips on one bus */
+static uint32_t gs_bus_transfer;                     /**< bus transfers */
+
+/**
+ * @brief     advance all the chips on the emulated bus
+ * @param[in] ms time in ms
+ * @note      none
+ */
+static void a_bus_delay_ms(uint32_t ms)
+{
+    uint8_t i;
+    
+    for (i = 0; i < 4; i++)
+    {
+        (void)mcp9600_emulator_advance(&gs_bus_emulator[i], ms);
+    }
+}
+
+/**
+ * @brief      counted emulated bus read command
+ * @param[in]  *user pointer to an mcp9600 emulator structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_bus_read_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    gs_bus_transfer++;
+    
+    return mcp9600_emulator_iic_read_cmd(user, addr, buf, len);
+}
+
+/**
+ * @brief     counted emulated bus write command
+ * @param[in] *user pointer to an mcp9600 emulator structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of the data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_bus_write_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    gs_bus_transfer++;
+    
+    return mcp9600_emulator_iic_write_cmd(user, addr, buf, len);
+}
+
+/**
+ * @brief      counted emulated bus read of several devices in one transfer
+ * @param[in]  *user pointer to the emulated chip list of the bus
+ * @param[in]  *addr pointer to an iic device write address list
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it is counted as one transfer
+ */
+static uint8_t a_bus_read_multi_ctx(void *user, uint8_t *addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    uint8_t i;
+    uint8_t j;
+    mcp9600_emulator_t *emulator = (mcp9600_emulator_t *)user;
+    
+    gs_bus_transfer++;
+    for (i = 0; i < num; i++)
+    {
+        for (j = 0; (j < 4) && (emulator[j].addr != addr[i]); j++)
+        {
+        }
+        if ((j == 4) || (mcp9600_emulator_iic_write_cmd(&emulator[j], addr[i], &reg[i], 1) != 0) ||
+            (mcp9600_emulator_iic_read_cmd(&emulator[j], addr[i], buf, len[i]) != 0))
+        {
+            return 1;
+        }
+        buf += len[i];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      refuse every multi device transfer
+ * @param[in]  *user pointer to the emulated chip list
+ * @param[in]  *addr pointer to an iic device write address list
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_bus_refuse_read_multi_ctx(void *user, uint8_t *addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    (void)user;
+    (void)addr;
+    (void)reg;
+    (void)len;
+    (void)num;
+    (void)buf;
+    gs_bus_transfer++;
+    
+    return 1;
+}
+
+/**
+ * @brief      open four chips with different conversion times on one emulated bus
+ * @param[out] *handle pointer to a handle list
+ * @return     status code
+ *             - 0 success
+ *             - 1 open failed
+ * @note       device i runs at the adc resolution i, so it converts 4^i times faster than device 0
+ */
+static uint8_t a_bus_open(mcp9600_handle_t *handle)
+{
+    uint8_t i;
+    uint8_t res;
+    
+    res = 0;
+    for (i = 0; i < 4; i++)
+    {
+        (void)mcp9600_emulator_init(&gs_bus_emulator[i], (mcp9600_address_t)(MCP9600_ADDRESS_0 + i * 2));
+        (void)mcp9600_emulator_set_temperature(&gs_bus_emulator[i], 100.0f + (float)(i * 50), 25.0f);
+        DRIVER_MCP9600_LINK_INIT(&handle[i], mcp9600_handle_t);
+        DRIVER_MCP9600_LINK_IIC_INIT_CTX(&handle[i], mcp9600_emulator_iic_init);
+        DRIVER_MCP9600_LINK_IIC_DEINIT_CTX(&handle[i], mcp9600_emulator_iic_deinit);
+        DRIVER_MCP9600_LINK_IIC_READ_COMMAND_CTX(&handle[i], a_bus_read_cmd);
+        DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND_CTX(&handle[i], a_bus_write_cmd);
+        DRIVER_MCP9600_LINK_IIC_DELAY_MS_CTX(&handle[i], mcp9600_emulator_delay_ms);
+        DRIVER_MCP9600_LINK_DEBUG_PRINT(&handle[i], mcp9600_interface_debug_print);
+        DRIVER_MCP9600_LINK_USER(&handle[i], &gs_bus_emulator[i]);
+        res |= mcp9600_set_addr_pin(&handle[i], (mcp9600_address_t)(MCP9600_ADDRESS_0 + i * 2));
+        res |= mcp9600_init(&handle[i]);
+        res |= mcp9600_set_adc_resolution(&handle[i], (mcp9600_adc_resolution_t)i);
+        res |= mcp9600_set_mode(&handle[i], MCP9600_MODE_SHUTDOWN);
+    }
+    
+    return res;
+}
+
+/**
+ * @brief  check the staggered start and collect of the bus manager
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   the samples must come back in completion order after about the longest conversion
+ */
+static uint8_t a_bus_check(void)
+{
+    uint8_t i;
+    uint8_t res;
+    uint8_t num;
+    uint32_t start;
+    uint32_t longest;
+    mcp9600_handle_t handle[4];
+    mcp9600_handle_t *list[4];
+    mcp9600_bus_t bus;
+    mcp9600_bus_sample_t sample[4];
+    
+    res = a_bus_open(handle);
+    for (i = 0; i < 4; i++)
+    {
+        list[i] = &handle[i];
+    }
+    DRIVER_MCP9600_BUS_LINK_INIT(&bus, mcp9600_bus_t);
+    DRIVER_MCP9600_BUS_LINK_DELAY_MS(&bus, a_bus_delay_ms);
+    DRIVER_MCP9600_BUS_LINK_DEBUG_PRINT(&bus, mcp9600_interface_debug_print);
+    res |= mcp9600_bus_init(&bus, list, 4);
+    start = gs_bus_emulator[0].now;
+    res |= mcp9600_bus_read(&bus, sample, &num);
+    longest = bus.ms[0];
+    if ((res != 0) || (num != 4))
+    {
+        printf("mcp9600: bus read failed.\n");
+        res = 1;
+    }
+    for (i = 0; (res == 0) && (i < 4); i++)
+    {
+        /* the fastest device is collected first */
+        if ((sample[i].index != 3 - i) || (sample[i].status != MCP9600_BUS_SAMPLE_OK) ||
+            (sample[i].hot_raw != (int16_t)((100 + sample[i].index * 50) * 16)))
+        {
+            printf("mcp9600: bus sample %d is wrong.\n", i);
+            res = 1;
+        }
+    }
+    if ((res == 0) && ((bus.ms[3] >= bus.ms[2]) || (bus.ms[2] >= bus.ms[1]) || (bus.ms[1] >= longest) ||
+        (gs_bus_emulator[0].now - start < longest) || (gs_bus_emulator[0].now - start > longest + 10)))
+    {
+        printf("mcp9600: bus collect took %d ms for a %d ms conversion.\n", 
+               (int)(gs_bus_emulator[0].now - start), (int)longest);
+        res = 1;
+    }
+    res |= mcp9600_bus_deinit(&bus);
+    for (i = 0; i < 4; i++)
+    {
+        res |= mcp9600_deinit(&handle[i]);
+    }
+    if (res == 0)
+    {
+        printf("mcp9600: bus check passed in %d ms.\n", (int)(gs_bus_emulator[0].now - start));
+    }
+    
+    return res;
+}
+
+/**
+ * @brief  check the batched fast read of the bus manager
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   iic_read_multi must give the one by one data in fewer transfers, the configuration
+ *         for the cold junction resolution is part of the same transfer
+ */
+static uint8_t a_bus_multi_check(void)
+{
+    uint8_t i;
+    uint8_t res;
+    uint32_t single;
+    uint32_t multi;
+    mcp9600_handle_t handle[4];
+    mcp9600_handle_t *list[4];
+    mcp9600_bus_t bus;
+    static mcp9600_bus_data_t ref;
+    static mcp9600_bus_data_t data;
+    
+    res = a_bus_open(handle);
+    for (i = 0; i < 4; i++)
+    {
+        list[i] = &handle[i];
+        res |= mcp9600_set_mode(&handle[i], MCP9600_MODE_NORMAL);
+    }
+    res |= mcp9600_set_cold_junction_resolution(&handle[1], MCP9600_COLD_JUNCTION_RESOLUTION_0P25);
+    a_bus_delay_ms(1000);
+    DRIVER_MCP9600_BUS_LINK_INIT(&bus, mcp9600_bus_t);
+    DRIVER_MCP9600_BUS_LINK_DELAY_MS(&bus, a_bus_delay_ms);
+    DRIVER_MCP9600_BUS_LINK_DEBUG_PRINT(&bus, mcp9600_interface_debug_print);
+    res |= mcp9600_bus_init(&bus, list, 4);
+    gs_bus_transfer = 0;
+    res |= mcp9600_bus_fast_read(&bus, MCP9600_BUS_FAST_READ_ALL, &ref);
+    single = gs_bus_transfer;
+    DRIVER_MCP9600_BUS_LINK_IIC_READ_MULTI_CTX(&bus, a_bus_read_multi_ctx);
+    DRIVER_MCP9600_BUS_LINK_USER(&bus, gs_bus_emulator);
+    gs_bus_transfer = 0;
+    res |= mcp9600_bus_fast_read(&bus, MCP9600_BUS_FAST_READ_ALL, &data);
+    multi = gs_bus_transfer;
+    for (i = 0; (res == 0) && (i < 4); i++)
+    {
+        if ((data.status[i] != MCP9600_BUS_SAMPLE_OK) || (data.hot_raw[i] != ref.hot_raw[i]) ||
+            (data.delta_raw[i] != ref.delta_raw[i]) || (data.cold_raw[i] != ref.cold_raw[i]) ||
+            (data.hot_s[i] != ref.hot_s[i]) || (data.delta_s[i] != ref.delta_s[i]) || (data.cold_s[i] != ref.cold_s[i]))
+        {
+            printf("mcp9600: bus multi read device %d differs.\n", i);
+            res = 1;
+        }
+    }
+    if ((res == 0) && (multi >= single))
+    {
+        printf("mcp9600: bus multi read took %d transfers, one by one took %d.\n", (int)multi, (int)single);
+        res = 1;
+    }
+    
+    /* a refused transfer falls back to the one by one reads */
+    DRIVER_MCP9600_BUS_LINK_IIC_READ_MULTI_CTX(&bus, a_bus_refuse_read_multi_ctx);
+    res |= mcp9600_bus_fast_read(&bus, MCP9600_BUS_FAST_READ_ALL, &data);
+    for (i = 0; (res == 0) && (i < 4); i++)
+    {
+        if ((data.status[i] != MCP9600_BUS_SAMPLE_OK) || (data.hot_raw[i] != ref.hot_raw[i]) ||
+            (data.cold_s[i] != ref.cold_s[i]))
+        {
+            printf("mcp9600: bus multi read fallback device %d differs.\n", i);
+            res = 1;
+        }
+    }
+    res |= mcp9600_bus_deinit(&bus);
+    for (i = 0; i < 4; i++)
+    {
+        res |= mcp9600_deinit(&handle[i]);
+    }
+    
+    /* the plain interface function reads the global emulated chip */
+    (void)mcp9600_emulator_init(&g_emulator, MCP9600_ADDRESS_0);
+    (void)mcp9600_emulator_set_temperature(&g_emulator, 42.0f, 25.0f);
+    DRIVER_MCP9600_LINK_INIT(&handle[0], mcp9600_handle_t);
+    DRIVER_MCP9600_LINK_IIC_INIT(&handle[0], mcp9600_interface_iic_init);
+    DRIVER_MCP9600_LINK_IIC_DEINIT(&handle[0], mcp9600_interface_iic_deinit);
+    DRIVER_MCP9600_LINK_IIC_READ_COMMAND(&handle[0], mcp9600_interface_iic_read_cmd);
+    DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND(&handle[0], mcp9600_interface_iic_write_cmd);
+    DRIVER_MCP9600_LINK_IIC_DELAY_MS(&handle[0], mcp9600_interface_delay_ms);
+    DRIVER_MCP9600_LINK_DEBUG_PRINT(&handle[0], mcp9600_interface_debug_print);
+    res |= mcp9600_set_addr_pin(&handle[0], MCP9600_ADDRESS_0);
+    res |= mcp9600_init(&handle[0]);
+    mcp9600_interface_delay_ms(1000);
+    DRIVER_MCP9600_BUS_LINK_INIT(&bus, mcp9600_bus_t);
+    DRIVER_MCP9600_BUS_LINK_IIC_READ_MULTI(&bus, mcp9600_interface_iic_read_multi);
+    DRIVER_MCP9600_BUS_LINK_DELAY_MS(&bus, mcp9600_interface_delay_ms);
+    DRIVER_MCP9600_BUS_LINK_DEBUG_PRINT(&bus, mcp9600_interface_debug_print);
+    res |= mcp9600_bus_init(&bus, list, 1);
+    res |= mcp9600_bus_fast_read(&bus, MCP9600_BUS_FAST_READ_ALL, &data);
+    if ((res == 0) && ((data.hot_raw[0] != 42 * 16) || (data.cold_raw[0] != 25 * 16)))
+    {
+        printf("mcp9600: bus multi read of the interface function differs.\n");
+        res = 1;
+    }
+    res |= mcp9600_bus_deinit(&bus);
+    res |= mcp9600_deinit(&handle[0]);
+    if (res == 0)
+    {
+        printf("mcp9600: bus multi check passed with %d transfers instead of %d.\n", (int)multi, (int)single);
+    }
+    
+    return res;
+}
+
+/**
+ * @brief  check the fleet against the single device api
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   every device has its own emulated chip as the bus context
+ */
+static uint8_t a_fleet_check(void)
+{
+    static mcp9600_emulator_t emulator[16];
+    static mcp9600_fleet_t fleet;
+    uint8_t res;
+    uint8_t status;
+    uint16_t i;
+    uint16_t index;
+    uint16_t failed;
+    uint16_t num;
+    int16_t hot_raw;
+    int16_t delta_raw;
+    int16_t cold_raw;
+    int32_t hot_mc[16];
+    int32_t delta_mc[16];
+    int32_t cold_mc[16];
+    int32_t filter_mc[16];
+    int32_t mc[3];
+    float hot_s[16];
+    float delta_s[16];
+    float cold_s[16];
+    float s[3];
+    mcp9600_handle_t *handle;
+    
+    DRIVER_MCP9600_FLEET_LINK_INIT(&fleet, mcp9600_fleet_t);
+    DRIVER_MCP9600_LINK_IIC_INIT_CTX(&fleet.handle, mcp9600_emulator_iic_init);
+    DRIVER_MCP9600_LINK_IIC_DEINIT_CTX(&fleet.handle, mcp9600_emulator_iic_deinit);
+    DRIVER_MCP9600_LINK_IIC_READ_COMMAND_CTX(&fleet.handle, mcp9600_emulator_iic_read_cmd);
+    DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND_CTX(&fleet.handle, mcp9600_emulator_iic_write_cmd);
+    DRIVER_MCP9600_LINK_IIC_DELAY_MS_CTX(&fleet.handle, mcp9600_emulator_delay_ms);
+    DRIVER_MCP9600_LINK_DEBUG_PRINT(&fleet.handle, mcp9600_interface_debug_print);
+    res = mcp9600_fleet_init(&fleet);
+    for (i = 0; (res == 0) && (i < 16); i++)
+    {
+        (void)mcp9600_emulator_init(&emulator[i], MCP9600_ADDRESS_0);
+        (void)mcp9600_emulator_set_temperature(&emulator[i], 10.0f + (float)(i * 5), 25.1f);
+        res = mcp9600_fleet_add(&fleet, MCP9600_ADDRESS_0, &emulator[i], &index);
+        (void)mcp9600_emulator_advance(&emulator[i], 1000);
+    }
+    res |= mcp9600_fleet_select(&fleet, 3, &handle);
+    res |= mcp9600_set_cold_junction_resolution(handle, MCP9600_COLD_JUNCTION_RESOLUTION_0P25);
+    res |= mcp9600_fleet_read(&fleet, &failed);
+    res |= mcp9600_fleet_get_temperature_fixed(&fleet, hot_mc, delta_mc, cold_mc);
+    res |= mcp9600_fleet_get_temperature(&fleet, hot_s, delta_s, cold_s);
+    res |= mcp9600_fleet_filter(&fleet, 0, filter_mc);
+    for (i = 0; (res == 0) && (i < 16); i++)
+    {
+        res = mcp9600_fleet_select(&fleet, i, &handle);
+        res |= mcp9600_fast_read_fixed(handle, &hot_raw, &mc[0], &delta_raw, &mc[1], &cold_raw, &mc[2], &status);
+        res |= mcp9600_fast_read(handle, &hot_raw, &s[0], &delta_raw, &s[1], &cold_raw, &s[2], &status);
+        if ((res != 0) || (mc[0] != hot_mc[i]) || (mc[1] != delta_mc[i]) || (mc[2] != cold_mc[i]) ||
+            (s[0] != hot_s[i]) || (s[1] != delta_s[i]) || (s[2] != cold_s[i]) || (filter_mc[i] != hot_mc[i]))
+        {
+            printf("mcp9600: fleet device %d differs from the single device api.\n", i);
+            res = 1;
+        }
+    }
+    res |= mcp9600_fleet_set_limit(&fleet, 0, 0, 100000);
+    res |= mcp9600_fleet_set_limit(&fleet, 1, 40000, 100000);
+    res |= mcp9600_fleet_set_limit(&fleet, 15, 0, 60000);
+    res |= mcp9600_fleet_alarm(&fleet, MCP9600_BOOL_TRUE, &num);
+    if ((res != 0) || (num != 2) || (fleet.alarm[1] != MCP9600_FLEET_ALARM_LOW) ||
+        (fleet.alarm[15] != MCP9600_FLEET_ALARM_HIGH) || (cold_mc[3] % 250 != 0) || (cold_mc[0] % 250 == 0))
+    {
+        printf("mcp9600: fleet check failed.\n");
+        res = 1;
+    }
+    res |= mcp9600_fleet_deinit(&fleet);
+    if (res == 0)
+    {
+        printf("mcp9600: fleet check passed with %d devices.\n", 16);
+    }
+    
+    return res;
+}
+#endif
+
+/**
+ * @brief  check the acquisition engine on four emulated buses
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   the merged stream must be time ordered and every bus must deliver
+ */
+static uint8_t a_engine_check(void)
+{
+    static mcp9600_emulator_t emulator[4];
+    static engine_t engine;
+    uint8_t i;
+    uint8_t index;
+    uint8_t res;
+    uint16_t n;
+    uint16_t count[4];
+    uint64_t last;
+    ring_event_t event;
+    engine_stats_t stats;
+    
+    res = engine_init(&engine, 1);
+    for (i = 0; (res == 0) && (i < 4); i++)
+    {
+        engine_transport_t transport =
+        {
+            &emulator[i],
+            mcp9600_emulator_iic_init,
+            mcp9600_emulator_iic_deinit,
+            mcp9600_emulator_iic_write_cmd,
+            mcp9600_emulator_iic_read_cmd,
+            NULL,
+            NULL,
+            mcp9600_emulator_delay_ms,
+        };
+        
+        (void)mcp9600_emulator_init(&emulator[i], MCP9600_ADDRESS_0);
+        (void)mcp9600_emulator_set_temperature(&emulator[i], 20.0f + (float)(i * 10), 25.0f);
+        res = engine_add_bus(&engine, &transport, &index);
+        res |= engine_add_device(&engine, index, MCP9600_ADDRESS_0, MCP9600_THERMOCOUPLE_TYPE_K);
+    }
+    res |= engine_start(&engine);
+    memset(count, 0, sizeof(count));
+    last = 0;
+    for (n = 0; (res == 0) && (n < 400); n++)
+    {
+        if (engine_read(&engine, &event, 1000) != 0)
+        {
+            printf("mcp9600: engine read timeout.\n");
+            res = 1;
+        }
+        else if ((event.timestamp < last) || ((event.source / ENGINE_DEVICE_MAX) >= 4))
+        {
+            printf("mcp9600: engine stream is out of order.\n");
+            res = 1;
+        }
+        else
+        {
+            last = event.timestamp;
+            count[event.source / ENGINE_DEVICE_MAX]++;
+        }
+    }
+    (void)engine_deinit(&engine);
+    for (i = 0; (res == 0) && (i < 4); i++)
+    {
+        (void)engine_get_stats(&engine, i, &stats);
+        if (count[i] == 0)
+        {
+            printf("mcp9600: engine bus %d delivered nothing.\n", i);
+            res = 1;
+        }
+        else
+        {
+            printf("mcp9600: engine bus %d %d events %d samples %0.3f%% busy.\n", i, count[i], stats.samples, stats.utilization);
+        }
+    }
+    
+    return res;
+}
+
+#if (MCP9600_STATIC_BINDING == 0)
+/**
+ * @brief engine nack check var definition
+ */
+static volatile uint8_t gs_engine_nack;        /**< nack flag */
+
+/**
+ * @brief      read the emulated chip or nack when the flag is set
+ * @param[in]  *user pointer to the emulated chip
+ * @param[in]  addr iic device read address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       a nack on a real bus costs about one transfer, so it waits 1 ms
+ */
+static uint8_t a_engine_nack_read_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    if (gs_engine_nack != 0)
+    {
+        (void)usleep(1000);
+        
+        return 1;
+    }
+    
+    return mcp9600_emulator_iic_read_cmd(user, addr, buf, len);
+}
+
+/**
+ * @brief      write the emulated chip or nack when the flag is set
+ * @param[in]  *user pointer to the emulated chip
+ * @param[in]  addr iic device write address
+ * @param[in]  *buf pointer to a data buffer
+ * @param[in]  len length of the data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 write failed
+ * @note       none
+ */
+static uint8_t a_engine_nack_write_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    if (gs_engine_nack != 0)
+    {
+        (void)usleep(1000);
+        
+        return 1;
+    }
+    
+    return mcp9600_emulator_iic_write_cmd(user, addr, buf, len);
+}
+
+/**
+ * @brief  check the back to back engine with one bus that always nacks
+ * @return status code
+ *         - 0 success
+ *         - 1 check failed
+ * @note   the failing bus never pushes an event, its progress must still let the merger pass
+ *         within one nack
+ */
+static uint8_t a_engine_nack_check(void)
+{
+    static mcp9600_emulator_t emulator[2];
+    static engine_t engine;
+    uint8_t i;
+    uint8_t index;
+    uint8_t res;
+    uint32_t n;
+    uint64_t last;
+    uint64_t start;
+    uint64_t begin;
+    ring_event_t event;
+    engine_stats_t stats;
+    
+    gs_engine_nack = 0;
+    res = engine_init(&engine, 0);
+    for (i = 0; (res == 0) && (i < 2); i++)
+    {
+        engine_transport_t transport =
+        {
+            &emulator[i],
+            mcp9600_emulator_iic_init,
+            mcp9600_emulator_iic_deinit,
+            (i == 0) ? mcp9600_emulator_iic_write_cmd : a_engine_nack_write_cmd,
+            (i == 0) ? mcp9600_emulator_iic_read_cmd : a_engine_nack_read_cmd,
+            NULL,
+            NULL,
+            mcp9600_emulator_delay_ms,
+        };
+        
+        (void)mcp9600_emulator_init(&emulator[i], MCP9600_ADDRESS_0);
+        (void)mcp9600_emulator_set_temperature(&emulator[i], 50.0f, 25.0f);
+        res = engine_add_bus(&engine, &transport, &index);
+        res |= engine_add_device(&engine, index, MCP9600_ADDRESS_0, MCP9600_THERMOCOUPLE_TYPE_K);
+    }
+    
+    /* the second bus nacks from now on */
+    gs_engine_nack = 1;
+    res |= engine_start(&engine);
+    last = 0;
+    start = ring_timestamp();
+    for (n = 0; (res == 0) && ((ring_timestamp() - start) < 50000000ULL); n++)
+    {
+        begin = ring_timestamp();
+        if (engine_read(&engine, &event, 100) != 0)
+        {
+            printf("mcp9600: engine read timeout behind the nacking bus.\n");
+            res = 1;
+        }
+        else if ((ring_timestamp() - begin) > 20000000ULL)
+        {
+            printf("mcp9600: engine read held back %d ms by the nacking bus.\n", 
+                   (int)((ring_timestamp() - begin) / 1000000ULL));
+            res = 1;
+        }
+        else if (event.timestamp < last)
+        {
+            printf("mcp9600: engine stream is out of order.\n");
+            res = 1;
+        }
+        else if ((event.source / ENGINE_DEVICE_MAX) != 0)
+        {
+            printf("mcp9600: engine nacking bus delivered an event.\n");
+            res = 1;
+        }
+        else
+        {
+            last = event.timestamp;
+        }
+    }
+    (void)engine_deinit(&engine);
+    gs_engine_nack = 0;
+    (void)engine_get_stats(&engine, 1, &stats);
+    if ((res == 0) && (stats.errors == 0))
+    {
+        printf("mcp9600: engine nacking bus reported no error.\n");
+        res = 1;
+    }
+    if (res == 0)
+    {
+        printf("mcp9600: engine nack check passed with %d events and %d errors.\n", (int)n, (int)stats.errors);
+    }
+    
+    return res;
+}
+#endif
+
+/**
+ * @brief  main function
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   it runs the driver tests against the emulated chip
+ */
+int main(void)
+{
+    uint8_t buf;
+    
+    /* power on the emulated chip with a slow hot junction ramp */
+    (void)mcp9600_emulator_init(&g_emulator, MCP9600_ADDRESS_0);
+    (void)mcp9600_emulator_set_temperature(&g_emulator, 25.0f, 25.0f);
+    (void)mcp9600_emulator_set_ramp(&g_emulator, 1.0f);
+    
+    /* run the register test */
+    if (mcp9600_register_test(MCP9600_ADDRESS_0) != 0)
+    {
+        return 1;
+    }
+    
+    /* run the read test */
+    if (mcp9600_read_test(MCP9600_ADDRESS_0, MCP9600_THERMOCOUPLE_TYPE_K, 3) != 0)
+    {
+        return 1;
+    }
+    
+    /* run the interrupt test */
+    if (mcp9600_interrupt_test(MCP9600_ADDRESS_0, MCP9600_THERMOCOUPLE_TYPE_K) != 0)
+    {
+        return 1;
+    }
+    
+    /* record the emulated chip and replay the trace, the static binding build bypasses the trace transport */
+#if (MCP9600_STATIC_BINDING == 0)
+    {
+        int16_t record[8];
+        int16_t replay[8];
+        trace_t trace;
+        trace_transport_t transport =
+        {
+            &g_emulator,
+            mcp9600_emulator_iic_init,
+            mcp9600_emulator_iic_deinit,
+            mcp9600_emulator_iic_write_cmd,
+            mcp9600_emulator_iic_read_cmd,
+            mcp9600_emulator_delay_ms,
+        };
+        
+        if ((trace_record_open(&trace, "mcp9600_emulator.trace", &transport) != 0) ||
+            (a_trace_session(&trace, record, 8) != 0) || (trace_close(&trace) != 0))
+        {
+            return 1;
+        }
+        if ((trace_replay_open(&trace, "mcp9600_emulator.trace", TRACE_PACING_FULL_SPEED) != 0) ||
+            (a_trace_session(&trace, replay, 8) != 0) || (trace_close(&trace) != 0))
+        {
+            return 1;
+        }
+        if ((trace_get_mismatch(&trace) != 0) || (memcmp(record, replay, sizeof(record)) != 0))
+        {
+            printf("mcp9600: trace replay differs from the record.\n");
+            
+            return 1;
+        }
+        (void)remove("mcp9600_emulator.trace");
+    }
+#endif
+    
+    /* the batch convert paths must match the getters */
+    if (a_convert_check() != 0)
+    {
+        return 1;
+    }
+    
+    /* the linearization must follow the nist tables */
+    if (a_linearization_check() != 0)
+    {
+        return 1;
+    }
+    
+    /* every transfer must run inside the bus lock, the static binding build has no linked lock */
+#if (MCP9600_STATIC_BINDING == 0)
+    if (a_lock_check() != 0)
+    {
+        return 1;
+    }
+#endif
+    
+    /* a refused batch transfer must fall back to the one by one reads, the static binding build binds no batch */
+#if (MCP9600_STATIC_BINDING == 0)
+    if (a_batch_fallback_check() != 0)
+    {
+        return 1;
+    }
+#endif
+    
+    /* the latency follows the context timestamp, the static binding build ignores the user context */
+#if (MCP9600_STATIC_BINDING == 0) && (MCP9600_STATS != 0)
+    if (a_latency_check() != 0)
+    {
+        return 1;
+    }
+#endif
+    
+    /* the bus manager collects in completion order, the static binding build ignores the bus context */
+#if (MCP9600_STATIC_BINDING == 0)
+    if (a_bus_check() != 0)
+    {
+        return 1;
+    }
+    if (a_bus_multi_check() != 0)
+    {
+        return 1;
+    }
+#endif
+    
+    /* the fleet must match the single device api, the static binding build ignores the bus context */
+#if (MCP9600_STATIC_BINDING == 0)
+    if (a_fleet_check() != 0)
+    {
+        return 1;
+    }
+#endif
+    
+    /* the engine merges four emulated buses */
+    if (a_engine_check() != 0)
+    {
+        return 1;
+    }
+    
+    /* a nacking bus must not hold back the back to back engine, the static binding build ignores the transport */
+#if (MCP9600_STATIC_BINDING == 0)
+    if (a_engine_nack_check() != 0)
+    {
+        return 1;
+    }
+#endif
+    
+    /* a wrong address must not be acked */
+    (void)mcp9600_emulator_init(&g_emulator, MCP9600_ADDRESS_0);
+    if (mcp9600_emulator_iic_read_cmd(&g_emulator, (uint8_t)MCP9600_ADDRESS_1, &buf, 1) == 0)
+    {
+        printf("mcp9600: emulator acked a wrong address.\n");
+        
+        return 1;
+    }
+    printf("mcp9600: finish emulator test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,311 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      main_coro.cpp
+ * @brief     c++ coroutine emulator main source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9600_coro.hpp"
+#include "driver_mcp9600_emulator.h"
+
+#include <cstdio>
+#include <memory>
+
+/**
+ * @brief emulated bus number definition
+ */
+#define EMULATOR_BUS_NUMBER        8        /**< 8 buses */
+
+/**
+ * @brief burst number of each task definition
+ */
+#define EMULATOR_BURST_NUMBER      3        /**< 3 bursts */
+
+/**
+ * @brief emulated bus structure definition
+ * @note  a stuck bus hides the burst complete flag so the conversion never finishes
+ */
+struct EmulatorBus
+{
+    mcp9600_emulator_t emulator;        /**< emulated chip */
+    uint8_t reg;                        /**< register pointer */
+    bool stuck;                         /**< stuck conversion flag */
+    
+    uint8_t init()
+    {
+        return mcp9600_emulator_iic_init(&emulator);
+    }
+    
+    uint8_t deinit()
+    {
+        return mcp9600_emulator_iic_deinit(&emulator);
+    }
+    
+    uint8_t write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+    {
+        if (len != 0)
+        {
+            reg = buf[0];
+        }
+        
+        return mcp9600_emulator_iic_write_cmd(&emulator, addr, buf, len);
+    }
+    
+    uint8_t read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+    {
+        const uint8_t res = mcp9600_emulator_iic_read_cmd(&emulator, addr, buf, len);
+        
+        if (stuck && (reg == 0x04) && (len != 0))
+        {
+            buf[0] &= 0x7F;
+        }
+        
+        return res;
+    }
+    
+    void delay_ms(uint32_t ms)
+    {
+        mcp9600_emulator_delay_ms(&emulator, ms);
+    }
+};
+
+/**
+ * @brief sensor type definition
+ */
+using Sensor = libdriver::Mcp9600<EmulatorBus, MCP9600_ADDRESS_0, MCP9600_THERMOCOUPLE_TYPE_K,
+                                  MCP9600_ADC_RESOLUTION_14_BIT, MCP9600_BURST_MODE_SAMPLE_4>;
+
+/**
+ * @brief static var definition
+ */
+static EmulatorBus gs_bus[EMULATOR_BUS_NUMBER];        /**< emulated buses */
+static uint64_t gs_now;                                /**< simulated clock in ms */
+static uint32_t gs_ok;                                 /**< good bursts */
+static uint32_t gs_failed;                             /**< failed bursts */
+
+/**
+ * @brief     get the simulated time
+ * @param[in] *user pointer to the user context
+ * @return    time in ms
+ * @note      none
+ */
+static uint64_t a_now(void *user)
+{
+    (void)user;
+    
+    return gs_now;
+}
+
+/**
+ * @brief     advance the simulated time and all the emulated chips
+ * @param[in] *user pointer to the user context
+ * @param[in] ms time
+ * @note      none
+ */
+static void a_sleep(void *user, uint32_t ms)
+{
+    (void)user;
+    gs_now += ms;
+    for (uint32_t i = 0; i < EMULATOR_BUS_NUMBER; i++)
+    {
+        (void)mcp9600_emulator_advance(&gs_bus[i].emulator, ms);
+    }
+}
+
+/**
+ * @brief     read some bursts and check them against the emulated temperature
+ * @param[in] &async reference to an asynchronous sensor
+ * @param[in] hot_mc expected hot junction temperature in mC
+ * @return    task
+ * @note      none
+ */
+static libdriver::Mcp9600Task<> a_burst_task(libdriver::Mcp9600Async<Sensor> &async, int32_t hot_mc)
+{
+    for (uint32_t i = 0; i < EMULATOR_BURST_NUMBER; i++)
+    {
+        const libdriver::Mcp9600Burst burst = co_await async.read_burst();
+        
+        if ((burst.status == 0) && (burst.sample.hot_mc == hot_mc))
+        {
+            gs_ok++;
+        }
+        else
+        {
+            printf("mcp9600: burst status %d hot %d mC, expected %d mC.\n", burst.status,
+                   static_cast<int>(burst.sample.hot_mc), static_cast<int>(hot_mc));
+            gs_failed++;
+        }
+    }
+}
+
+/**
+ * @brief      wait for an alert event
+ * @param[in]  &alert reference to an alert event
+ * @param[in]  ms timeout in ms
+ * @param[out] &event reference to the result buffer
+ * @param[out] &elapsed reference to the elapsed time buffer
+ * @return     task
+ * @note       none
+ */
+static libdriver::Mcp9600Task<> a_wait_task(libdriver::Mcp9600Alert &alert, uint32_t ms, bool &event, uint64_t &elapsed)
+{
+    const uint64_t start = gs_now;
+    
+    event = co_await alert.wait(ms);
+    elapsed = gs_now - start;
+}
+
+/**
+ * @brief     signal an alert event after a while
+ * @param[in] &executor reference to the executor
+ * @param[in] &alert reference to an alert event
+ * @param[in] ms delay in ms
+ * @return    task
+ * @note      none
+ */
+static libdriver::Mcp9600Task<> a_set_task(libdriver::Mcp9600Executor &executor, libdriver::Mcp9600Alert &alert, uint32_t ms)
+{
+    co_await executor.sleep(ms);
+    alert.set();
+}
+
+/**
+ * @brief      read one burst
+ * @param[in]  &async reference to an asynchronous sensor
+ * @param[out] &burst reference to the result buffer
+ * @return     task
+ * @note       none
+ */
+static libdriver::Mcp9600Task<> a_read_task(libdriver::Mcp9600Async<Sensor> &async, libdriver::Mcp9600Burst &burst)
+{
+    burst = co_await async.read_burst();
+}
+
+/**
+ * @brief  main function
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   it runs the coroutine driver against the emulated chips on a simulated clock
+ */
+int main()
+{
+    uint64_t start;
+    uint64_t elapsed;
+    bool event;
+    libdriver::Mcp9600Burst burst;
+    libdriver::Mcp9600Executor executor(a_now, a_sleep, nullptr);
+    libdriver::Mcp9600Alert alert(executor);
+    std::unique_ptr<Sensor> sensor[EMULATOR_BUS_NUMBER];
+    
+    /* one sensor on each bus */
+    for (uint32_t i = 0; i < EMULATOR_BUS_NUMBER; i++)
+    {
+        (void)mcp9600_emulator_init(&gs_bus[i].emulator, MCP9600_ADDRESS_0);
+        (void)mcp9600_emulator_set_temperature(&gs_bus[i].emulator, 100.0f + static_cast<float>(i), 25.0f);
+        sensor[i] = std::make_unique<Sensor>(gs_bus[i]);
+        if (!sensor[i]->ok())
+        {
+            printf("mcp9600: sensor %d init failed.\n", static_cast<int>(i));
+            
+            return 1;
+        }
+    }
+    
+    /* the bursts of all the buses overlap on one thread */
+    {
+        std::unique_ptr<libdriver::Mcp9600Async<Sensor>> async[EMULATOR_BUS_NUMBER];
+        
+        for (uint32_t i = 0; i < EMULATOR_BUS_NUMBER; i++)
+        {
+            async[i] = std::make_unique<libdriver::Mcp9600Async<Sensor>>(executor, *sensor[i]);
+            executor.spawn(a_burst_task(*async[i], 100000 + 1000 * static_cast<int32_t>(i)));
+        }
+        start = gs_now;
+        executor.run();
+        elapsed = gs_now - start;
+        if ((gs_failed != 0) || (gs_ok != EMULATOR_BUS_NUMBER * EMULATOR_BURST_NUMBER) || (executor.tasks() != 0) ||
+            (elapsed < EMULATOR_BURST_NUMBER * Sensor::conversion_time_ms) ||
+            (elapsed > EMULATOR_BURST_NUMBER * (Sensor::conversion_time_ms + 10)))
+        {
+            printf("mcp9600: %d bursts failed in %d ms.\n", static_cast<int>(gs_failed), static_cast<int>(elapsed));
+            
+            return 1;
+        }
+        printf("mcp9600: %d bursts on %d buses passed in %d ms.\n", static_cast<int>(gs_ok),
+               EMULATOR_BUS_NUMBER, static_cast<int>(elapsed));
+    }
+    
+    /* set wakes the waiter before its timer */
+    executor.spawn(a_wait_task(alert, 1000, event, elapsed));
+    executor.spawn(a_set_task(executor, alert, 5));
+    start = gs_now;
+    executor.run();
+    if (!event || (elapsed != 5) || (gs_now - start != 5))
+    {
+        printf("mcp9600: alert woke after %d ms.\n", static_cast<int>(elapsed));
+        
+        return 1;
+    }
+    
+    /* the waiter resumes on its timer without an event */
+    executor.spawn(a_wait_task(alert, 20, event, elapsed));
+    executor.run();
+    if (event || (elapsed != 20))
+    {
+        printf("mcp9600: alert timeout after %d ms.\n", static_cast<int>(elapsed));
+        
+        return 1;
+    }
+    printf("mcp9600: alert check passed.\n");
+    
+    /* a conversion that never finishes times out */
+    {
+        libdriver::Mcp9600Async<Sensor> async(executor, *sensor[0]);
+        
+        gs_bus[0].stuck = true;
+        executor.spawn(a_read_task(async, burst));
+        executor.run();
+        gs_bus[0].stuck = false;
+        if (burst.status != 4)
+        {
+            printf("mcp9600: stuck burst returned %d.\n", burst.status);
+            
+            return 1;
+        }
+        printf("mcp9600: timeout check passed.\n");
+    }
+    
+    printf("mcp9600: finish c++ coroutine test.\n");
+    
+    return 0;
+}
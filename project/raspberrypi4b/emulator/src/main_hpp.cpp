@@ -0,0 +1,219 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      main_hpp.cpp
+ * @brief     c++ wrapper emulator main source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9600.hpp"
+#include "driver_mcp9600_emulator.h"
+
+#include <cstdarg>
+#include <cstdio>
+
+/**
+ * @brief emulated bus structure definition
+ */
+struct EmulatorBus
+{
+    mcp9600_emulator_t emulator;        /**< emulated chip */
+    
+    uint8_t init()
+    {
+        return mcp9600_emulator_iic_init(&emulator);
+    }
+    
+    uint8_t deinit()
+    {
+        return mcp9600_emulator_iic_deinit(&emulator);
+    }
+    
+    uint8_t write_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+    {
+        return mcp9600_emulator_iic_write_cmd(&emulator, addr, buf, len);
+    }
+    
+    uint8_t read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
+    {
+        return mcp9600_emulator_iic_read_cmd(&emulator, addr, buf, len);
+    }
+    
+    void delay_ms(uint32_t ms)
+    {
+        mcp9600_emulator_delay_ms(&emulator, ms);
+    }
+    
+    static void debug_print(const char *const fmt, ...)
+    {
+        va_list args;
+        
+        va_start(args, fmt);
+        (void)vprintf(fmt, args);
+        va_end(args);
+    }
+};
+
+/**
+ * @brief sensor type definition
+ */
+using Sensor = libdriver::Mcp9600<EmulatorBus, MCP9600_ADDRESS_0, MCP9600_THERMOCOUPLE_TYPE_K,
+                                  MCP9600_ADC_RESOLUTION_16_BIT, MCP9600_BURST_MODE_SAMPLE_4>;
+
+/**
+ * @brief default sensor type definition
+ */
+using DefaultSensor = libdriver::Mcp9600<EmulatorBus, MCP9600_ADDRESS_0, MCP9600_THERMOCOUPLE_TYPE_K>;
+
+/**
+ * @brief quarter degree cold junction sensor type definition
+ */
+using QuarterSensor = libdriver::Mcp9600<EmulatorBus, MCP9600_ADDRESS_0, MCP9600_THERMOCOUPLE_TYPE_K,
+                                         MCP9600_ADC_RESOLUTION_12_BIT, MCP9600_BURST_MODE_SAMPLE_128,
+                                         MCP9600_COLD_JUNCTION_RESOLUTION_0P25>;
+
+/* the timing members follow the datasheet conversion times */
+static_assert(Sensor::burst_count == 4, "burst count");
+static_assert(Sensor::sample_time_ms == 80, "sample time");
+static_assert(Sensor::conversion_time_ms == 320, "conversion time");
+static_assert(DefaultSensor::burst_count == 1, "default burst count");
+static_assert(DefaultSensor::conversion_time_ms == 320, "default conversion time");
+static_assert(QuarterSensor::sample_time_ms == 5, "12 bit sample time");
+static_assert(QuarterSensor::conversion_time_ms == 640, "128 samples conversion time");
+
+/* the scale members match the c fixed point api */
+static_assert(DefaultSensor::adc_nv_per_lsb == 2000, "18 bit adc lsb");
+static_assert(Sensor::adc_nv_per_lsb == 8000, "16 bit adc lsb");
+static_assert(QuarterSensor::adc_nv_per_lsb == 128000, "12 bit adc lsb");
+static_assert(Sensor::cold_lsb_shift == 4, "0.0625 cold junction lsb");
+static_assert(QuarterSensor::cold_lsb_shift == 2, "0.25 cold junction lsb");
+static_assert(Sensor::junction_to_mc(1600) == 100000, "junction scale");
+static_assert(Sensor::junction_to_mc(-3) == -188, "junction rounding");
+static_assert(Sensor::cold_to_mc(400) == 25000, "cold junction scale");
+static_assert(QuarterSensor::cold_to_mc(100) == 25000, "quarter cold junction scale");
+static_assert(Sensor::adc_to_nv(-3) == -24000, "adc scale");
+
+/**
+ * @brief     check a sample against the emulated temperatures
+ * @param[in] *name pointer to a read name
+ * @param[in] &sample reference to a sample structure
+ * @param[in] hot_mc expected hot junction temperature in mC
+ * @param[in] cold_mc expected cold junction temperature in mC
+ * @return    status code
+ *            - 0 success
+ *            - 1 check failed
+ * @note      none
+ */
+static uint8_t a_sample_check(const char *name, const libdriver::Mcp9600Sample &sample, int32_t hot_mc, int32_t cold_mc)
+{
+    if ((sample.hot_mc != hot_mc) || (sample.cold_mc != cold_mc) ||
+        (sample.hot_mc != Sensor::junction_to_mc(sample.hot_raw)) ||
+        (sample.delta_mc != Sensor::junction_to_mc(sample.delta_raw)) ||
+        (sample.cold_mc != Sensor::cold_to_mc(sample.cold_raw)))
+    {
+        printf("mcp9600: %s hot %d cold %d mC, expected %d %d mC.\n", name,
+               static_cast<int>(sample.hot_mc), static_cast<int>(sample.cold_mc),
+               static_cast<int>(hot_mc), static_cast<int>(cold_mc));
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief  main function
+ * @return status code
+ *         - 0 success
+ *         - 1 run failed
+ * @note   it runs the c++ wrapper against the emulated chip
+ */
+int main()
+{
+    uint32_t start;
+    libdriver::Mcp9600Sample sample;
+    EmulatorBus bus;
+    
+    (void)mcp9600_emulator_init(&bus.emulator, MCP9600_ADDRESS_0);
+    (void)mcp9600_emulator_set_temperature(&bus.emulator, 100.0f, 25.0f);
+    
+    Sensor sensor(bus);
+    if (!sensor.ok())
+    {
+        printf("mcp9600: sensor init failed with %d.\n", sensor.status());
+        
+        return 1;
+    }
+    
+    /* a single read blocks for one burst */
+    start = bus.emulator.now;
+    if ((sensor.single_read(sample) != 0) || (a_sample_check("single read", sample, 100000, 25000) != 0))
+    {
+        return 1;
+    }
+    if ((bus.emulator.now - start) < Sensor::conversion_time_ms)
+    {
+        printf("mcp9600: single read returned after %d ms.\n", static_cast<int>(bus.emulator.now - start));
+        
+        return 1;
+    }
+    printf("mcp9600: single read passed in %d ms.\n", static_cast<int>(bus.emulator.now - start));
+    
+    /* the continuous read follows the emulated temperature */
+    (void)mcp9600_emulator_set_temperature(&bus.emulator, 150.0f, 30.0f);
+    if (sensor.start_continuous() != 0)
+    {
+        return 1;
+    }
+    bus.delay_ms(Sensor::conversion_time_ms);
+    if ((sensor.continuous_read(sample) != 0) || (a_sample_check("continuous read", sample, 150000, 30000) != 0))
+    {
+        return 1;
+    }
+    if (sensor.stop_continuous() != 0)
+    {
+        return 1;
+    }
+    printf("mcp9600: continuous read passed.\n");
+    
+    /* a moved object hands the chip over */
+    Sensor moved(std::move(sensor));
+    if (sensor.ok() || !moved.ok() || (moved.single_read(sample) != 0) ||
+        (a_sample_check("moved read", sample, 150000, 30000) != 0))
+    {
+        printf("mcp9600: move failed.\n");
+        
+        return 1;
+    }
+    printf("mcp9600: finish c++ wrapper test.\n");
+    
+    return 0;
+}
@@ -0,0 +1,223 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      engine.h
+ * @brief     engine header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#ifndef ENGINE_H
+#define ENGINE_H
+
+#include "driver_mcp9600.h"
+#include "ring.h"
+#include <pthread.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @defgroup engine engine function
+ * @brief    engine function modules
+ * @{
+ */
+
+/**
+ * @brief engine size definition
+ */
+#ifndef ENGINE_BUS_MAX
+    #define ENGINE_BUS_MAX           4        /**< max bus number */
+#endif
+#ifndef ENGINE_DEVICE_MAX
+    #define ENGINE_DEVICE_MAX        8        /**< max device number of one bus */
+#endif
+
+/**
+ * @brief engine transport structure definition
+ * @note  it is the transport of one bus, the same ctx callbacks the driver links,
+ *        iic_read and iic_read_batch are optional and can be NULL
+ */
+typedef struct engine_transport_s
+{
+    void *user;                                                                                           /**< transport context */
+    uint8_t (*iic_init)(void *user);                                                                      /**< point to an iic_init function address */
+    uint8_t (*iic_deinit)(void *user);                                                                    /**< point to an iic_deinit function address */
+    uint8_t (*iic_write_cmd)(void *user, uint8_t addr, uint8_t *buf, uint16_t len);                       /**< point to an iic_write_cmd function address */
+    uint8_t (*iic_read_cmd)(void *user, uint8_t addr, uint8_t *buf, uint16_t len);                        /**< point to an iic_read_cmd function address */
+    uint8_t (*iic_read)(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);               /**< point to an iic_read function address */
+    uint8_t (*iic_read_batch)(void *user, uint8_t addr, uint8_t *reg, uint16_t *len, uint8_t num,
+                              uint8_t *buf);                                                              /**< point to an iic_read_batch function address */
+    void (*delay_ms)(void *user, uint32_t ms);                                                            /**< point to a delay_ms function address */
+} engine_transport_t;
+
+/**
+ * @brief engine bus structure definition
+ * @note  each bus is serviced by its own worker thread and ring, the worker owns the handles,
+ *        the counters are written by the worker and read with atomics
+ */
+typedef struct engine_bus_s
+{
+    ring_t ring;                                       /**< event ring of the worker */
+    engine_transport_t transport;                      /**< bus transport */
+    mcp9600_handle_t handle[ENGINE_DEVICE_MAX];        /**< device handles */
+    uint8_t num;                                       /**< device number */
+    uint8_t index;                                     /**< bus index */
+    uint8_t opened;                                    /**< transport opened flag */
+    pthread_t pid;                                     /**< worker pthread pid */
+    struct engine_s *engine;                           /**< owner engine */
+    uint64_t progress;                                 /**< no later event is older than it in ns */
+    uint64_t busy_ns;                                  /**< time spent in bus reads in ns */
+    uint32_t samples;                                  /**< pushed sample number */
+    uint32_t errors;                                   /**< failed read number */
+    ring_event_t head;                                 /**< oldest popped event of the merger */
+    uint8_t head_valid;                                /**< head valid flag */
+} engine_bus_t;
+
+/**
+ * @brief engine structure definition
+ */
+typedef struct engine_s
+{
+    engine_bus_t bus[ENGINE_BUS_MAX];        /**< buses */
+    uint8_t num;                             /**< bus number */
+    uint8_t running;                         /**< running flag */
+    uint8_t stop;                            /**< stop request flag */
+    uint32_t period_ms;                      /**< poll period of every bus in ms */
+    uint64_t start;                          /**< start timestamp in ns */
+    uint64_t stop_time;                      /**< stop timestamp in ns */
+} engine_t;
+
+/**
+ * @brief engine statistics structure definition
+ */
+typedef struct engine_stats_s
+{
+    uint32_t samples;            /**< pushed sample number */
+    uint32_t errors;             /**< failed read number */
+    uint32_t dropped;            /**< samples dropped by a full ring */
+    uint64_t busy_ns;            /**< time spent in bus reads in ns */
+    uint64_t elapsed_ns;         /**< running time in ns */
+    float utilization;           /**< busy time / running time in percent */
+} engine_stats_t;
+
+/**
+ * @brief     engine init
+ * @param[in] *engine pointer to an engine structure
+ * @param[in] period_ms poll period of every bus in ms, 0 means back to back
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t engine_init(engine_t *engine, uint32_t period_ms);
+
+/**
+ * @brief      engine add a bus
+ * @param[in]  *engine pointer to an engine structure
+ * @param[in]  *transport pointer to the bus transport
+ * @param[out] *index pointer to a bus index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 add failed
+ * @note       the transport is opened once for all devices of the bus
+ */
+uint8_t engine_add_bus(engine_t *engine, const engine_transport_t *transport, uint8_t *index);
+
+/**
+ * @brief     engine add a device on a bus
+ * @param[in] *engine pointer to an engine structure
+ * @param[in] bus bus index
+ * @param[in] addr addr pin
+ * @param[in] type thermocouple type
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      the device is initialized and starts the continuous conversion,
+ *            the event source is bus * ENGINE_DEVICE_MAX + device
+ */
+uint8_t engine_add_device(engine_t *engine, uint8_t bus, mcp9600_address_t addr, mcp9600_thermocouple_type_t type);
+
+/**
+ * @brief     engine start the workers
+ * @param[in] *engine pointer to an engine structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      one worker thread is started for each bus with devices
+ */
+uint8_t engine_start(engine_t *engine);
+
+/**
+ * @brief      engine read the merged stream
+ * @param[in]  *engine pointer to an engine structure
+ * @param[out] *event pointer to an event structure
+ * @param[in]  timeout timeout in ms, -1 means forever
+ * @return     status code
+ *             - 0 success
+ *             - 1 timeout or read failed
+ * @note       the events of all buses are returned in the order of the monotonic timestamp,
+ *             only one consumer thread can call it
+ */
+uint8_t engine_read(engine_t *engine, ring_event_t *event, int32_t timeout);
+
+/**
+ * @brief      engine get the statistics of a bus
+ * @param[in]  *engine pointer to an engine structure
+ * @param[in]  bus bus index
+ * @param[out] *stats pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       it can be called while the workers are running
+ */
+uint8_t engine_get_stats(engine_t *engine, uint8_t bus, engine_stats_t *stats);
+
+/**
+ * @brief     engine stop the workers and release the buses
+ * @param[in] *engine pointer to an engine structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      the statistics stay readable after the stop
+ */
+uint8_t engine_deinit(engine_t *engine);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
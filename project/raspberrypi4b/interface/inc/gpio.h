@@ -51,12 +51,65 @@
  * @{
  */
 
+/**
+ * @brief gpio max line number definition
+ */
+#define GPIO_MAX_LINE        32
+
+/**
+ * @brief gpio edge enumeration definition
+ */
+typedef enum
+{
+    GPIO_EDGE_FALLING = 0x00,        /**< falling edge */
+    GPIO_EDGE_RISING  = 0x01,        /**< rising edge */
+    GPIO_EDGE_BOTH    = 0x02,        /**< both edges */
+} gpio_edge_t;
+
+/**
+ * @brief gpio event handler definition
+ * @note  user is the pointer passed to gpio_event_add, edge is GPIO_EDGE_FALLING or GPIO_EDGE_RISING
+ *        and timestamp is the kernel timestamp of the edge in ns, CLOCK_MONOTONIC since linux 5.7
+ */
+typedef void (*gpio_handler_t)(void *user, uint32_t line, uint8_t edge, uint64_t timestamp);
+
+/**
+ * @brief  gpio event loop init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   it opens the gpio chip and starts one event thread for all lines
+ */
+uint8_t gpio_event_init(void);
+
+/**
+ * @brief     gpio event loop add a line
+ * @param[in] line gpio line
+ * @param[in] edge watched edge
+ * @param[in] handler pointer to an event handler
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      the handler runs in the event thread, lines can be added while the loop runs
+ */
+uint8_t gpio_event_add(uint32_t line, gpio_edge_t edge, gpio_handler_t handler, void *user);
+
+/**
+ * @brief  gpio event loop deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   it wakes up and joins the event thread, then releases all lines
+ */
+uint8_t gpio_event_deinit(void);
+
 /**
  * @brief  gpio interrupt init
  * @return status code
  *         - 0 success
  *         - 1 init failed
- * @note   none
+ * @note   it watches the falling edge of line 17 and pushes the alert events to g_ring
  */
 uint8_t gpio_interrupt_init(void);
 
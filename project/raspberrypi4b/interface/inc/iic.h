@@ -53,6 +53,21 @@ extern "C" {
  * @{
  */
 
+/**
+ * @brief iic max register number of one batch read
+ * @note  the linux kernel accepts 42 messages in one I2C_RDWR transfer
+ */
+#define IIC_READ_BATCH_MAX        21
+
+/**
+ * @brief iic bus structure definition
+ */
+typedef struct iic_bus_s
+{
+    char *name;        /**< iic device name */
+    int fd;            /**< iic handle */
+} iic_bus_t;
+
 /**
  * @brief      iic bus init
  * @param[in]  *name pointer to an iic device name buffer
@@ -101,6 +116,42 @@ uint8_t iic_read_cmd(int fd, uint8_t addr, uint8_t *buf, uint16_t len);
  */
 uint8_t iic_read(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);
 
+/**
+ * @brief      iic bus read several registers in one transfer
+ * @param[in]  fd iic handle
+ * @param[in]  addr iic device write address
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       addr = device_address_7bits << 1
+ *             the data of each register is stored one after another in buf
+ *             and num can't be over IIC_READ_BATCH_MAX, the registers are read
+ *             one by one when the adapter refuses a read that is not the last message
+ */
+uint8_t iic_read_batch(int fd, uint8_t addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf);
+
+/**
+ * @brief      iic bus read registers of several devices in one transfer
+ * @param[in]  fd iic handle
+ * @param[in]  *addr pointer to an iic device write address list
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       addr = device_address_7bits << 1
+ *             register i is read from the device addr[i] and the data of each
+ *             register is stored one after another in buf, num can't be over IIC_READ_BATCH_MAX,
+ *             the registers are read one by one when the adapter refuses a read that is not the last message
+ */
+uint8_t iic_read_multi(int fd, uint8_t *addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf);
+
 /**
  * @brief      iic bus read with 16 bits register address
  * @param[in]  fd iic handle
@@ -0,0 +1,210 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      ring.h
+ * @brief     ring header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef RING_H
+#define RING_H
+
+#include <unistd.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @defgroup ring ring function
+ * @brief    ring function modules
+ * @{
+ */
+
+/**
+ * @brief ring size definition
+ * @note  it must be a power of 2
+ */
+#ifndef RING_SIZE
+    #define RING_SIZE        256
+#endif
+
+/**
+ * @brief ring cache line definition
+ */
+#define RING_CACHE_LINE      64
+
+/**
+ * @brief ring event type enumeration definition
+ */
+typedef enum
+{
+    RING_EVENT_SAMPLE = 0x00,        /**< temperature sample */
+    RING_EVENT_ALERT  = 0x01,        /**< alert pin edge */
+} ring_event_type_t;
+
+/**
+ * @brief ring event structure definition
+ */
+typedef struct ring_event_s
+{
+    uint64_t timestamp;        /**< monotonic timestamp in ns */
+    uint8_t type;              /**< event type */
+    uint8_t source;            /**< device index or gpio line */
+    int16_t hot_raw;           /**< raw hot temperature */
+    float hot_s;               /**< converted hot temperature */
+    int16_t delta_raw;         /**< raw delta temperature */
+    float delta_s;             /**< converted delta temperature */
+    int16_t cold_raw;          /**< raw cold temperature */
+    float cold_s;              /**< converted cold temperature */
+} ring_event_t;
+
+/**
+ * @brief ring structure definition
+ * @note  head is only written by the producer and tail and waiting are only written by the consumer,
+ *        they are kept in different cache lines, a push only writes efd when waiting is set
+ */
+typedef struct ring_s
+{
+    uint32_t head __attribute__((aligned(RING_CACHE_LINE)));        /**< producer index */
+    uint32_t dropped;                                               /**< dropped event number */
+    uint32_t tail __attribute__((aligned(RING_CACHE_LINE)));        /**< consumer index */
+    uint32_t waiting;                                               /**< consumer waiting flag */
+    int efd;                                                        /**< wake up eventfd */
+    ring_event_t buf[RING_SIZE];                                    /**< event buffer */
+} ring_t;
+
+/**
+ * @brief     ring init
+ * @param[in] *ring pointer to a ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t ring_init(ring_t *ring);
+
+/**
+ * @brief     ring deinit
+ * @param[in] *ring pointer to a ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t ring_deinit(ring_t *ring);
+
+/**
+ * @brief     ring push an event
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] *event pointer to an event structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 ring is full
+ * @note      only one producer thread can call it,
+ *            a full ring drops the new event and counts it in dropped,
+ *            the consumer is only woken up when it is waiting
+ */
+uint8_t ring_push(ring_t *ring, const ring_event_t *event);
+
+/**
+ * @brief     ring wake up the consumer
+ * @param[in] *ring pointer to a ring structure
+ * @note      the producer can call it to make the consumer check its state without an event
+ */
+void ring_notify(ring_t *ring);
+
+/**
+ * @brief     ring mark the consumer as waiting
+ * @param[in] *ring pointer to a ring structure
+ * @return    status code
+ *            - 0 the ring is empty and the consumer can sleep on efd
+ *            - 1 an event is ready
+ * @note      only one consumer thread can call it,
+ *            the consumer must call ring_wait_finish after it wakes up
+ */
+uint8_t ring_wait_prepare(ring_t *ring);
+
+/**
+ * @brief     ring clear the consumer waiting flag
+ * @param[in] *ring pointer to a ring structure
+ * @note      only one consumer thread can call it
+ */
+void ring_wait_finish(ring_t *ring);
+
+/**
+ * @brief      ring pop an event
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *event pointer to an event structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 ring is empty
+ * @note       only one consumer thread can call it
+ */
+uint8_t ring_pop(ring_t *ring, ring_event_t *event);
+
+/**
+ * @brief     ring wait for an event
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] timeout timeout in ms, -1 means forever
+ * @return    status code
+ *            - 0 an event is ready
+ *            - 1 timeout or wait failed
+ * @note      only one consumer thread can call it
+ */
+uint8_t ring_wait(ring_t *ring, int32_t timeout);
+
+/**
+ * @brief     ring get the dropped event number
+ * @param[in] *ring pointer to a ring structure
+ * @return    dropped event number
+ * @note      none
+ */
+uint32_t ring_get_dropped(ring_t *ring);
+
+/**
+ * @brief  ring get the monotonic timestamp
+ * @return timestamp in ns
+ * @note   none
+ */
+uint64_t ring_timestamp(void);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,218 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      trace.h
+ * @brief     trace header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <unistd.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#ifdef __cplusplus
+ extern "C" {
+#endif
+
+/**
+ * @defgroup trace trace function
+ * @brief    trace function modules
+ * @{
+ */
+
+/**
+ * @brief trace file definition
+ * @note  the file starts with the 4 bytes magic, 1 byte version and 3 reserved bytes,
+ *        each record is 1 byte type, 1 byte address, 2 bytes length, 4 bytes time since
+ *        the last record in us, all little endian, followed by the data bytes
+ */
+#define TRACE_MAGIC              "MCPT"        /**< file magic */
+#define TRACE_VERSION            0x01          /**< file version */
+#define TRACE_DATA_MAX           64            /**< max data length of one record */
+
+/**
+ * @brief trace record type enumeration definition
+ */
+typedef enum
+{
+    TRACE_TYPE_WRITE  = 0x00,        /**< iic_write_cmd */
+    TRACE_TYPE_READ   = 0x01,        /**< iic_read_cmd */
+    TRACE_TYPE_FAILED = 0x80,        /**< transfer failed flag */
+} trace_type_t;
+
+/**
+ * @brief trace pacing enumeration definition
+ */
+typedef enum
+{
+    TRACE_PACING_FULL_SPEED = 0x00,        /**< replay as fast as the driver asks */
+    TRACE_PACING_RECORDED   = 0x01,        /**< replay each record at its recorded time */
+} trace_pacing_t;
+
+/**
+ * @brief trace transport structure definition
+ * @note  it is the transport under the recorder, the same ctx callbacks the driver links
+ */
+typedef struct trace_transport_s
+{
+    void *user;                                                                       /**< transport context */
+    uint8_t (*iic_init)(void *user);                                                  /**< point to an iic_init function address */
+    uint8_t (*iic_deinit)(void *user);                                                /**< point to an iic_deinit function address */
+    uint8_t (*iic_write_cmd)(void *user, uint8_t addr, uint8_t *buf, uint16_t len);   /**< point to an iic_write_cmd function address */
+    uint8_t (*iic_read_cmd)(void *user, uint8_t addr, uint8_t *buf, uint16_t len);    /**< point to an iic_read_cmd function address */
+    void (*delay_ms)(void *user, uint32_t ms);                                        /**< point to a delay_ms function address */
+} trace_transport_t;
+
+/**
+ * @brief trace structure definition
+ */
+typedef struct trace_s
+{
+    FILE *fp;                           /**< trace file */
+    uint8_t replay;                     /**< 0 record, 1 replay */
+    uint8_t pacing;                     /**< replay pacing */
+    uint64_t last;                      /**< last record timestamp in ns */
+    uint64_t offset;                    /**< replay time of the current record in ns */
+    uint32_t count;                     /**< record number */
+    uint32_t mismatch;                  /**< replay mismatch number */
+    trace_transport_t transport;        /**< recorded transport */
+} trace_t;
+
+/**
+ * @brief     trace open a file to record
+ * @param[in] *trace pointer to a trace structure
+ * @param[in] *path pointer to a trace file path
+ * @param[in] *transport pointer to the recorded transport
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      none
+ */
+uint8_t trace_record_open(trace_t *trace, const char *path, const trace_transport_t *transport);
+
+/**
+ * @brief     trace open a file to replay
+ * @param[in] *trace pointer to a trace structure
+ * @param[in] *path pointer to a trace file path
+ * @param[in] pacing replay pacing
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed or the file is not a trace
+ * @note      none
+ */
+uint8_t trace_replay_open(trace_t *trace, const char *path, trace_pacing_t pacing);
+
+/**
+ * @brief     trace close the file
+ * @param[in] *trace pointer to a trace structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t trace_close(trace_t *trace);
+
+/**
+ * @brief     trace iic bus init
+ * @param[in] *user pointer to a trace structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      it can be linked as iic_init_ctx
+ */
+uint8_t trace_iic_init(void *user);
+
+/**
+ * @brief     trace iic bus deinit
+ * @param[in] *user pointer to a trace structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      it can be linked as iic_deinit_ctx
+ */
+uint8_t trace_iic_deinit(void *user);
+
+/**
+ * @brief     trace iic bus write command
+ * @param[in] *user pointer to a trace structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      it can be linked as iic_write_cmd_ctx, a replayed write that differs
+ *            from the record is counted in mismatch
+ */
+uint8_t trace_iic_write_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      trace iic bus read command
+ * @param[in]  *user pointer to a trace structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it can be linked as iic_read_cmd_ctx
+ */
+uint8_t trace_iic_read_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     trace delay ms
+ * @param[in] *user pointer to a trace structure
+ * @param[in] ms time
+ * @note      it can be linked as delay_ms_ctx, the replay does not delay because
+ *            the recorded pacing already holds the time between the records
+ */
+void trace_delay_ms(void *user, uint32_t ms);
+
+/**
+ * @brief     trace get the replay mismatch number
+ * @param[in] *trace pointer to a trace structure
+ * @return    mismatch number
+ * @note      none
+ */
+uint32_t trace_get_mismatch(trace_t *trace);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
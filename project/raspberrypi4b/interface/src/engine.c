@@ -0,0 +1,568 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      engine.c
+ * @brief     engine source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#include "engine.h"
+#include "driver_mcp9600_interface.h"
+#include <poll.h>
+#include <errno.h>
+#include <time.h>
+#include <string.h>
+
+/**
+ * @brief     engine empty iic init and deinit
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ * @note      the engine opens the transport once for all devices of a bus
+ */
+static uint8_t a_engine_iic_nop(void *user)
+{
+    (void)user;
+    
+    return 0;
+}
+
+/**
+ * @brief     engine bus worker
+ * @param[in] *p pointer to an engine bus structure
+ * @return    NULL
+ * @note      the progress is published before each read, after a failed read and before the sleep,
+ *            so every later event of the bus has a timestamp not older than it, the merger is
+ *            notified after each sweep even when the bus pushed nothing
+ */
+static void *a_engine_worker(void *p)
+{
+    engine_bus_t *bus = (engine_bus_t *)p;
+    engine_t *engine = bus->engine;
+    uint64_t period_ns = (uint64_t)engine->period_ms * 1000000ULL;
+    uint64_t next;
+    uint64_t start;
+    uint64_t end;
+    uint8_t i;
+    uint8_t res;
+    uint8_t idle;
+    ring_event_t e;
+    struct timespec ts;
+    
+    /* loop */
+    next = ring_timestamp();
+    memset(&e, 0, sizeof(ring_event_t));
+    e.type = RING_EVENT_SAMPLE;
+    while (__atomic_load_n(&engine->stop, __ATOMIC_ACQUIRE) == 0)
+    {
+        /* read all devices of the bus */
+        for (i = 0; i < bus->num; i++)
+        {
+            start = ring_timestamp();
+            __atomic_store_n(&bus->progress, start, __ATOMIC_RELEASE);
+            res = mcp9600_continuous_read(&bus->handle[i], &e.hot_raw, &e.hot_s,
+                                          &e.delta_raw, &e.delta_s, &e.cold_raw, &e.cold_s);
+            end = ring_timestamp();
+            __atomic_fetch_add(&bus->busy_ns, end - start, __ATOMIC_RELAXED);
+            if (res != 0)
+            {
+                __atomic_fetch_add(&bus->errors, 1, __ATOMIC_RELAXED);
+                
+                /* no event comes from the failed read, let the merger pass it */
+                __atomic_store_n(&bus->progress, end, __ATOMIC_RELEASE);
+                ring_notify(&bus->ring);
+                
+                continue;
+            }
+            e.timestamp = end;
+            e.source = (uint8_t)(bus->index * ENGINE_DEVICE_MAX + i);
+            if (ring_push(&bus->ring, &e) == 0)
+            {
+                __atomic_fetch_add(&bus->samples, 1, __ATOMIC_RELAXED);
+            }
+        }
+        
+        /* no read starts before the next period, back to back polling never sleeps */
+        idle = 0;
+        if (period_ns != 0)
+        {
+            next += period_ns;
+            start = ring_timestamp();
+            if (next <= start)
+            {
+                next = start;
+            }
+            else
+            {
+                __atomic_store_n(&bus->progress, next, __ATOMIC_RELEASE);
+                idle = 1;
+            }
+        }
+        
+        /* let the merger pass the finished sweep */
+        ring_notify(&bus->ring);
+        if (idle != 0)
+        {
+            ts.tv_sec = (time_t)(next / 1000000000ULL);
+            ts.tv_nsec = (long)(next % 1000000000ULL);
+            
+            /* the progress is already next, so a signal must not end the sleep early */
+            while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, NULL) == EINTR)
+            {
+                /* sleep again until the absolute deadline */
+            }
+        }
+    }
+    
+    /* no more events */
+    __atomic_store_n(&bus->progress, UINT64_MAX, __ATOMIC_RELEASE);
+    ring_notify(&bus->ring);
+    
+    return NULL;
+}
+
+/**
+ * @brief     engine init
+ * @param[in] *engine pointer to an engine structure
+ * @param[in] period_ms poll period of every bus in ms, 0 means back to back
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t engine_init(engine_t *engine, uint32_t period_ms)
+{
+    if (engine == NULL)
+    {
+        return 1;
+    }
+    
+    /* clear the engine */
+    memset(engine, 0, sizeof(engine_t));
+    engine->period_ms = period_ms;
+    
+    return 0;
+}
+
+/**
+ * @brief      engine add a bus
+ * @param[in]  *engine pointer to an engine structure
+ * @param[in]  *transport pointer to the bus transport
+ * @param[out] *index pointer to a bus index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 add failed
+ * @note       the transport is opened once for all devices of the bus
+ */
+uint8_t engine_add_bus(engine_t *engine, const engine_transport_t *transport, uint8_t *index)
+{
+    engine_bus_t *bus;
+    
+    if ((engine->running != 0) || (engine->num >= ENGINE_BUS_MAX))
+    {
+        mcp9600_interface_debug_print("engine: can't add a bus.\n");
+        
+        return 1;
+    }
+    
+    /* init the bus */
+    bus = &engine->bus[engine->num];
+    memset(bus, 0, sizeof(engine_bus_t));
+    bus->transport = *transport;
+    bus->index = engine->num;
+    bus->engine = engine;
+    if (ring_init(&bus->ring) != 0)
+    {
+        return 1;
+    }
+    
+    /* open the transport */
+    if (bus->transport.iic_init(bus->transport.user) != 0)
+    {
+        mcp9600_interface_debug_print("engine: iic init failed.\n");
+        (void)ring_deinit(&bus->ring);
+        
+        return 1;
+    }
+    bus->opened = 1;
+    *index = engine->num;
+    engine->num++;
+    
+    return 0;
+}
+
+/**
+ * @brief     engine add a device on a bus
+ * @param[in] *engine pointer to an engine structure
+ * @param[in] bus bus index
+ * @param[in] addr addr pin
+ * @param[in] type thermocouple type
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      the device is initialized and starts the continuous conversion,
+ *            the event source is bus * ENGINE_DEVICE_MAX + device
+ */
+uint8_t engine_add_device(engine_t *engine, uint8_t bus, mcp9600_address_t addr, mcp9600_thermocouple_type_t type)
+{
+    engine_bus_t *b;
+    mcp9600_handle_t *handle;
+    
+    if ((engine->running != 0) || (bus >= engine->num) || (engine->bus[bus].num >= ENGINE_DEVICE_MAX))
+    {
+        mcp9600_interface_debug_print("engine: can't add a device.\n");
+        
+        return 1;
+    }
+    b = &engine->bus[bus];
+    handle = &b->handle[b->num];
+    
+    /* link the bus transport */
+    DRIVER_MCP9600_LINK_INIT(handle, mcp9600_handle_t);
+    DRIVER_MCP9600_LINK_IIC_INIT_CTX(handle, a_engine_iic_nop);
+    DRIVER_MCP9600_LINK_IIC_DEINIT_CTX(handle, a_engine_iic_nop);
+    DRIVER_MCP9600_LINK_IIC_READ_COMMAND_CTX(handle, b->transport.iic_read_cmd);
+    DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND_CTX(handle, b->transport.iic_write_cmd);
+    DRIVER_MCP9600_LINK_IIC_READ_CTX(handle, b->transport.iic_read);
+    DRIVER_MCP9600_LINK_IIC_READ_BATCH_CTX(handle, b->transport.iic_read_batch);
+    DRIVER_MCP9600_LINK_IIC_DELAY_MS_CTX(handle, b->transport.delay_ms);
+    DRIVER_MCP9600_LINK_DEBUG_PRINT(handle, mcp9600_interface_debug_print);
+    DRIVER_MCP9600_LINK_USER(handle, b->transport.user);
+    
+    /* init the device */
+    if ((mcp9600_set_addr_pin(handle, addr) != 0) || (mcp9600_init(handle) != 0))
+    {
+        mcp9600_interface_debug_print("engine: init device failed.\n");
+        
+        return 1;
+    }
+    if ((mcp9600_set_thermocouple_type(handle, type) != 0) ||
+        (mcp9600_start_continuous_read(handle) != 0))
+    {
+        mcp9600_interface_debug_print("engine: start device failed.\n");
+        (void)mcp9600_deinit(handle);
+        
+        return 1;
+    }
+    b->num++;
+    
+    return 0;
+}
+
+/**
+ * @brief     engine start the workers
+ * @param[in] *engine pointer to an engine structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ * @note      one worker thread is started for each bus with devices
+ */
+uint8_t engine_start(engine_t *engine)
+{
+    uint8_t i;
+    uint8_t j;
+    
+    if (engine->running != 0)
+    {
+        return 1;
+    }
+    
+    /* start one worker per bus */
+    engine->stop = 0;
+    engine->start = ring_timestamp();
+    for (i = 0; i < engine->num; i++)
+    {
+        engine->bus[i].progress = engine->start;
+        engine->bus[i].head_valid = 0;
+        if (engine->bus[i].num == 0)
+        {
+            engine->bus[i].progress = UINT64_MAX;
+            
+            continue;
+        }
+        if (pthread_create(&engine->bus[i].pid, NULL, a_engine_worker, &engine->bus[i]) != 0)
+        {
+            perror("engine: creat pthread failed.\n");
+            
+            /* stop the started workers */
+            __atomic_store_n(&engine->stop, 1, __ATOMIC_RELEASE);
+            for (j = 0; j < i; j++)
+            {
+                if (engine->bus[j].num != 0)
+                {
+                    (void)pthread_join(engine->bus[j].pid, NULL);
+                }
+            }
+            
+            return 1;
+        }
+    }
+    engine->running = 1;
+    
+    return 0;
+}
+
+/**
+ * @brief      engine read the merged stream
+ * @param[in]  *engine pointer to an engine structure
+ * @param[out] *event pointer to an event structure
+ * @param[in]  timeout timeout in ms, -1 means forever
+ * @return     status code
+ *             - 0 success
+ *             - 1 timeout or read failed
+ * @note       the events of all buses are returned in the order of the monotonic timestamp,
+ *             only one consumer thread can call it
+ */
+uint8_t engine_read(engine_t *engine, ring_event_t *event, int32_t timeout)
+{
+    struct pollfd pfd[ENGINE_BUS_MAX];
+    ring_t *ring[ENGINE_BUS_MAX];
+    uint64_t deadline;
+    uint64_t bound;
+    uint64_t progress;
+    uint64_t now;
+    uint64_t cnt;
+    int32_t wait;
+    int res;
+    uint8_t best;
+    uint8_t num;
+    uint8_t i;
+    
+    if (engine->running == 0)
+    {
+        return 1;
+    }
+    
+    /* loop */
+    deadline = ring_timestamp() + (uint64_t)((timeout < 0) ? 0 : timeout) * 1000000ULL;
+    while (1)
+    {
+        /* take the oldest event of each bus, an empty bus bounds the output by its progress */
+        best = ENGINE_BUS_MAX;
+        bound = UINT64_MAX;
+        num = 0;
+        for (i = 0; i < engine->num; i++)
+        {
+            engine_bus_t *bus = &engine->bus[i];
+            
+            if (bus->head_valid == 0)
+            {
+                /* load the progress before the ring, a later push is never older than it */
+                progress = __atomic_load_n(&bus->progress, __ATOMIC_ACQUIRE);
+                if (ring_pop(&bus->ring, &bus->head) != 0)
+                {
+                    if (progress < bound)
+                    {
+                        bound = progress;
+                    }
+                    if (progress != UINT64_MAX)
+                    {
+                        ring[num] = &bus->ring;
+                        pfd[num].fd = bus->ring.efd;
+                        pfd[num].events = POLLIN;
+                        pfd[num].revents = 0;
+                        num++;
+                    }
+                    
+                    continue;
+                }
+                bus->head_valid = 1;
+            }
+            if ((best == ENGINE_BUS_MAX) || (bus->head.timestamp < engine->bus[best].head.timestamp))
+            {
+                best = i;
+            }
+        }
+        
+        /* output the oldest event when no bus can produce an older one */
+        if ((best != ENGINE_BUS_MAX) && (engine->bus[best].head.timestamp <= bound))
+        {
+            *event = engine->bus[best].head;
+            engine->bus[best].head_valid = 0;
+            
+            return 0;
+        }
+        if (num == 0)
+        {
+            return 1;
+        }
+        
+        /* wait for the buses that hold the output back */
+        if (timeout < 0)
+        {
+            wait = -1;
+        }
+        else
+        {
+            now = ring_timestamp();
+            if (now >= deadline)
+            {
+                return 1;
+            }
+            wait = (int32_t)((deadline - now + 999999ULL) / 1000000ULL);
+        }
+        
+        /* a push only wakes a waiting consumer, an event pushed before the flag is taken at once */
+        for (i = 0; i < num; i++)
+        {
+            if (ring_wait_prepare(ring[i]) != 0)
+            {
+                break;
+            }
+        }
+        if (i == num)
+        {
+            res = poll(pfd, num, wait);
+        }
+        else
+        {
+            num = i + 1;
+            res = 0;
+        }
+        for (i = 0; i < num; i++)
+        {
+            ring_wait_finish(ring[i]);
+        }
+        if (res < 0)
+        {
+            return 1;
+        }
+        for (i = 0; (res > 0) && (i < num); i++)
+        {
+            if ((pfd[i].revents & POLLIN) != 0)
+            {
+                if (read(pfd[i].fd, &cnt, sizeof(uint64_t)) < 0)
+                {
+                    /* the counter is already cleared */
+                }
+            }
+        }
+    }
+}
+
+/**
+ * @brief      engine get the statistics of a bus
+ * @param[in]  *engine pointer to an engine structure
+ * @param[in]  bus bus index
+ * @param[out] *stats pointer to a statistics structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 get failed
+ * @note       it can be called while the workers are running
+ */
+uint8_t engine_get_stats(engine_t *engine, uint8_t bus, engine_stats_t *stats)
+{
+    engine_bus_t *b;
+    uint64_t end;
+    
+    if (bus >= engine->num)
+    {
+        return 1;
+    }
+    b = &engine->bus[bus];
+    
+    /* copy the counters */
+    stats->samples = __atomic_load_n(&b->samples, __ATOMIC_RELAXED);
+    stats->errors = __atomic_load_n(&b->errors, __ATOMIC_RELAXED);
+    stats->dropped = ring_get_dropped(&b->ring);
+    stats->busy_ns = __atomic_load_n(&b->busy_ns, __ATOMIC_RELAXED);
+    end = (engine->running != 0) ? ring_timestamp() : engine->stop_time;
+    stats->elapsed_ns = (end > engine->start) ? (end - engine->start) : 0;
+    if (stats->elapsed_ns != 0)
+    {
+        stats->utilization = (float)((double)stats->busy_ns * 100.0 / (double)stats->elapsed_ns);
+    }
+    else
+    {
+        stats->utilization = 0.0f;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     engine stop the workers and release the buses
+ * @param[in] *engine pointer to an engine structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop failed
+ * @note      the statistics stay readable after the stop
+ */
+uint8_t engine_deinit(engine_t *engine)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t j;
+    
+    /* stop the workers */
+    res = 0;
+    if (engine->running != 0)
+    {
+        __atomic_store_n(&engine->stop, 1, __ATOMIC_RELEASE);
+        for (i = 0; i < engine->num; i++)
+        {
+            if ((engine->bus[i].num != 0) && (pthread_join(engine->bus[i].pid, NULL) != 0))
+            {
+                perror("engine: join pthread failed.\n");
+                res = 1;
+            }
+        }
+        engine->stop_time = ring_timestamp();
+        engine->running = 0;
+    }
+    
+    /* release the devices and the buses */
+    for (i = 0; i < engine->num; i++)
+    {
+        engine_bus_t *bus = &engine->bus[i];
+        
+        for (j = 0; j < bus->num; j++)
+        {
+            (void)mcp9600_stop_continuous_read(&bus->handle[j]);
+            (void)mcp9600_deinit(&bus->handle[j]);
+        }
+        if (bus->opened != 0)
+        {
+            if (bus->transport.iic_deinit(bus->transport.user) != 0)
+            {
+                res = 1;
+            }
+            bus->opened = 0;
+            if (ring_deinit(&bus->ring) != 0)
+            {
+                res = 1;
+            }
+        }
+    }
+    
+    return res;
+}
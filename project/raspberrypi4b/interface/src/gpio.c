@@ -35,8 +35,13 @@
  */
 
 #include "gpio.h"
+#include "ring.h"
 #include <gpiod.h>
 #include <pthread.h>
+#include <string.h>
+#include <errno.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 
 /**
  * @brief gpio device name definition
@@ -48,64 +53,106 @@
  */
 #define GPIO_DEVICE_LINE 17                      /**< gpio device line */
 
+/**
+ * @brief gpio event batch definition
+ */
+#define GPIO_EVENT_BATCH 16                      /**< max events of one read */
+
+/**
+ * @brief gpio stop index definition
+ */
+#define GPIO_STOP_INDEX  0xFFFFFFFFU             /**< epoll index of the stop eventfd */
+
+/**
+ * @brief gpio line structure definition
+ */
+typedef struct gpio_line_s
+{
+    struct gpiod_line *line;        /**< gpio line handle */
+    gpio_handler_t handler;         /**< event handler */
+    void *user;                     /**< user context */
+} gpio_line_t;
+
 /**
  * @brief global var definition
  */
-static struct gpiod_chip *gs_chip;        /**< gpio chip handle */
-static struct gpiod_line *gs_line;        /**< gpio line handle */
-static pthread_t gs_pid;                  /**< gpio pthread pid */
-extern volatile uint8_t g_flag;           /**< interrupt flag */
+static struct gpiod_chip *gs_chip;                   /**< gpio chip handle */
+static gpio_line_t gs_line[GPIO_MAX_LINE];           /**< gpio line list */
+static uint32_t gs_line_num;                         /**< gpio line number */
+static int gs_epfd = -1;                             /**< epoll handle */
+static int gs_stop_fd = -1;                          /**< stop eventfd */
+static pthread_t gs_pid;                             /**< gpio pthread pid */
+extern ring_t g_ring;                                /**< event ring */
 
 /**
- * @brief  gpio interrupt pthread
+ * @brief  gpio event pthread
  * @param  *p pointer to an args buffer
  * @return NULL
  * @note   none
  */
-static void *a_gpio_interrupt_pthread(void *p)
+static void *a_gpio_event_pthread(void *p)
 {
-    int res;
-    struct gpiod_line_event event;
+    int n;
+    int i;
+    int j;
+    int num;
+    uint32_t index;
+    uint8_t edge;
+    uint64_t timestamp;
+    gpio_line_t *line;
+    struct epoll_event evs[GPIO_MAX_LINE + 1];
+    struct gpiod_line_event events[GPIO_EVENT_BATCH];
     
-    /* enable catching cancel signal */
-    pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
-
-    /* cancel the pthread at once */
-    pthread_setcanceltype(PTHREAD_CANCEL_ASYNCHRONOUS, NULL);
-
     /* loop */
     while (1)
     {
-        /* wait for the event */
-        res = gpiod_line_event_wait(gs_line, NULL);
-        if (res == 1)
+        /* wait for the ready lines */
+        n = epoll_wait(gs_epfd, evs, GPIO_MAX_LINE + 1, -1);
+        if (n < 0)
         {
-            /* read the event */
-            if (gpiod_line_event_read(gs_line, &event) != 0)
+            if (errno == EINTR)
             {
                 continue;
             }
+            perror("gpio: epoll wait failed.\n");
+            
+            return NULL;
+        }
+        
+        /* dispatch all ready lines */
+        for (i = 0; i < n; i++)
+        {
+            /* check the stop eventfd */
+            index = evs[i].data.u32;
+            if (index == GPIO_STOP_INDEX)
+            {
+                return NULL;
+            }
             
-            /* if the falling edge */
-            if (event.event_type == GPIOD_LINE_EVENT_FALLING_EDGE)
+            /* read the queued events in one batch */
+            line = &gs_line[index];
+            num = gpiod_line_event_read_multiple(line->line, events, GPIO_EVENT_BATCH);
+            for (j = 0; j < num; j++)
             {
-                /* set the flag */
-                g_flag = 1;
+                edge = (events[j].event_type == GPIOD_LINE_EVENT_RISING_EDGE) ? GPIO_EDGE_RISING : GPIO_EDGE_FALLING;
+                timestamp = (uint64_t)events[j].ts.tv_sec * 1000000000ULL + (uint64_t)events[j].ts.tv_nsec;
+                line->handler(line->user, gpiod_line_offset(line->line), edge, timestamp);
             }
         }
     }
 }
 
 /**
- * @brief  gpio interrupt init
+ * @brief  gpio event loop init
  * @return status code
  *         - 0 success
  *         - 1 init failed
- * @note   none
+ * @note   it opens the gpio chip and starts one event thread for all lines
  */
-uint8_t gpio_interrupt_init(void)
+uint8_t gpio_event_init(void)
 {
-    uint8_t res;
+    int res;
+    struct epoll_event ev;
     
     /* open the gpio group */
     gs_chip = gpiod_chip_open(GPIO_DEVICE_NAME);
@@ -115,61 +162,227 @@ uint8_t gpio_interrupt_init(void)
 
         return 1;
     }
+    gs_line_num = 0;
     
-    /* get the gpio line */
-    gs_line = gpiod_chip_get_line(gs_chip, GPIO_DEVICE_LINE);
-    if (gs_line == NULL) 
+    /* create the epoll */
+    gs_epfd = epoll_create1(EPOLL_CLOEXEC);
+    if (gs_epfd < 0)
     {
-        perror("gpio: get line failed.\n");
+        perror("gpio: epoll create failed.\n");
         gpiod_chip_close(gs_chip);
-
+        
         return 1;
     }
-
-    /* catch the falling edge */
-    if (gpiod_line_request_falling_edge_events(gs_line, "gpiointerrupt") < 0)
+    
+    /* create the stop eventfd */
+    gs_stop_fd = eventfd(0, EFD_CLOEXEC);
+    if (gs_stop_fd < 0)
     {
-        perror("gpio: set edge events failed.\n");
+        perror("gpio: eventfd failed.\n");
+        (void)close(gs_epfd);
         gpiod_chip_close(gs_chip);
-
+        
         return 1;
     }
-
-    /* creat a gpio interrupt pthread */
-    res = pthread_create(&gs_pid, NULL, a_gpio_interrupt_pthread, NULL);
+    memset(&ev, 0, sizeof(struct epoll_event));
+    ev.events = EPOLLIN;
+    ev.data.u32 = GPIO_STOP_INDEX;
+    if (epoll_ctl(gs_epfd, EPOLL_CTL_ADD, gs_stop_fd, &ev) < 0)
+    {
+        perror("gpio: epoll add failed.\n");
+        (void)close(gs_stop_fd);
+        (void)close(gs_epfd);
+        gpiod_chip_close(gs_chip);
+        
+        return 1;
+    }
+    
+    /* creat a gpio event pthread */
+    res = pthread_create(&gs_pid, NULL, a_gpio_event_pthread, NULL);
     if (res != 0)
     {
         perror("gpio: creat pthread failed.\n");
+        (void)close(gs_stop_fd);
+        (void)close(gs_epfd);
         gpiod_chip_close(gs_chip);
 
         return 1;
     }
+    
+    return 0;
+}
 
+/**
+ * @brief     gpio event loop add a line
+ * @param[in] line gpio line
+ * @param[in] edge watched edge
+ * @param[in] handler pointer to an event handler
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 add failed
+ * @note      the handler runs in the event thread, lines can be added while the loop runs
+ */
+uint8_t gpio_event_add(uint32_t line, gpio_edge_t edge, gpio_handler_t handler, void *user)
+{
+    int res;
+    struct epoll_event ev;
+    gpio_line_t *l;
+    
+    /* check the line number */
+    if ((gs_line_num >= GPIO_MAX_LINE) || (handler == NULL))
+    {
+        return 1;
+    }
+    
+    /* get the gpio line */
+    l = &gs_line[gs_line_num];
+    l->line = gpiod_chip_get_line(gs_chip, line);
+    if (l->line == NULL)
+    {
+        perror("gpio: get line failed.\n");
+        
+        return 1;
+    }
+    l->handler = handler;
+    l->user = user;
+    
+    /* catch the edge */
+    if (edge == GPIO_EDGE_FALLING)
+    {
+        res = gpiod_line_request_falling_edge_events(l->line, "gpiointerrupt");
+    }
+    else if (edge == GPIO_EDGE_RISING)
+    {
+        res = gpiod_line_request_rising_edge_events(l->line, "gpiointerrupt");
+    }
+    else
+    {
+        res = gpiod_line_request_both_edges_events(l->line, "gpiointerrupt");
+    }
+    if (res < 0)
+    {
+        perror("gpio: set edge events failed.\n");
+        
+        return 1;
+    }
+    
+    /* watch the line event fd */
+    memset(&ev, 0, sizeof(struct epoll_event));
+    ev.events = EPOLLIN;
+    ev.data.u32 = gs_line_num;
+    if (epoll_ctl(gs_epfd, EPOLL_CTL_ADD, gpiod_line_event_get_fd(l->line), &ev) < 0)
+    {
+        perror("gpio: epoll add failed.\n");
+        gpiod_line_release(l->line);
+        
+        return 1;
+    }
+    gs_line_num++;
+    
     return 0;
 }
 
 /**
- * @brief  gpio interrupt deinit
+ * @brief  gpio event loop deinit
  * @return status code
  *         - 0 success
  *         - 1 deinit failed
- * @note   none
+ * @note   it wakes up and joins the event thread, then releases all lines
  */
-uint8_t gpio_interrupt_deinit(void)
+uint8_t gpio_event_deinit(void)
 {
-    uint8_t res;
+    uint32_t i;
+    uint64_t one;
     
-    /* close the gpio interrupt pthread */
-    res = pthread_cancel(gs_pid);
-    if (res != 0)
+    /* wake up the gpio event pthread */
+    one = 1;
+    if (write(gs_stop_fd, &one, sizeof(uint64_t)) < 0)
     {
-        perror("gpio: delete pthread failed.\n");
-
+        perror("gpio: stop pthread failed.\n");
+        
         return 1;
     }
-
+    
+    /* wait for the gpio event pthread */
+    if (pthread_join(gs_pid, NULL) != 0)
+    {
+        perror("gpio: join pthread failed.\n");
+        
+        return 1;
+    }
+    
+    /* release all lines */
+    for (i = 0; i < gs_line_num; i++)
+    {
+        gpiod_line_release(gs_line[i].line);
+    }
+    gs_line_num = 0;
+    
     /* close the gpio */
+    (void)close(gs_stop_fd);
+    (void)close(gs_epfd);
+    gs_stop_fd = -1;
+    gs_epfd = -1;
     gpiod_chip_close(gs_chip);
     
     return 0;
 }
+
+/**
+ * @brief     gpio interrupt handler
+ * @param[in] *user pointer to a user context
+ * @param[in] line gpio line
+ * @param[in] edge gpio edge
+ * @param[in] timestamp kernel timestamp in ns
+ * @note      none
+ */
+static void a_gpio_interrupt_handler(void *user, uint32_t line, uint8_t edge, uint64_t timestamp)
+{
+    ring_event_t e;
+    
+    /* push the alert event */
+    memset(&e, 0, sizeof(ring_event_t));
+    e.timestamp = timestamp;
+    e.type = RING_EVENT_ALERT;
+    e.source = (uint8_t)line;
+    (void)ring_push(&g_ring, &e);
+}
+
+/**
+ * @brief  gpio interrupt init
+ * @return status code
+ *         - 0 success
+ *         - 1 init failed
+ * @note   it watches the falling edge of line 17 and pushes the alert events to g_ring
+ */
+uint8_t gpio_interrupt_init(void)
+{
+    /* start the event loop */
+    if (gpio_event_init() != 0)
+    {
+        return 1;
+    }
+    
+    /* catch the falling edge */
+    if (gpio_event_add(GPIO_DEVICE_LINE, GPIO_EDGE_FALLING, a_gpio_interrupt_handler, NULL) != 0)
+    {
+        (void)gpio_event_deinit();
+        
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief  gpio interrupt deinit
+ * @return status code
+ *         - 0 success
+ *         - 1 deinit failed
+ * @note   none
+ */
+uint8_t gpio_interrupt_deinit(void)
+{
+    return gpio_event_deinit();
+}
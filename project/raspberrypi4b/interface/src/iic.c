@@ -39,6 +39,7 @@
 #include <linux/i2c-dev.h>
 #include <sys/ioctl.h>
 #include <fcntl.h>
+#include <errno.h>
 
 /**
  * @brief      iic bus init
@@ -177,6 +178,120 @@ uint8_t iic_read(int fd, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
     return 0;
 }
 
+/**
+ * @brief      iic bus read several registers in one transfer
+ * @param[in]  fd iic handle
+ * @param[in]  addr iic device write address
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       addr = device_address_7bits << 1
+ *             the data of each register is stored one after another in buf
+ *             and num can't be over IIC_READ_BATCH_MAX, the registers are read
+ *             one by one when the adapter refuses a read that is not the last message
+ */
+uint8_t iic_read_batch(int fd, uint8_t addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    uint8_t addr_list[IIC_READ_BATCH_MAX];
+    uint8_t i;
+    
+    /* check the num */
+    if ((num == 0) || (num > IIC_READ_BATCH_MAX))
+    {
+        return 1;
+    }
+    
+    /* every register is read from the same device */
+    for (i = 0; i < num; i++)
+    {
+        addr_list[i] = addr;
+    }
+    
+    return iic_read_multi(fd, addr_list, reg, len, num, buf);
+}
+
+/**
+ * @brief      iic bus read registers of several devices in one transfer
+ * @param[in]  fd iic handle
+ * @param[in]  *addr pointer to an iic device write address list
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       addr = device_address_7bits << 1
+ *             register i is read from the device addr[i] and the data of each
+ *             register is stored one after another in buf, num can't be over IIC_READ_BATCH_MAX,
+ *             the registers are read one by one when the adapter refuses a read that is not the last message
+ */
+uint8_t iic_read_multi(int fd, uint8_t *addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    struct i2c_rdwr_ioctl_data i2c_rdwr_data;
+    struct i2c_msg msgs[IIC_READ_BATCH_MAX * 2];
+    uint16_t offset;
+    uint8_t i;
+    
+    /* check the num */
+    if ((num == 0) || (num > IIC_READ_BATCH_MAX))
+    {
+        return 1;
+    }
+    
+    /* clear ioctl data */
+    memset(&i2c_rdwr_data, 0, sizeof(struct i2c_rdwr_ioctl_data));
+    
+    /* clear msgs data */
+    memset(msgs, 0, sizeof(struct i2c_msg) * 2 * num);
+    
+    /* set the param */
+    offset = 0;
+    for (i = 0; i < num; i++)
+    {
+        msgs[i * 2 + 0].addr = addr[i] >> 1;
+        msgs[i * 2 + 0].flags = 0;
+        msgs[i * 2 + 0].buf = &reg[i];
+        msgs[i * 2 + 0].len = 1;
+        msgs[i * 2 + 1].addr = addr[i] >> 1;
+        msgs[i * 2 + 1].flags = I2C_M_RD;
+        msgs[i * 2 + 1].buf = buf + offset;
+        msgs[i * 2 + 1].len = len[i];
+        offset += len[i];
+    }
+    i2c_rdwr_data.msgs = msgs;
+    i2c_rdwr_data.nmsgs = num * 2;
+    
+    /* transmit */
+    if (ioctl(fd, I2C_RDWR, &i2c_rdwr_data) < 0)
+    {
+        /* some adapters only take a read as the last message, read the registers one by one */
+        if (errno == EOPNOTSUPP)
+        {
+            offset = 0;
+            for (i = 0; i < num; i++)
+            {
+                if (iic_read(fd, addr[i], reg[i], buf + offset, len[i]) != 0)
+                {
+                    return 1;
+                }
+                offset += len[i];
+            }
+            
+            return 0;
+        }
+        perror("iic: read multi failed.\n");
+        
+        return 1;
+    }
+     
+    return 0;
+}
+
 /**
  * @brief      iic bus read with 16 bits register address
  * @param[in]  fd iic handle
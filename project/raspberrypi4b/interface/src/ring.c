@@ -0,0 +1,309 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      ring.c
+ * @brief     ring source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "ring.h"
+#include <poll.h>
+#include <time.h>
+#include <string.h>
+#include <sys/eventfd.h>
+
+/**
+ * @brief     ring init
+ * @param[in] *ring pointer to a ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 init failed
+ * @note      none
+ */
+uint8_t ring_init(ring_t *ring)
+{
+    /* clear the ring */
+    memset(ring, 0, sizeof(ring_t));
+    
+    /* open the eventfd */
+    ring->efd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (ring->efd < 0)
+    {
+        perror("ring: eventfd failed.\n");
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     ring deinit
+ * @param[in] *ring pointer to a ring structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ * @note      none
+ */
+uint8_t ring_deinit(ring_t *ring)
+{
+    /* close the eventfd */
+    if (close(ring->efd) < 0)
+    {
+        perror("ring: close failed.\n");
+        
+        return 1;
+    }
+    ring->efd = -1;
+    
+    return 0;
+}
+
+/**
+ * @brief     ring push an event
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] *event pointer to an event structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 ring is full
+ * @note      only one producer thread can call it,
+ *            a full ring drops the new event and counts it in dropped,
+ *            the consumer is only woken up when it is waiting
+ */
+uint8_t ring_push(ring_t *ring, const ring_event_t *event)
+{
+    uint32_t head;
+    uint32_t tail;
+    
+    /* the producer owns head and acquires the consumer progress */
+    head = __atomic_load_n(&ring->head, __ATOMIC_RELAXED);
+    tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    
+    /* check full */
+    if ((head - tail) >= RING_SIZE)
+    {
+        __atomic_fetch_add(&ring->dropped, 1, __ATOMIC_RELAXED);
+        
+        return 1;
+    }
+    
+    /* copy the event and publish it before the waiting check, it pairs with ring_wait_prepare */
+    ring->buf[head & (RING_SIZE - 1)] = *event;
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_SEQ_CST);
+    
+    /* wake up the consumer only when it sleeps, a busy consumer sees the event on its next pop */
+    if (__atomic_load_n(&ring->waiting, __ATOMIC_SEQ_CST) != 0)
+    {
+        ring_notify(ring);
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     ring wake up the consumer
+ * @param[in] *ring pointer to a ring structure
+ * @note      the producer can call it to make the consumer check its state without an event
+ */
+void ring_notify(ring_t *ring)
+{
+    uint64_t one;
+    
+    one = 1;
+    if (write(ring->efd, &one, sizeof(uint64_t)) < 0)
+    {
+        /* the counter is saturated, the consumer is already woken up */
+    }
+}
+
+/**
+ * @brief     ring mark the consumer as waiting
+ * @param[in] *ring pointer to a ring structure
+ * @return    status code
+ *            - 0 the ring is empty and the consumer can sleep on efd
+ *            - 1 an event is ready
+ * @note      only one consumer thread can call it,
+ *            the consumer must call ring_wait_finish after it wakes up
+ */
+uint8_t ring_wait_prepare(ring_t *ring)
+{
+    /* set the flag before the last check, a push after the check sees the flag */
+    __atomic_store_n(&ring->waiting, 1, __ATOMIC_SEQ_CST);
+    
+    /* check the ring again */
+    if (__atomic_load_n(&ring->head, __ATOMIC_SEQ_CST) != 
+        __atomic_load_n(&ring->tail, __ATOMIC_RELAXED))
+    {
+        __atomic_store_n(&ring->waiting, 0, __ATOMIC_RELAXED);
+        
+        return 1;
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     ring clear the consumer waiting flag
+ * @param[in] *ring pointer to a ring structure
+ * @note      only one consumer thread can call it
+ */
+void ring_wait_finish(ring_t *ring)
+{
+    __atomic_store_n(&ring->waiting, 0, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief      ring pop an event
+ * @param[in]  *ring pointer to a ring structure
+ * @param[out] *event pointer to an event structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 ring is empty
+ * @note       only one consumer thread can call it
+ */
+uint8_t ring_pop(ring_t *ring, ring_event_t *event)
+{
+    uint32_t head;
+    uint32_t tail;
+    
+    /* the consumer owns tail and acquires the producer progress */
+    tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    
+    /* check empty */
+    if (head == tail)
+    {
+        return 1;
+    }
+    
+    /* copy the event and release the slot */
+    *event = ring->buf[tail & (RING_SIZE - 1)];
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+    
+    return 0;
+}
+
+/**
+ * @brief     ring wait for an event
+ * @param[in] *ring pointer to a ring structure
+ * @param[in] timeout timeout in ms, -1 means forever
+ * @return    status code
+ *            - 0 an event is ready
+ *            - 1 timeout or wait failed
+ * @note      only one consumer thread can call it
+ */
+uint8_t ring_wait(ring_t *ring, int32_t timeout)
+{
+    struct pollfd pfd;
+    uint64_t cnt;
+    uint64_t deadline;
+    uint64_t now;
+    int32_t wait;
+    int res;
+    
+    /* the timeout is counted from the call, not from each wakeup */
+    deadline = ring_timestamp() + (uint64_t)((timeout < 0) ? 0 : timeout) * 1000000ULL;
+    
+    /* loop */
+    while (1)
+    {
+        /* check the ring before sleeping */
+        if (__atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) != 
+            __atomic_load_n(&ring->tail, __ATOMIC_RELAXED))
+        {
+            return 0;
+        }
+        
+        /* get the time left */
+        if (timeout < 0)
+        {
+            wait = -1;
+        }
+        else
+        {
+            now = ring_timestamp();
+            if (now >= deadline)
+            {
+                return 1;
+            }
+            wait = (int32_t)((deadline - now + 999999ULL) / 1000000ULL);
+        }
+        
+        /* tell the producer to wake us up, an event pushed meanwhile is taken at once */
+        if (ring_wait_prepare(ring) != 0)
+        {
+            return 0;
+        }
+        
+        /* wait for the producer */
+        pfd.fd = ring->efd;
+        pfd.events = POLLIN;
+        pfd.revents = 0;
+        res = poll(&pfd, 1, wait);
+        ring_wait_finish(ring);
+        if (res <= 0)
+        {
+            return 1;
+        }
+        
+        /* clear the counter, the ring is checked again */
+        if (read(ring->efd, &cnt, sizeof(uint64_t)) < 0)
+        {
+            continue;
+        }
+    }
+}
+
+/**
+ * @brief     ring get the dropped event number
+ * @param[in] *ring pointer to a ring structure
+ * @return    dropped event number
+ * @note      none
+ */
+uint32_t ring_get_dropped(ring_t *ring)
+{
+    return __atomic_load_n(&ring->dropped, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief  ring get the monotonic timestamp
+ * @return timestamp in ns
+ * @note   none
+ */
+uint64_t ring_timestamp(void)
+{
+    struct timespec ts;
+    
+    /* get the monotonic time */
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
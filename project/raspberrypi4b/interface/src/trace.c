@@ -0,0 +1,436 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      trace.c
+ * @brief     trace source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "trace.h"
+#include <time.h>
+#include <string.h>
+
+/**
+ * @brief  trace get the monotonic timestamp
+ * @return timestamp in ns
+ * @note   none
+ */
+static uint64_t a_trace_timestamp(void)
+{
+    struct timespec ts;
+    
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief     trace append a record
+ * @param[in] *trace pointer to a trace structure
+ * @param[in] type record type
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      a record longer than TRACE_DATA_MAX is refused
+ */
+static uint8_t a_trace_put(trace_t *trace, uint8_t type, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    uint8_t head[8];
+    uint64_t now;
+    uint64_t us;
+    
+    /* check the length */
+    if (len > TRACE_DATA_MAX)
+    {
+        return 1;
+    }
+    
+    /* get the time since the last record */
+    now = a_trace_timestamp();
+    us = (now - trace->last) / 1000;
+    if (us > 0xFFFFFFFFULL)
+    {
+        us = 0xFFFFFFFFULL;
+    }
+    trace->last = now;
+    
+    /* write the record */
+    head[0] = type;
+    head[1] = addr;
+    head[2] = (uint8_t)(len & 0xFF);
+    head[3] = (uint8_t)((len >> 8) & 0xFF);
+    head[4] = (uint8_t)(us & 0xFF);
+    head[5] = (uint8_t)((us >> 8) & 0xFF);
+    head[6] = (uint8_t)((us >> 16) & 0xFF);
+    head[7] = (uint8_t)((us >> 24) & 0xFF);
+    if (fwrite(head, 1, 8, trace->fp) != 8)
+    {
+        return 1;
+    }
+    if ((len != 0) && (fwrite(buf, 1, len, trace->fp) != len))
+    {
+        return 1;
+    }
+    trace->count++;
+    
+    return 0;
+}
+
+/**
+ * @brief      trace take the next record
+ * @param[in]  *trace pointer to a trace structure
+ * @param[out] *type pointer to a record type buffer
+ * @param[out] *addr pointer to an iic device write address buffer
+ * @param[out] *buf pointer to a data buffer
+ * @param[out] *len pointer to a data length buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 end of the trace
+ * @note       it waits for the recorded time when the pacing is recorded
+ */
+static uint8_t a_trace_get(trace_t *trace, uint8_t *type, uint8_t *addr, uint8_t *buf, uint16_t *len)
+{
+    uint8_t head[8];
+    uint32_t us;
+    uint64_t now;
+    
+    /* read the record */
+    if (fread(head, 1, 8, trace->fp) != 8)
+    {
+        return 1;
+    }
+    *type = head[0];
+    *addr = head[1];
+    *len = (uint16_t)(head[2] | ((uint16_t)head[3] << 8));
+    us = (uint32_t)head[4] | ((uint32_t)head[5] << 8) | ((uint32_t)head[6] << 16) | ((uint32_t)head[7] << 24);
+    if (*len > TRACE_DATA_MAX)
+    {
+        return 1;
+    }
+    if ((*len != 0) && (fread(buf, 1, *len, trace->fp) != *len))
+    {
+        return 1;
+    }
+    trace->count++;
+    
+    /* keep the recorded pacing */
+    trace->offset += (uint64_t)us * 1000;
+    if (trace->pacing == TRACE_PACING_RECORDED)
+    {
+        now = a_trace_timestamp();
+        if (trace->last + trace->offset > now)
+        {
+            usleep((useconds_t)((trace->last + trace->offset - now) / 1000));
+        }
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief     trace open a file to record
+ * @param[in] *trace pointer to a trace structure
+ * @param[in] *path pointer to a trace file path
+ * @param[in] *transport pointer to the recorded transport
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed
+ * @note      none
+ */
+uint8_t trace_record_open(trace_t *trace, const char *path, const trace_transport_t *transport)
+{
+    uint8_t head[8] = {'M', 'C', 'P', 'T', TRACE_VERSION, 0, 0, 0};
+    
+    /* clear the trace */
+    memset(trace, 0, sizeof(trace_t));
+    trace->transport = *transport;
+    
+    /* open the file */
+    trace->fp = fopen(path, "wb");
+    if (trace->fp == NULL)
+    {
+        perror("trace: open failed.\n");
+        
+        return 1;
+    }
+    
+    /* write the header */
+    if (fwrite(head, 1, 8, trace->fp) != 8)
+    {
+        perror("trace: write failed.\n");
+        (void)fclose(trace->fp);
+        trace->fp = NULL;
+        
+        return 1;
+    }
+    trace->last = a_trace_timestamp();
+    
+    return 0;
+}
+
+/**
+ * @brief     trace open a file to replay
+ * @param[in] *trace pointer to a trace structure
+ * @param[in] *path pointer to a trace file path
+ * @param[in] pacing replay pacing
+ * @return    status code
+ *            - 0 success
+ *            - 1 open failed or the file is not a trace
+ * @note      none
+ */
+uint8_t trace_replay_open(trace_t *trace, const char *path, trace_pacing_t pacing)
+{
+    uint8_t head[8];
+    
+    /* clear the trace */
+    memset(trace, 0, sizeof(trace_t));
+    trace->replay = 1;
+    trace->pacing = (uint8_t)pacing;
+    
+    /* open the file */
+    trace->fp = fopen(path, "rb");
+    if (trace->fp == NULL)
+    {
+        perror("trace: open failed.\n");
+        
+        return 1;
+    }
+    
+    /* check the header */
+    if ((fread(head, 1, 8, trace->fp) != 8) || (memcmp(head, TRACE_MAGIC, 4) != 0) || (head[4] != TRACE_VERSION))
+    {
+        fprintf(stderr, "trace: %s is not a trace.\n", path);
+        (void)fclose(trace->fp);
+        trace->fp = NULL;
+        
+        return 1;
+    }
+    trace->last = a_trace_timestamp();
+    
+    return 0;
+}
+
+/**
+ * @brief     trace close the file
+ * @param[in] *trace pointer to a trace structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 close failed
+ * @note      none
+ */
+uint8_t trace_close(trace_t *trace)
+{
+    if (trace->fp == NULL)
+    {
+        return 0;
+    }
+    if (fclose(trace->fp) != 0)
+    {
+        perror("trace: close failed.\n");
+        trace->fp = NULL;
+        
+        return 1;
+    }
+    trace->fp = NULL;
+    
+    return 0;
+}
+
+/**
+ * @brief     trace iic bus init
+ * @param[in] *user pointer to a trace structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      it can be linked as iic_init_ctx
+ */
+uint8_t trace_iic_init(void *user)
+{
+    trace_t *trace = (trace_t *)user;
+    
+    if (trace->replay != 0)
+    {
+        return 0;
+    }
+    
+    return trace->transport.iic_init(trace->transport.user);
+}
+
+/**
+ * @brief     trace iic bus deinit
+ * @param[in] *user pointer to a trace structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      it can be linked as iic_deinit_ctx
+ */
+uint8_t trace_iic_deinit(void *user)
+{
+    trace_t *trace = (trace_t *)user;
+    
+    if (trace->replay != 0)
+    {
+        return 0;
+    }
+    
+    return trace->transport.iic_deinit(trace->transport.user);
+}
+
+/**
+ * @brief     trace iic bus write command
+ * @param[in] *user pointer to a trace structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      it can be linked as iic_write_cmd_ctx, a replayed write that differs
+ *            from the record is counted in mismatch
+ */
+uint8_t trace_iic_write_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    trace_t *trace = (trace_t *)user;
+    uint8_t res;
+    uint8_t type;
+    uint8_t record_addr;
+    uint16_t record_len;
+    uint8_t data[TRACE_DATA_MAX];
+    
+    /* record */
+    if (trace->replay == 0)
+    {
+        res = trace->transport.iic_write_cmd(trace->transport.user, addr, buf, len);
+        if (a_trace_put(trace, (uint8_t)(TRACE_TYPE_WRITE | ((res != 0) ? TRACE_TYPE_FAILED : 0)), addr, buf, len) != 0)
+        {
+            return 1;
+        }
+        
+        return res;
+    }
+    
+    /* replay */
+    if (a_trace_get(trace, &type, &record_addr, data, &record_len) != 0)
+    {
+        return 1;
+    }
+    if (((type & ~TRACE_TYPE_FAILED) != TRACE_TYPE_WRITE) || (record_addr != addr) || (record_len != len))
+    {
+        trace->mismatch++;
+        
+        return 1;
+    }
+    if (memcmp(data, buf, len) != 0)
+    {
+        trace->mismatch++;
+    }
+    
+    return ((type & TRACE_TYPE_FAILED) != 0) ? 1 : 0;
+}
+
+/**
+ * @brief      trace iic bus read command
+ * @param[in]  *user pointer to a trace structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it can be linked as iic_read_cmd_ctx
+ */
+uint8_t trace_iic_read_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    trace_t *trace = (trace_t *)user;
+    uint8_t res;
+    uint8_t type;
+    uint8_t record_addr;
+    uint16_t record_len;
+    uint8_t data[TRACE_DATA_MAX];
+    
+    /* record */
+    if (trace->replay == 0)
+    {
+        res = trace->transport.iic_read_cmd(trace->transport.user, addr, buf, len);
+        if (a_trace_put(trace, (uint8_t)(TRACE_TYPE_READ | ((res != 0) ? TRACE_TYPE_FAILED : 0)), addr, buf, len) != 0)
+        {
+            return 1;
+        }
+        
+        return res;
+    }
+    
+    /* replay */
+    if (a_trace_get(trace, &type, &record_addr, data, &record_len) != 0)
+    {
+        return 1;
+    }
+    if (((type & ~TRACE_TYPE_FAILED) != TRACE_TYPE_READ) || (record_addr != addr) || (record_len != len))
+    {
+        trace->mismatch++;
+        
+        return 1;
+    }
+    memcpy(buf, data, len);
+    
+    return ((type & TRACE_TYPE_FAILED) != 0) ? 1 : 0;
+}
+
+/**
+ * @brief     trace delay ms
+ * @param[in] *user pointer to a trace structure
+ * @param[in] ms time
+ * @note      it can be linked as delay_ms_ctx, the replay does not delay because
+ *            the recorded pacing already holds the time between the records
+ */
+void trace_delay_ms(void *user, uint32_t ms)
+{
+    trace_t *trace = (trace_t *)user;
+    
+    if (trace->replay == 0)
+    {
+        trace->transport.delay_ms(trace->transport.user, ms);
+    }
+}
+
+/**
+ * @brief     trace get the replay mismatch number
+ * @param[in] *trace pointer to a trace structure
+ * @return    mismatch number
+ * @note      none
+ */
+uint32_t trace_get_mismatch(trace_t *trace)
+{
+    return trace->mismatch;
+}
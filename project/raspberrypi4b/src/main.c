@@ -41,13 +41,112 @@
 #include "driver_mcp9600_shot.h"
 #include "driver_mcp9600_interrupt.h"
 #include "gpio.h"
+#include "iic.h"
+#include "ring.h"
+#include "trace.h"
+#include "engine.h"
 #include <getopt.h>
 #include <stdlib.h>
 
 /**
  * @brief global var definition
  */
-uint8_t volatile g_flag;            /**< interrupt flag */
+ring_t g_ring;                      /**< event ring */
+
+/**
+ * @brief      run a continuous read session on a trace
+ * @param[in]  *trace pointer to an opened trace
+ * @param[in]  addr iic device address
+ * @param[in]  type thermocouple type
+ * @param[in]  times read times
+ * @param[out] *ns pointer to a read time buffer in ns
+ * @return     status code
+ *             - 0 success
+ *             - 1 run failed
+ * @note       record and replay run the same session, so the replay asks for the recorded transfers
+ */
+static uint8_t a_trace_session(trace_t *trace, mcp9600_address_t addr, mcp9600_thermocouple_type_t type,
+                               uint32_t times, uint64_t *ns)
+{
+    uint8_t res;
+    uint32_t i;
+    uint64_t start;
+    mcp9600_handle_t handle;
+    
+    /* link the trace */
+    DRIVER_MCP9600_LINK_INIT(&handle, mcp9600_handle_t);
+    DRIVER_MCP9600_LINK_IIC_INIT_CTX(&handle, trace_iic_init);
+    DRIVER_MCP9600_LINK_IIC_DEINIT_CTX(&handle, trace_iic_deinit);
+    DRIVER_MCP9600_LINK_IIC_READ_COMMAND_CTX(&handle, trace_iic_read_cmd);
+    DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND_CTX(&handle, trace_iic_write_cmd);
+    DRIVER_MCP9600_LINK_IIC_DELAY_MS_CTX(&handle, trace_delay_ms);
+    DRIVER_MCP9600_LINK_DEBUG_PRINT(&handle, mcp9600_interface_debug_print);
+    DRIVER_MCP9600_LINK_USER(&handle, trace);
+    
+    /* init */
+    res = mcp9600_set_addr_pin(&handle, addr);
+    if (res != 0)
+    {
+        return 1;
+    }
+    res = mcp9600_init(&handle);
+    if (res != 0)
+    {
+        return 1;
+    }
+    res = mcp9600_set_thermocouple_type(&handle, type);
+    if (res != 0)
+    {
+        (void)mcp9600_deinit(&handle);
+        
+        return 1;
+    }
+    res = mcp9600_start_continuous_read(&handle);
+    if (res != 0)
+    {
+        (void)mcp9600_deinit(&handle);
+        
+        return 1;
+    }
+    
+    /* loop */
+    *ns = 0;
+    for (i = 0; i < times; i++)
+    {
+        int16_t hot_raw;
+        float hot_s;
+        int16_t delta_raw;
+        float delta_s;
+        int16_t cold_raw;
+        float cold_s;
+        
+        /* 1000 ms */
+        trace_delay_ms(trace, 1000);
+        
+        /* continuous read */
+        start = ring_timestamp();
+        res = mcp9600_continuous_read(&handle, (int16_t *)&hot_raw, (float *)&hot_s,
+                                      (int16_t *)&delta_raw, (float *)&delta_s,
+                                      (int16_t *)&cold_raw, (float *)&cold_s);
+        *ns += ring_timestamp() - start;
+        if (res != 0)
+        {
+            mcp9600_interface_debug_print("mcp9600: continuous read failed.\n");
+            (void)mcp9600_deinit(&handle);
+            
+            return 1;
+        }
+        
+        /* output */
+        mcp9600_interface_debug_print("mcp9600: %d/%d hot %0.2f delta %0.2f cold %0.2f.\n", times - i, times, hot_s, delta_s, cold_s);
+    }
+    
+    /* deinit */
+    (void)mcp9600_stop_continuous_read(&handle);
+    (void)mcp9600_deinit(&handle);
+    
+    return 0;
+}
 
 /**
  * @brief     mcp9600 full function
@@ -74,12 +173,18 @@ uint8_t mcp9600(uint8_t argc, char **argv)
         {"addr", required_argument, NULL, 1},
         {"times", required_argument, NULL, 2},
         {"type", required_argument, NULL, 3},
+        {"trace", required_argument, NULL, 4},
+        {"pacing", required_argument, NULL, 5},
+        {"bus", required_argument, NULL, 6},
         {NULL, 0, NULL, 0},
     };
     char type[33] = "unknown";
     uint32_t times = 3;
     mcp9600_address_t addr = MCP9600_ADDRESS_0;
     mcp9600_thermocouple_type_t chip_type = MCP9600_THERMOCOUPLE_TYPE_K;
+    char trace_path[257] = "mcp9600.trace";
+    trace_pacing_t pacing = TRACE_PACING_FULL_SPEED;
+    char bus_list[257] = "/dev/i2c-1";
     
     /* if no params */
     if (argc == 1)
@@ -162,6 +267,30 @@ uint8_t mcp9600(uint8_t argc, char **argv)
                 {
                     addr = MCP9600_ADDRESS_1;
                 }
+                else if (strcmp("2", optarg) == 0)
+                {
+                    addr = MCP9600_ADDRESS_2;
+                }
+                else if (strcmp("3", optarg) == 0)
+                {
+                    addr = MCP9600_ADDRESS_3;
+                }
+                else if (strcmp("4", optarg) == 0)
+                {
+                    addr = MCP9600_ADDRESS_4;
+                }
+                else if (strcmp("5", optarg) == 0)
+                {
+                    addr = MCP9600_ADDRESS_5;
+                }
+                else if (strcmp("6", optarg) == 0)
+                {
+                    addr = MCP9600_ADDRESS_6;
+                }
+                else if (strcmp("7", optarg) == 0)
+                {
+                    addr = MCP9600_ADDRESS_7;
+                }
                 else
                 {
                     return 5;
@@ -223,6 +352,46 @@ uint8_t mcp9600(uint8_t argc, char **argv)
                 break;
             }
             
+            /* trace */
+            case 4 :
+            {
+                /* set the trace path */
+                memset(trace_path, 0, sizeof(char) * 257);
+                snprintf(trace_path, 256, "%s", optarg);
+                
+                break;
+            }
+            
+            /* pacing */
+            case 5 :
+            {
+                /* set the pacing */
+                if (strcmp("full", optarg) == 0)
+                {
+                    pacing = TRACE_PACING_FULL_SPEED;
+                }
+                else if (strcmp("recorded", optarg) == 0)
+                {
+                    pacing = TRACE_PACING_RECORDED;
+                }
+                else
+                {
+                    return 5;
+                }
+                
+                break;
+            }
+            
+            /* bus */
+            case 6 :
+            {
+                /* set the bus list */
+                memset(bus_list, 0, sizeof(char) * 257);
+                strncpy(bus_list, optarg, 256);
+                
+                break;
+            }
+            
             /* the end */
             case -1 :
             {
@@ -320,6 +489,31 @@ uint8_t mcp9600(uint8_t argc, char **argv)
         
         return 0;
     }
+    else if (strcmp("e_scan", type) == 0)
+    {
+        uint8_t res;
+        uint8_t i;
+        uint8_t num;
+        mcp9600_address_t addr_list[8];
+        
+        /* basic scan */
+        res = mcp9600_basic_scan((mcp9600_address_t *)addr_list, (uint8_t *)&num);
+        if (res != 0)
+        {
+            mcp9600_interface_debug_print("mcp9600: basic scan failed.\n");
+            
+            return 1;
+        }
+        
+        /* output */
+        mcp9600_interface_debug_print("mcp9600: find %d chip(s).\n", num);
+        for (i = 0; i < num; i++)
+        {
+            mcp9600_interface_debug_print("mcp9600: find chip at 0x%02X.\n", addr_list[i]);
+        }
+        
+        return 0;
+    }
     else if (strcmp("e_shot", type) == 0)
     {
         uint8_t res;
@@ -371,11 +565,19 @@ uint8_t mcp9600(uint8_t argc, char **argv)
         uint8_t res;
         uint32_t i;
 
+        /* ring init */
+        res = ring_init(&g_ring);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
         /* gpio init */
-        g_flag = 0;
         res = gpio_interrupt_init();
         if (res != 0)
         {
+            (void)ring_deinit(&g_ring);
+            
             return 1;
         }
         
@@ -384,6 +586,7 @@ uint8_t mcp9600(uint8_t argc, char **argv)
         if (res != 0)
         {
             (void)gpio_interrupt_deinit();
+            (void)ring_deinit(&g_ring);
             
             return 1;
         }
@@ -395,6 +598,9 @@ uint8_t mcp9600(uint8_t argc, char **argv)
             mcp9600_interface_debug_print("mcp9600: interrupt clear failed.\n");
             (void)mcp9600_interrupt_deinit();
             (void)gpio_interrupt_deinit();
+            (void)ring_deinit(&g_ring);
+            
+            return 1;
         }
         res = mcp9600_interrupt_clear(MCP9600_ALERT_2);
         if (res != 0)
@@ -402,6 +608,9 @@ uint8_t mcp9600(uint8_t argc, char **argv)
             mcp9600_interface_debug_print("mcp9600: interrupt clear failed.\n");
             (void)mcp9600_interrupt_deinit();
             (void)gpio_interrupt_deinit();
+            (void)ring_deinit(&g_ring);
+            
+            return 1;
         }
         res = mcp9600_interrupt_clear(MCP9600_ALERT_3);
         if (res != 0)
@@ -409,6 +618,9 @@ uint8_t mcp9600(uint8_t argc, char **argv)
             mcp9600_interface_debug_print("mcp9600: interrupt clear failed.\n");
             (void)mcp9600_interrupt_deinit();
             (void)gpio_interrupt_deinit();
+            (void)ring_deinit(&g_ring);
+            
+            return 1;
         }
         res = mcp9600_interrupt_clear(MCP9600_ALERT_4);
         if (res != 0)
@@ -416,6 +628,9 @@ uint8_t mcp9600(uint8_t argc, char **argv)
             mcp9600_interface_debug_print("mcp9600: interrupt clear failed.\n");
             (void)mcp9600_interrupt_deinit();
             (void)gpio_interrupt_deinit();
+            (void)ring_deinit(&g_ring);
+            
+            return 1;
         }
         
         /* loop */
@@ -427,6 +642,7 @@ uint8_t mcp9600(uint8_t argc, char **argv)
             float delta_s;
             int16_t cold_raw;
             float cold_s;
+            ring_event_t event;
             
             /* interrupt read */
             res = mcp9600_interrupt_read((int16_t *)&hot_raw, (float *)&hot_s,
@@ -437,28 +653,209 @@ uint8_t mcp9600(uint8_t argc, char **argv)
                 mcp9600_interface_debug_print("mcp9600: interrupt read failed.\n");
                 (void)mcp9600_interrupt_deinit();
                 (void)gpio_interrupt_deinit();
+                (void)ring_deinit(&g_ring);
                 
                 return 1;
             }
             
-            /* 1000 ms */
-            mcp9600_interface_delay_ms(1000);
-            
             /* output */
             mcp9600_interface_debug_print("mcp9600: %d/%d hot %0.2f delta %0.2f cold %0.2f.\n", times - i, times, hot_s, delta_s, cold_s);
             
-            /* check the flag */
-            if (g_flag != 0)
+            /* wait 1000 ms for the alert event */
+            if (ring_wait(&g_ring, 1000) == 0)
             {
-                mcp9600_interface_debug_print("mcp9600: find interrupt.\n");
-                
-                break;
+                if ((ring_pop(&g_ring, &event) == 0) && (event.type == RING_EVENT_ALERT))
+                {
+#if (MCP9600_STATS != 0)
+                    mcp9600_latency_t latency;
+#endif
+                    uint32_t us;
+                    
+                    /* read after the alert */
+                    res = mcp9600_interrupt_event_read(event.timestamp, (int16_t *)&hot_raw, (float *)&hot_s,
+                                                       (int16_t *)&delta_raw, (float *)&delta_s,
+                                                       (int16_t *)&cold_raw, (float *)&cold_s, (uint32_t *)&us);
+                    if (res != 0)
+                    {
+                        mcp9600_interface_debug_print("mcp9600: interrupt event read failed.\n");
+                        (void)mcp9600_interrupt_deinit();
+                        (void)gpio_interrupt_deinit();
+                        (void)ring_deinit(&g_ring);
+                        
+                        return 1;
+                    }
+                    mcp9600_interface_debug_print("mcp9600: find interrupt hot %0.2f after %d us.\n", hot_s, us);
+                    
+#if (MCP9600_STATS != 0)
+                    /* output the latency */
+                    if (mcp9600_interrupt_get_latency(&latency) == 0)
+                    {
+                        mcp9600_interface_debug_print("mcp9600: latency p50 %d us p99 %d us max %d us.\n", 
+                                                      latency.p50_us, latency.p99_us, latency.max_us);
+                    }
+#endif
+                    
+                    break;
+                }
             }
         }
         
         /* deinit */
         (void)mcp9600_interrupt_deinit();
         (void)gpio_interrupt_deinit();
+        (void)ring_deinit(&g_ring);
+        
+        return 0;
+    }
+    else if (strcmp("e_record", type) == 0)
+    {
+        uint8_t res;
+        uint64_t ns;
+        trace_t trace;
+        iic_bus_t bus = {"/dev/i2c-1", -1};
+        trace_transport_t transport =
+        {
+            &bus,
+            mcp9600_interface_iic_init_ctx,
+            mcp9600_interface_iic_deinit_ctx,
+            mcp9600_interface_iic_write_cmd_ctx,
+            mcp9600_interface_iic_read_cmd_ctx,
+            mcp9600_interface_delay_ms_ctx,
+        };
+        
+        /* open the trace */
+        res = trace_record_open(&trace, trace_path, &transport);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* record the session */
+        res = a_trace_session(&trace, addr, chip_type, times, &ns);
+        (void)trace_close(&trace);
+        if (res != 0)
+        {
+            return 1;
+        }
+        mcp9600_interface_debug_print("mcp9600: record %d transfers to %s.\n", trace.count, trace_path);
+        
+        return 0;
+    }
+    else if (strcmp("e_replay", type) == 0)
+    {
+        uint8_t res;
+        uint64_t ns;
+        trace_t trace;
+        
+        /* open the trace */
+        res = trace_replay_open(&trace, trace_path, pacing);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* replay the session */
+        res = a_trace_session(&trace, addr, chip_type, times, &ns);
+        (void)trace_close(&trace);
+        if (res != 0)
+        {
+            return 1;
+        }
+        mcp9600_interface_debug_print("mcp9600: replay %d transfers with %d mismatch(es).\n", trace.count, trace_get_mismatch(&trace));
+        mcp9600_interface_debug_print("mcp9600: continuous read takes %d ns.\n", (times != 0) ? (uint32_t)(ns / times) : 0);
+        
+        return 0;
+    }
+    else if (strcmp("e_engine", type) == 0)
+    {
+        uint8_t res;
+        uint8_t i;
+        uint8_t num;
+        uint8_t index;
+        uint32_t n;
+        char *name;
+        char *save;
+        iic_bus_t bus[ENGINE_BUS_MAX];
+        static engine_t engine;
+        ring_event_t event;
+        engine_stats_t stats;
+        
+        /* poll every bus once a second */
+        res = engine_init(&engine, 1000);
+        if (res != 0)
+        {
+            return 1;
+        }
+        
+        /* add one chip on each bus */
+        num = 0;
+        for (name = strtok_r(bus_list, ",", &save); (name != NULL) && (num < ENGINE_BUS_MAX);
+             name = strtok_r(NULL, ",", &save))
+        {
+            engine_transport_t transport =
+            {
+                &bus[num],
+                mcp9600_interface_iic_init_ctx,
+                mcp9600_interface_iic_deinit_ctx,
+                mcp9600_interface_iic_write_cmd_ctx,
+                mcp9600_interface_iic_read_cmd_ctx,
+                mcp9600_interface_iic_read_ctx,
+                mcp9600_interface_iic_read_batch_ctx,
+                mcp9600_interface_delay_ms_ctx,
+            };
+            
+            bus[num].name = name;
+            bus[num].fd = -1;
+            res = engine_add_bus(&engine, &transport, &index);
+            if (res != 0)
+            {
+                (void)engine_deinit(&engine);
+                
+                return 1;
+            }
+            res = engine_add_device(&engine, index, addr, chip_type);
+            if (res != 0)
+            {
+                (void)engine_deinit(&engine);
+                
+                return 1;
+            }
+            num++;
+        }
+        
+        /* start one worker per bus */
+        res = engine_start(&engine);
+        if (res != 0)
+        {
+            (void)engine_deinit(&engine);
+            
+            return 1;
+        }
+        
+        /* output the merged stream */
+        for (n = 0; n < times * num; n++)
+        {
+            if (engine_read(&engine, &event, 3000) != 0)
+            {
+                mcp9600_interface_debug_print("mcp9600: engine read timeout.\n");
+                (void)engine_deinit(&engine);
+                
+                return 1;
+            }
+            mcp9600_interface_debug_print("mcp9600: %s %d ms hot %0.2f delta %0.2f cold %0.2f.\n", 
+                                          bus[event.source / ENGINE_DEVICE_MAX].name,
+                                          (uint32_t)((event.timestamp - engine.start) / 1000000ULL),
+                                          event.hot_s, event.delta_s, event.cold_s);
+        }
+        
+        /* stop and output the bus utilization */
+        (void)engine_deinit(&engine);
+        for (i = 0; i < num; i++)
+        {
+            (void)engine_get_stats(&engine, i, &stats);
+            mcp9600_interface_debug_print("mcp9600: %s %d samples %d errors %d dropped %0.3f%% busy.\n",
+                                          bus[i].name, stats.samples, stats.errors, stats.dropped, stats.utilization);
+        }
         
         return 0;
     }
@@ -469,23 +866,31 @@ uint8_t mcp9600(uint8_t argc, char **argv)
         mcp9600_interface_debug_print("  mcp9600 (-i | --information)\n");
         mcp9600_interface_debug_print("  mcp9600 (-h | --help)\n");
         mcp9600_interface_debug_print("  mcp9600 (-p | --port)\n");
-        mcp9600_interface_debug_print("  mcp9600 (-t reg | --test=reg) [--addr=<0 | 1>]\n");
-        mcp9600_interface_debug_print("  mcp9600 (-t read | --test=read) [--addr=<0 | 1>] [--times=<num>] [--type=<k | j | t | n | s | e | b | r>]\n");
-        mcp9600_interface_debug_print("  mcp9600 (-t int | --test=int) [--addr=<0 | 1>] [--type=<k | j | t | n | s | e | b | r>]\n");
-        mcp9600_interface_debug_print("  mcp9600 (-e read | --example=read) [--addr=<0 | 1>] [--times=<num>] [--type=<k | j | t | n | s | e | b | r>]\n");
-        mcp9600_interface_debug_print("  mcp9600 (-e shot | --example=shot) [--addr=<0 | 1>] [--times=<num>] [--type=<k | j | t | n | s | e | b | r>]\n");
-        mcp9600_interface_debug_print("  mcp9600 (-e int | --example=int) [--addr=<0 | 1>] [--times=<num>] [--type=<k | j | t | n | s | e | b | r>]\n");
+        mcp9600_interface_debug_print("  mcp9600 (-t reg | --test=reg) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>]\n");
+        mcp9600_interface_debug_print("  mcp9600 (-t read | --test=read) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>] [--times=<num>] [--type=<k | j | t | n | s | e | b | r>]\n");
+        mcp9600_interface_debug_print("  mcp9600 (-t int | --test=int) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>] [--type=<k | j | t | n | s | e | b | r>]\n");
+        mcp9600_interface_debug_print("  mcp9600 (-e read | --example=read) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>] [--times=<num>] [--type=<k | j | t | n | s | e | b | r>]\n");
+        mcp9600_interface_debug_print("  mcp9600 (-e shot | --example=shot) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>] [--times=<num>] [--type=<k | j | t | n | s | e | b | r>]\n");
+        mcp9600_interface_debug_print("  mcp9600 (-e int | --example=int) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>] [--times=<num>] [--type=<k | j | t | n | s | e | b | r>]\n");
+        mcp9600_interface_debug_print("  mcp9600 (-e scan | --example=scan)\n");
+        mcp9600_interface_debug_print("  mcp9600 (-e record | --example=record) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>] [--times=<num>] [--type=<k | j | t | n | s | e | b | r>] [--trace=<path>]\n");
+        mcp9600_interface_debug_print("  mcp9600 (-e replay | --example=replay) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>] [--times=<num>] [--type=<k | j | t | n | s | e | b | r>] [--trace=<path>] [--pacing=<full | recorded>]\n");
+        mcp9600_interface_debug_print("  mcp9600 (-e engine | --example=engine) [--addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>] [--times=<num>] [--type=<k | j | t | n | s | e | b | r>] [--bus=<path[,path]>]\n");
         mcp9600_interface_debug_print("\n");
         mcp9600_interface_debug_print("Options:\n");
-        mcp9600_interface_debug_print("      --addr=<0 | 1>               Set the addr pin.([default: 0])\n");
-        mcp9600_interface_debug_print("  -e <read | shot | int>, --example=<read | shot | int>\n");
+        mcp9600_interface_debug_print("      --addr=<0 | 1 | 2 | 3 | 4 | 5 | 6 | 7>\n");
+        mcp9600_interface_debug_print("                                   Set the addr pin.([default: 0])\n");
+        mcp9600_interface_debug_print("      --bus=<path[,path]>          Set the iic buses of the engine.([default: /dev/i2c-1])\n");
+        mcp9600_interface_debug_print("  -e <read | shot | int | scan | record | replay | engine>, --example=<read | shot | int | scan | record | replay | engine>\n");
         mcp9600_interface_debug_print("                                   Run the driver example.\n");
         mcp9600_interface_debug_print("  -h, --help                       Show the help.\n");
         mcp9600_interface_debug_print("  -i, --information                Show the chip information.\n");
         mcp9600_interface_debug_print("  -p, --port                       Display the pin connections of the current board.\n");
+        mcp9600_interface_debug_print("      --pacing=<full | recorded>   Set the replay pacing.([default: full])\n");
         mcp9600_interface_debug_print("  -t <reg | read | int>, --test=<reg | read | int>\n");
         mcp9600_interface_debug_print("                                   Run the driver test.\n");
         mcp9600_interface_debug_print("      --times=<num>                Set the running times.([default: 3])\n");
+        mcp9600_interface_debug_print("      --trace=<path>               Set the trace file.([default: mcp9600.trace])\n");
         mcp9600_interface_debug_print("      --type=<k | j | t | n | s | e | b | r>\n");
         mcp9600_interface_debug_print("                                   Set the thermocouple type.([default: k])\n");
         
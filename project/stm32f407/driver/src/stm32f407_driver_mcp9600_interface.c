@@ -94,6 +94,82 @@ uint8_t mcp9600_interface_iic_read_cmd(uint8_t addr, uint8_t *buf, uint16_t len)
     return iic_read_cmd(addr, buf, len);
 }
 
+/**
+ * @brief      interface iic bus read
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       write the register pointer and read the data in one repeated start transaction
+ */
+uint8_t mcp9600_interface_iic_read(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read several registers
+ * @param[in]  addr iic device write address
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the data of each register is stored one after another in buf
+ */
+uint8_t mcp9600_interface_iic_read_batch(uint8_t addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    uint8_t i;
+    uint16_t offset;
+    
+    offset = 0;
+    for (i = 0; i < num; i++)
+    {
+        if (iic_read(addr, reg[i], buf + offset, len[i]) != 0)
+        {
+            return 1;
+        }
+        offset += len[i];
+    }
+    
+    return 0;
+}
+
+/**
+ * @brief      interface iic bus read registers of several devices
+ * @param[in]  *addr pointer to an iic device write address list
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the data of each register is stored one after another in buf
+ */
+uint8_t mcp9600_interface_iic_read_multi(uint8_t *addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    uint8_t i;
+    uint16_t offset;
+    
+    offset = 0;
+    for (i = 0; i < num; i++)
+    {
+        if (iic_read(addr[i], reg[i], buf + offset, len[i]) != 0)
+        {
+            return 1;
+        }
+        offset += len[i];
+    }
+    
+    return 0;
+}
+
 /**
  * @brief     interface delay ms
  * @param[in] ms time
@@ -123,3 +199,146 @@ void mcp9600_interface_debug_print(const char *const fmt, ...)
     len = strlen((char *)str);
     (void)uart_write((uint8_t *)str, len);
 }
+
+/**
+ * @brief  interface get the monotonic timestamp
+ * @return timestamp in ns
+ * @note   the resolution is 1 ms
+ */
+uint64_t mcp9600_interface_timestamp(void)
+{
+    return (uint64_t)HAL_GetTick() * 1000000ULL;
+}
+
+/**
+ * @brief     interface iic bus init with a user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      none
+ */
+uint8_t mcp9600_interface_iic_init_ctx(void *user)
+{
+    return iic_init();
+}
+
+/**
+ * @brief     interface iic bus deinit with a user context
+ * @param[in] *user pointer to a user context
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ * @note      none
+ */
+uint8_t mcp9600_interface_iic_deinit_ctx(void *user)
+{
+    return iic_deinit();
+}
+
+/**
+ * @brief     interface iic bus write command with a user context
+ * @param[in] *user pointer to a user context
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+uint8_t mcp9600_interface_iic_write_cmd_ctx(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return iic_write_cmd(addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read command with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+uint8_t mcp9600_interface_iic_read_cmd_ctx(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    return iic_read_cmd(addr, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  addr iic device write address
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       write the register pointer and read the data in one repeated start transaction
+ */
+uint8_t mcp9600_interface_iic_read_ctx(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    return iic_read(addr, reg, buf, len);
+}
+
+/**
+ * @brief      interface iic bus read several registers with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  addr iic device write address
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the data of each register is stored one after another in buf
+ */
+uint8_t mcp9600_interface_iic_read_batch_ctx(void *user, uint8_t addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    return mcp9600_interface_iic_read_batch(addr, reg, len, num, buf);
+}
+
+/**
+ * @brief      interface iic bus read registers of several devices with a user context
+ * @param[in]  *user pointer to a user context
+ * @param[in]  *addr pointer to an iic device write address list
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the data of each register is stored one after another in buf
+ */
+uint8_t mcp9600_interface_iic_read_multi_ctx(void *user, uint8_t *addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    return mcp9600_interface_iic_read_multi(addr, reg, len, num, buf);
+}
+
+/**
+ * @brief     interface delay ms with a user context
+ * @param[in] *user pointer to a user context
+ * @param[in] ms time
+ * @note      none
+ */
+void mcp9600_interface_delay_ms_ctx(void *user, uint32_t ms)
+{
+    delay_ms(ms);
+}
+
+/**
+ * @brief     interface get the monotonic timestamp with a user context
+ * @param[in] *user pointer to a user context
+ * @return    timestamp in ns
+ * @note      the resolution is 1 ms
+ */
+uint64_t mcp9600_interface_timestamp_ctx(void *user)
+{
+    return (uint64_t)HAL_GetTick() * 1000000ULL;
+}
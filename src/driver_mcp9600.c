@@ -35,6 +35,9 @@
  */
 
 #include "driver_mcp9600.h"
+#if (MCP9600_STATIC_BINDING != 0)
+#include "driver_mcp9600_interface.h"
+#endif
 
 /**
  * @brief chip information definition
@@ -73,337 +76,1961 @@
 #define MCP9600_REG_DEVICE_ID_REVISON                        0x20        /**< device id/revision register */
 
 /**
- * @brief      read bytes
- * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @brief      get the register cache position
  * @param[in]  reg iic register address
- * @param[out] *data pointer to a data buffer
  * @param[in]  len data length
+ * @param[out] *index pointer to a cache index buffer
+ * @param[out] *offset pointer to a cache offset buffer
  * @return     status code
  *             - 0 success
- *             - 1 read failed
+ *             - 1 register is not cached
  * @note       none
  */
-static uint8_t a_mcp9600_iic_read(mcp9600_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+static uint8_t a_mcp9600_cache_position(uint8_t reg, uint16_t len, uint8_t *index, uint8_t *offset)
 {
-    uint8_t buf[1];
-    
-    buf[0] = reg;                                                               /* set reg */
-    if (handle->iic_write_cmd(handle->iic_addr, (uint8_t *)buf, 1) != 0)        /* write command */
-    {   
-        return 1;                                                               /* return error */
+    if (reg == MCP9600_REG_THERMOCOUPLE_SENSOR_CONFIGURATION)                                /* sensor configuration */
+    {
+        *index = 0;                                                                          /* set index 0 */
     }
-    if (handle->iic_read_cmd(handle->iic_addr, data, len) != 0)                 /* read data */
-    {   
-        return 1;                                                               /* return error */
+    else if (reg == MCP9600_REG_DEVICE_CONFIGURATION)                                        /* device configuration */
+    {
+        *index = 1;                                                                          /* set index 1 */
+    }
+    else if ((reg >= MCP9600_REG_ALERT1_CONFIGURATION) &&
+             (reg <= MCP9600_REG_TEMPERATURE_ALERT4_LIMIT))                                  /* alert registers */
+    {
+        *index = (uint8_t)(reg - MCP9600_REG_ALERT1_CONFIGURATION + 2);                      /* set index 2 - 13 */
+    }
+    else
+    {
+        return 1;                                                                            /* return error */
+    }
+    if (reg >= MCP9600_REG_TEMPERATURE_ALERT1_LIMIT)                                         /* 2 bytes limit registers */
+    {
+        if (len != 2)                                                                        /* check length */
+        {
+            return 1;                                                                        /* return error */
+        }
+        *offset = (uint8_t)(10 + (*index - 10) * 2);                                         /* set offset */
+    }
+    else
+    {
+        if (len != 1)                                                                        /* check length */
+        {
+            return 1;                                                                        /* return error */
+        }
+        *offset = *index;                                                                    /* set offset */
     }
     
-    return 0;                                                                   /* success return 0 */
+    return 0;                                                                                /* success return 0 */
 }
 
 /**
- * @brief     write bytes
+ * @brief     update the register cache
  * @param[in] *handle pointer to an mcp9600 handle structure
  * @param[in] reg iic register address
  * @param[in] *data pointer to a data buffer
  * @param[in] len data length
- * @return    status code
- *            - 0 success
- *            - 1 write failed
- * @note      none
+ * @note      the interrupt status bit of the alert configuration is never cached
  */
-static uint8_t a_mcp9600_iic_write(mcp9600_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+static void a_mcp9600_cache_update(mcp9600_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
 {
-    uint8_t buf[16];
+    uint8_t index;
+    uint8_t offset;
     uint16_t i;
-        
-    if ((len + 1) > 16)                                                             /* check length */
+    
+    if (handle->cache_enable == 0)                                                           /* check cache */
     {
-        return 1;                                                                   /* return error */
+        return;                                                                              /* return */
+    }
+    if (a_mcp9600_cache_position(reg, len, &index, &offset) != 0)                            /* get position */
+    {
+        for (i = 0; i < len; i++)                                                            /* check the covered registers */
+        {
+            if (a_mcp9600_cache_position((uint8_t)(reg + i), 1, &index, &offset) == 0)       /* partly cached */
+            {
+                handle->cache_valid = 0;                                                     /* drop the whole cache */
+                
+                return;                                                                      /* return */
+            }
+        }
+        
+        return;                                                                              /* return */
     }
-    buf[0] = reg;                                                                   /* set MSB of reg */
     for (i = 0; i < len; i++)
     {
-        buf[1 + i] = data[i];                                                       /* copy write data */
+        handle->cache[offset + i] = data[i];                                                 /* copy data */
     }
-    if (handle->iic_write_cmd(handle->iic_addr, (uint8_t *)buf, len + 1) != 0)      /* write iic command */
-    {   
-        return 1;                                                                   /* return error */
+    if ((reg >= MCP9600_REG_ALERT1_CONFIGURATION) &&
+        (reg <= MCP9600_REG_ALERT4_CONFIGURATION))                                           /* alert configuration */
+    {
+        handle->cache[offset] &= ~(1 << 7);                                                  /* clear interrupt bit */
     }
+    handle->cache_valid |= (uint16_t)(1 << index);                                           /* set valid */
+}
+
+/**
+ * @brief     call the linked iic_init
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic init failed
+ * @note      the context variant is used when it is linked
+ */
+static uint8_t a_mcp9600_bus_init(mcp9600_handle_t *handle)
+{
+#if (MCP9600_STATIC_BINDING != 0)
+    (void)handle;                                      /* unused by the default binding */
     
-    return 0;                                                                       /* success return 0 */
+    return MCP9600_BIND_IIC_INIT(handle->user);        /* iic init */
+#else
+    if (handle->iic_init_ctx != NULL)                  /* check iic_init_ctx */
+    {
+        return handle->iic_init_ctx(handle->user);     /* iic init */
+    }
+    
+    return handle->iic_init();                         /* iic init */
+#endif
 }
 
 /**
- * @brief     set the iic address pin
+ * @brief     call the linked iic_deinit
  * @param[in] *handle pointer to an mcp9600 handle structure
- * @param[in] addr_pin address pin
  * @return    status code
  *            - 0 success
- *            - 2 handle is NULL
- * @note      none
+ *            - 1 iic deinit failed
+ * @note      the context variant is used when it is linked
  */
-uint8_t mcp9600_set_addr_pin(mcp9600_handle_t *handle, mcp9600_address_t addr_pin)
+static uint8_t a_mcp9600_bus_deinit(mcp9600_handle_t *handle)
 {
-    if (handle == NULL)                          /* check handle */
+#if (MCP9600_STATIC_BINDING != 0)
+    (void)handle;                                        /* unused by the default binding */
+    
+    return MCP9600_BIND_IIC_DEINIT(handle->user);        /* iic deinit */
+#else
+    if (handle->iic_deinit_ctx != NULL)                  /* check iic_deinit_ctx */
     {
-        return 2;                                /* return error */
+        return handle->iic_deinit_ctx(handle->user);     /* iic deinit */
     }
     
-    handle->iic_addr = (uint8_t)addr_pin;        /* set pin */
+    return handle->iic_deinit();                         /* iic deinit */
+#endif
+}
+
+/**
+ * @brief     call the linked iic_write_cmd
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the context variant is used when it is linked
+ */
+static uint8_t a_mcp9600_bus_write_cmd(mcp9600_handle_t *handle, uint8_t *buf, uint16_t len)
+{
+#if (MCP9600_STATIC_BINDING != 0)
+    return MCP9600_BIND_IIC_WRITE_COMMAND(handle->user, handle->iic_addr, buf, len);   /* write command */
+#else
+    if (handle->iic_write_cmd_ctx != NULL)                                             /* check iic_write_cmd_ctx */
+    {
+        return handle->iic_write_cmd_ctx(handle->user, handle->iic_addr, buf, len);    /* write command */
+    }
     
-    return 0;                                    /* success return 0 */
+    return handle->iic_write_cmd(handle->iic_addr, buf, len);                          /* write command */
+#endif
 }
 
 /**
- * @brief      get the iic address pin
+ * @brief      call the linked iic_read_cmd
  * @param[in]  *handle pointer to an mcp9600 handle structure
- * @param[out] *addr_pin pointer to an address pin buffer
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
  * @return     status code
  *             - 0 success
- *             - 2 handle is NULL
- * @note       none
+ *             - 1 read failed
+ * @note       the context variant is used when it is linked
  */
-uint8_t mcp9600_get_addr_pin(mcp9600_handle_t *handle, mcp9600_address_t *addr_pin)
+static uint8_t a_mcp9600_bus_read_cmd(mcp9600_handle_t *handle, uint8_t *buf, uint16_t len)
 {
-    if (handle == NULL)                                       /* check handle */
+#if (MCP9600_STATIC_BINDING != 0)
+    return MCP9600_BIND_IIC_READ_COMMAND(handle->user, handle->iic_addr, buf, len);   /* read command */
+#else
+    if (handle->iic_read_cmd_ctx != NULL)                                             /* check iic_read_cmd_ctx */
     {
-        return 2;                                             /* return error */
+        return handle->iic_read_cmd_ctx(handle->user, handle->iic_addr, buf, len);    /* read command */
     }
     
-    *addr_pin = (mcp9600_address_t)(handle->iic_addr);        /* get pin */
-    
-    return 0;                                                 /* success return 0 */
+    return handle->iic_read_cmd(handle->iic_addr, buf, len);                          /* read command */
+#endif
 }
 
 /**
- * @brief     initialize the chip
+ * @brief     check whether iic_read is linked
  * @param[in] *handle pointer to an mcp9600 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 iic initialization failed
- *            - 2 handle is NULL
- *            - 3 linked functions is NULL
- *            - 4 id is invalid
- * @note      none
+ * @return    1 if it is linked, 0 if it is not linked
+ * @note      it is a constant in the static binding build
  */
-uint8_t mcp9600_init(mcp9600_handle_t *handle)
+static uint8_t a_mcp9600_bus_has_read(mcp9600_handle_t *handle)
 {
-    uint8_t res;
-    uint8_t buf[2];
+#if (MCP9600_STATIC_BINDING != 0)
+    (void)handle;                                                                       /* unused */
+  #if defined(MCP9600_BIND_IIC_READ)
+    return 1;                                                                           /* bound */
+  #else
+    return 0;                                                                           /* not bound */
+  #endif
+#else
+    return (uint8_t)((handle->iic_read_ctx != NULL) || (handle->iic_read != NULL));     /* check iic_read */
+#endif
+}
+
+/**
+ * @brief      call the linked iic_read
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[in]  reg iic register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the context variant is used when it is linked
+ */
+static uint8_t a_mcp9600_bus_read(mcp9600_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+#if (MCP9600_STATIC_BINDING != 0)
+  #if defined(MCP9600_BIND_IIC_READ)
+    return MCP9600_BIND_IIC_READ(handle->user, handle->iic_addr, reg, buf, len);     /* read in one transaction */
+  #else
+    (void)handle;                                                                    /* unused */
+    (void)reg;                                                                       /* unused */
+    (void)buf;                                                                       /* unused */
+    (void)len;                                                                       /* unused */
     
-    if (handle == NULL)                                                             /* check handle */
+    return 1;                                                                        /* not bound */
+  #endif
+#else
+    if (handle->iic_read_ctx != NULL)                                                /* check iic_read_ctx */
     {
-        return 2;                                                                   /* return error */
+        return handle->iic_read_ctx(handle->user, handle->iic_addr, reg, buf, len);  /* read in one transaction */
     }
-    if (handle->debug_print == NULL)                                                /* check debug_print */
+    
+    return handle->iic_read(handle->iic_addr, reg, buf, len);                        /* read in one transaction */
+#endif
+}
+
+/**
+ * @brief     check whether iic_read_batch is linked
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @return    1 if it is linked, 0 if it is not linked
+ * @note      it is a constant in the static binding build
+ */
+static uint8_t a_mcp9600_bus_has_read_batch(mcp9600_handle_t *handle)
+{
+#if (MCP9600_STATIC_BINDING != 0)
+    (void)handle;                                                                                   /* unused */
+  #if defined(MCP9600_BIND_IIC_READ_BATCH)
+    return 1;                                                                                       /* bound */
+  #else
+    return 0;                                                                                       /* not bound */
+  #endif
+#else
+    return (uint8_t)((handle->iic_read_batch_ctx != NULL) || (handle->iic_read_batch != NULL));     /* check iic_read_batch */
+#endif
+}
+
+/**
+ * @brief      call the linked iic_read_batch
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the context variant is used when it is linked
+ */
+static uint8_t a_mcp9600_bus_read_batch(mcp9600_handle_t *handle, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+{
+#if (MCP9600_STATIC_BINDING != 0)
+  #if defined(MCP9600_BIND_IIC_READ_BATCH)
+    return MCP9600_BIND_IIC_READ_BATCH(handle->user, handle->iic_addr, reg, len, num, buf);     /* read in one transfer */
+  #else
+    (void)handle;                                                                               /* unused */
+    (void)reg;                                                                                  /* unused */
+    (void)len;                                                                                  /* unused */
+    (void)num;                                                                                  /* unused */
+    (void)buf;                                                                                  /* unused */
+    
+    return 1;                                                                                   /* not bound */
+  #endif
+#else
+    if (handle->iic_read_batch_ctx != NULL)                                                     /* check iic_read_batch_ctx */
+    {
+        return handle->iic_read_batch_ctx(handle->user, handle->iic_addr, reg, len, num, buf);  /* read in one transfer */
+    }
+    
+    return handle->iic_read_batch(handle->iic_addr, reg, len, num, buf);                        /* read in one transfer */
+#endif
+}
+
+/**
+ * @brief     call the linked delay_ms
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @param[in] ms time
+ * @note      the context variant is used when it is linked
+ */
+static void a_mcp9600_delay_ms(mcp9600_handle_t *handle, uint32_t ms)
+{
+#if (MCP9600_STATIC_BINDING != 0)
+    (void)handle;                                      /* unused by the default binding */
+    MCP9600_BIND_DELAY_MS(handle->user, ms);           /* delay ms */
+#else
+    if (handle->delay_ms_ctx != NULL)                  /* check delay_ms_ctx */
     {
-        return 3;                                                                   /* return error */
+        handle->delay_ms_ctx(handle->user, ms);        /* delay ms */
+        
+        return;                                        /* return */
+    }
+    handle->delay_ms(ms);                              /* delay ms */
+#endif
+}
+
+/**
+ * @brief     take the bus for an indivisible register sequence
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @note      only the outermost call locks, so one register transaction inside a locked sequence
+ *            does not lock again, a handle must not be shared by threads at the same time
+ */
+static void a_mcp9600_bus_lock(mcp9600_handle_t *handle)
+{
+    if (handle->lock_depth == 0)                       /* check the outermost lock */
+    {
+#if (MCP9600_STATIC_BINDING != 0)
+  #if defined(MCP9600_BIND_BUS_LOCK)
+        MCP9600_BIND_BUS_LOCK(handle->user);           /* lock the bus */
+  #endif
+#else
+        if (handle->bus_lock != NULL)                  /* check bus_lock */
+        {
+            handle->bus_lock(handle->user);            /* lock the bus */
+        }
+#endif
+    }
+    handle->lock_depth++;                              /* depth++ */
+}
+
+/**
+ * @brief     release the bus after an indivisible register sequence
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @note      only the outermost call unlocks
+ */
+static void a_mcp9600_bus_unlock(mcp9600_handle_t *handle)
+{
+    handle->lock_depth--;                              /* depth-- */
+    if (handle->lock_depth == 0)                       /* check the outermost lock */
+    {
+#if (MCP9600_STATIC_BINDING != 0)
+  #if defined(MCP9600_BIND_BUS_UNLOCK)
+        MCP9600_BIND_BUS_UNLOCK(handle->user);         /* unlock the bus */
+  #endif
+#else
+        if (handle->bus_unlock != NULL)                /* check bus_unlock */
+        {
+            handle->bus_unlock(handle->user);          /* unlock the bus */
+        }
+#endif
     }
-    if (handle->iic_init == NULL)                                                   /* check iic_init */
+}
+
+#if (MCP9600_STATS != 0)
+/**
+ * @brief     call the linked timestamp
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @return    timestamp in ns
+ * @note      the context variant is used when it is linked
+ */
+static uint64_t a_mcp9600_timestamp(mcp9600_handle_t *handle)
+{
+    if (handle->timestamp_ctx != NULL)                       /* check timestamp_ctx */
     {
-        handle->debug_print("mcp9600: iic_init is null.\n");                        /* iic_init is null */
-       
-        return 3;                                                                   /* return error */
+        return handle->timestamp_ctx(handle->user);          /* get the time */
     }
-    if (handle->iic_deinit == NULL)                                                 /* check iic_deinit */
+    
+    return handle->timestamp();                              /* get the time */
+}
+
+/**
+ * @brief     get the latency histogram bucket
+ * @param[in] us latency in us
+ * @return    bucket index
+ * @note      none
+ */
+static uint32_t a_mcp9600_latency_bucket(uint32_t us)
+{
+    uint32_t i;
+    
+    i = 0;                                                                    /* bucket 0 */
+    while ((i < (MCP9600_LATENCY_BUCKET - 1)) && ((us >> (i + 1)) != 0))      /* find the bucket */
     {
-        handle->debug_print("mcp9600: iic_deinit is null.\n");                      /* iic_deinit is null */
-       
-        return 3;                                                                   /* return error */
+        i++;                                                                  /* next bucket */
     }
-    if (handle->iic_read_cmd == NULL)                                               /* check iic_read_cmd */
+    
+    return i;                                                                 /* return the bucket */
+}
+
+/**
+ * @brief     get a latency percentile from a histogram
+ * @param[in] *hist pointer to a latency histogram
+ * @param[in] max max latency in us
+ * @param[in] percent percentile
+ * @return    latency in us
+ * @note      none
+ */
+static uint32_t a_mcp9600_latency_percentile(const uint32_t *hist, uint32_t max, uint32_t percent)
+{
+    uint32_t i;
+    uint32_t sum;
+    uint32_t count;
+    uint32_t target;
+    uint32_t bound;
+    
+    count = 0;                                                                          /* init count */
+    for (i = 0; i < MCP9600_LATENCY_BUCKET; i++)                                        /* all buckets */
     {
-        handle->debug_print("mcp9600: iic_read_cmd is null.\n");                    /* iic_read_cmd is null */
-       
-        return 3;                                                                   /* return error */
+        count += hist[i];                                                               /* add count */
     }
-    if (handle->iic_write_cmd == NULL)                                              /* check iic_write_cmd */
+    if (count == 0)                                                                     /* check count */
     {
-        handle->debug_print("mcp9600: iic_write_cmd is null.\n");                   /* iic_write_cmd is null */
-       
-        return 3;                                                                   /* return error */
+        return 0;                                                                       /* no latency */
     }
-    if (handle->delay_ms == NULL)                                                   /* check delay_ms */
+    target = (uint32_t)(((uint64_t)count * percent + 99) / 100);                        /* round up */
+    sum = 0;                                                                            /* init sum */
+    for (i = 0; i < MCP9600_LATENCY_BUCKET; i++)                                        /* all buckets */
     {
-        handle->debug_print("mcp9600: delay_ms is null.\n");                        /* delay_ms is null */
-       
-        return 3;                                                                   /* return error */
+        sum += hist[i];                                                                 /* add count */
+        if (sum >= target)                                                              /* find the bucket */
+        {
+            break;                                                                      /* break */
+        }
     }
-    
-    if (handle->iic_init() != 0)                                                    /* iic init */
+    if ((i >= (MCP9600_LATENCY_BUCKET - 1)) || (i >= 31))                               /* check the last bucket */
     {
-        handle->debug_print("mcp9600: iic init failed.\n");                         /* iic init failed */
-       
-        return 1;                                                                   /* return error */
+        bound = 0xFFFFFFFFU;                                                            /* max bound */
     }
-    memset(buf, 0, sizeof(uint8_t) * 2);                                            /* clear the buffer */
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_ID_REVISON,
-                            (uint8_t *)buf, 2);                                     /* read device id */
-    if (res != 0)                                                                   /* check result */
+    else
     {
-        handle->debug_print("mcp9600: read device id failed.\n");                   /* read device id failed */
-        (void)handle->iic_deinit();                                                 /* iic deinit */
-        
-        return 1;                                                                   /* return error */
+        bound = (2U << i) - 1;                                                          /* bucket upper bound */
     }
-    if (buf[0] != 0x40)                                                             /* check id */
+    if (bound > max)                                                                    /* check max */
     {
-        handle->debug_print("mcp9600: id is invalid.\n");                           /* id is invalid */
-        (void)handle->iic_deinit();                                                 /* iic deinit */
-        
-        return 4;                                                                   /* return error */
+        bound = max;                                                                    /* cap by max */
     }
-    handle->inited = 1;                                                             /* set inited */
     
-    return 0;                                                                       /* success return 0 */
+    return bound;                                                                       /* return the bound */
 }
+#endif
 
 /**
- * @brief     close the chip
+ * @brief     get the transaction start time
  * @param[in] *handle pointer to an mcp9600 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 iic deinit failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- *            - 4 power down failed
- * @note      none
+ * @return    timestamp in ns
+ * @note      it returns 0 when the statistics are disabled or timestamp is null
  */
-uint8_t mcp9600_deinit(mcp9600_handle_t *handle)
+static uint64_t a_mcp9600_stats_start(mcp9600_handle_t *handle)
 {
-    uint8_t res;
-    uint8_t reg;
-    
-    if (handle == NULL)                                                                           /* check handle */
+#if (MCP9600_STATS != 0)
+    if ((handle->stats_enable == 0) || 
+        ((handle->timestamp == NULL) && (handle->timestamp_ctx == NULL)))  /* check stats */
     {
-        return 2;                                                                                 /* return error */
+        return 0;                                                          /* no start time */
     }
-    if (handle->inited != 1)                                                                      /* check handle initialization */
+    
+    return a_mcp9600_timestamp(handle);                                    /* return the start time */
+#else
+    (void)handle;                                                          /* not used */
+    
+    return 0;                                                              /* no statistics */
+#endif
+}
+
+/**
+ * @brief     record one transaction in the statistics
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @param[in] write 1 for a write transaction and 0 for a read transaction
+ * @param[in] *reg pointer to a register address list
+ * @param[in] *len pointer to a data length list
+ * @param[in] num register number
+ * @param[in] res transaction result
+ * @param[in] start transaction start time in ns
+ * @note      it does nothing when MCP9600_STATS is 0
+ */
+static void a_mcp9600_stats_record(mcp9600_handle_t *handle, uint8_t write, uint8_t *reg, uint16_t *len,
+                                   uint8_t num, uint8_t res, uint64_t start)
+{
+#if (MCP9600_STATS != 0)
+    uint8_t i;
+    uint32_t bytes;
+    uint64_t now;
+    uint64_t diff;
+    
+    if (handle->stats_enable == 0)                                                         /* check stats */
     {
-        return 3;                                                                                 /* return error */
+        return;                                                                            /* return */
     }
-    
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);       /* read config */
-    if (res != 0)                                                                                 /* check result */
+    bytes = 0;                                                                             /* init bytes */
+    for (i = 0; i < num; i++)                                                              /* all registers */
     {
-        handle->debug_print("mcp9600: power down failed.\n");                                     /* power down failed */
-       
-        return 4;                                                                                 /* return error */
+        bytes += len[i];                                                                   /* add length */
+        if (reg[i] < MCP9600_STATS_REGISTER)                                               /* check the register */
+        {
+            handle->stats.reg_count[reg[i]]++;                                             /* count the register */
+        }
     }
+    if (write != 0)                                                                        /* write */
+    {
+        handle->stats.write_count++;                                                       /* count++ */
+        if (res != 0)                                                                      /* check result */
+        {
+            handle->stats.write_failed++;                                                  /* failed++ */
+        }
+        else
+        {
+            handle->stats.write_bytes += bytes;                                            /* add bytes */
+        }
+    }
+    else
+    {
+        handle->stats.read_count++;                                                        /* count++ */
+        if (res != 0)                                                                      /* check result */
+        {
+            handle->stats.read_failed++;                                                   /* failed++ */
+        }
+        else
+        {
+            handle->stats.read_bytes += bytes;                                             /* add bytes */
+        }
+    }
+    if ((handle->timestamp != NULL) || (handle->timestamp_ctx != NULL))                    /* check timestamp */
+    {
+        now = a_mcp9600_timestamp(handle);                                                 /* get the end time */
+        diff = (now > start) ? ((now - start) / 1000) : 0;                                 /* get the latency in us */
+        if (diff > 0xFFFFFFFFU)                                                            /* check the range */
+        {
+            diff = 0xFFFFFFFFU;                                                            /* saturate */
+        }
+        handle->stats.latency_hist[a_mcp9600_latency_bucket((uint32_t)diff)]++;            /* count the latency */
+        if ((uint32_t)diff > handle->stats.latency_max_us)                                 /* check max */
+        {
+            handle->stats.latency_max_us = (uint32_t)diff;                                 /* set max */
+        }
+    }
+#else
+    (void)handle;                                                                          /* not used */
+    (void)write;                                                                           /* not used */
+    (void)reg;                                                                             /* not used */
+    (void)len;                                                                             /* not used */
+    (void)num;                                                                             /* not used */
+    (void)res;                                                                             /* not used */
+    (void)start;                                                                           /* not used */
+#endif
+}
+
+/**
+ * @brief      read bytes in one transfer
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[in]  reg iic register address
+ * @param[out] *data pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the linked iic_read is used when it is available
+ */
+static uint8_t a_mcp9600_iic_read_transfer(mcp9600_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+{
+    uint8_t buf[1];
+    
+    if (a_mcp9600_bus_has_read(handle) != 0)                                                   /* check iic_read */
+    {
+        if (a_mcp9600_bus_read(handle, reg, data, len) != 0)                                   /* read in one transaction */
+        {
+            return 1;                                                                          /* return error */
+        }
+        a_mcp9600_cache_update(handle, reg, data, len);                                        /* update cache */
+        
+        return 0;                                                                              /* success return 0 */
+    }
+    buf[0] = reg;                                                                              /* set reg */
+    if (a_mcp9600_bus_write_cmd(handle, (uint8_t *)buf, 1) != 0)                               /* write command */
+    {   
+        return 1;                                                                              /* return error */
+    }
+    if (a_mcp9600_bus_read_cmd(handle, data, len) != 0)                                        /* read data */
+    {   
+        return 1;                                                                              /* return error */
+    }
+    a_mcp9600_cache_update(handle, reg, data, len);                                            /* update cache */
+    
+    return 0;                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      read bytes
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[in]  reg iic register address
+ * @param[out] *data pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the transaction is recorded when the statistics are enabled
+ */
+static uint8_t a_mcp9600_iic_read(mcp9600_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+{
+    uint8_t res;
+    uint64_t start;
+    
+    a_mcp9600_bus_lock(handle);                                               /* lock the bus */
+    start = a_mcp9600_stats_start(handle);                                    /* get the start time */
+    res = a_mcp9600_iic_read_transfer(handle, reg, data, len);                /* read data */
+    a_mcp9600_stats_record(handle, 0, &reg, &len, 1, res, start);             /* record the transaction */
+    a_mcp9600_bus_unlock(handle);                                             /* unlock the bus */
+    
+    return res;                                                               /* return the result */
+}
+
+/**
+ * @brief      read several registers
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *data pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the linked iic_read_batch is used when it is available,
+ *             the registers are read one by one when it is not linked or the adapter refuses the combined transfer
+ */
+static uint8_t a_mcp9600_iic_read_batch(mcp9600_handle_t *handle, uint8_t *reg, uint16_t *len,
+                                        uint8_t num, uint8_t *data)
+{
+    uint8_t res;
+    uint8_t i;
+    uint16_t offset;
+    uint64_t start;
+    
+    if (a_mcp9600_bus_has_read_batch(handle) != 0)                                                     /* check iic_read_batch */
+    {
+        a_mcp9600_bus_lock(handle);                                                                    /* lock the bus */
+        start = a_mcp9600_stats_start(handle);                                                         /* get the start time */
+        res = a_mcp9600_bus_read_batch(handle, reg, len, num, data);                                   /* read in one transfer */
+        a_mcp9600_stats_record(handle, 0, reg, len, num, res, start);                                  /* record the transaction */
+        a_mcp9600_bus_unlock(handle);                                                                  /* unlock the bus */
+        if (res == 0)                                                                                  /* check result */
+        {
+            offset = 0;                                                                                /* init offset */
+            for (i = 0; i < num; i++)
+            {
+                a_mcp9600_cache_update(handle, reg[i], data + offset, len[i]);                         /* update cache */
+                offset += len[i];                                                                      /* next register */
+            }
+            
+            return 0;                                                                                  /* success return 0 */
+        }
+    }
+    offset = 0;                                                                                        /* init offset */
+    a_mcp9600_bus_lock(handle);                                                                        /* lock the bus */
+    for (i = 0; i < num; i++)
+    {
+        if (a_mcp9600_iic_read(handle, reg[i], data + offset, len[i]) != 0)                            /* read one by one */
+        {
+            a_mcp9600_bus_unlock(handle);                                                              /* unlock the bus */
+            
+            return 1;                                                                                  /* return error */
+        }
+        offset += len[i];                                                                              /* next register */
+    }
+    a_mcp9600_bus_unlock(handle);                                                                      /* unlock the bus */
+    
+    return 0;                                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     write bytes
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @param[in] reg iic register address
+ * @param[in] *data pointer to a data buffer
+ * @param[in] len data length
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      none
+ */
+static uint8_t a_mcp9600_iic_write(mcp9600_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+{
+    uint8_t res;
+    uint8_t buf[16];
+    uint16_t i;
+    uint64_t start;
+        
+    if ((len + 1) > 16)                                                             /* check length */
+    {
+        return 1;                                                                   /* return error */
+    }
+    buf[0] = reg;                                                                   /* set MSB of reg */
+    for (i = 0; i < len; i++)
+    {
+        buf[1 + i] = data[i];                                                       /* copy write data */
+    }
+    a_mcp9600_bus_lock(handle);                                                     /* lock the bus */
+    start = a_mcp9600_stats_start(handle);                                          /* get the start time */
+    res = a_mcp9600_bus_write_cmd(handle, (uint8_t *)buf, len + 1);                 /* write iic command */
+    a_mcp9600_stats_record(handle, 1, &reg, &len, 1, res, start);                   /* record the transaction */
+    a_mcp9600_bus_unlock(handle);                                                   /* unlock the bus */
+    if (res != 0)                                                                   /* check result */
+    {   
+        return 1;                                                                   /* return error */
+    }
+    a_mcp9600_cache_update(handle, reg, data, len);                                 /* write through cache */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief      read bytes through the register cache
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[in]  reg iic register address
+ * @param[out] *data pointer to a data buffer
+ * @param[in]  len data length
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       the device configuration is read from the chip while a burst is pending,
+ *             because the chip returns to shutdown mode by itself
+ */
+static uint8_t a_mcp9600_cache_read(mcp9600_handle_t *handle, uint8_t reg, uint8_t *data, uint16_t len)
+{
+    uint8_t index;
+    uint8_t offset;
+    uint16_t i;
+    
+    if ((handle->cache_enable == 0) ||
+        (a_mcp9600_cache_position(reg, len, &index, &offset) != 0) ||
+        ((handle->cache_valid & (1 << index)) == 0))                                   /* check cache */
+    {
+        return a_mcp9600_iic_read(handle, reg, data, len);                             /* read from the chip */
+    }
+    if ((reg == MCP9600_REG_DEVICE_CONFIGURATION) &&
+        ((handle->cache[offset] & 0x3) == MCP9600_MODE_BURST))                         /* burst mode is volatile */
+    {
+        return a_mcp9600_iic_read(handle, reg, data, len);                             /* read from the chip */
+    }
+    for (i = 0; i < len; i++)
+    {
+        data[i] = handle->cache[offset + i];                                           /* copy data */
+    }
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     load the register cache from the chip
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 read failed
+ * @note      none
+ */
+static uint8_t a_mcp9600_cache_load(mcp9600_handle_t *handle)
+{
+    uint8_t reg;
+    uint8_t buf[2];
+    
+    handle->cache_valid = 0;                                                           /* clear valid */
+    for (reg = MCP9600_REG_THERMOCOUPLE_SENSOR_CONFIGURATION;
+         reg <= MCP9600_REG_TEMPERATURE_ALERT4_LIMIT; reg++)                           /* all cached registers */
+    {
+        if (reg == 0x07)                                                               /* skip the reserved register */
+        {
+            continue;                                                                  /* continue */
+        }
+        if (a_mcp9600_iic_read(handle, reg, (uint8_t *)buf,
+                               (reg >= MCP9600_REG_TEMPERATURE_ALERT1_LIMIT) ? 2 : 1) != 0)       /* read and update cache */
+        {
+            handle->cache_valid = 0;                                                   /* clear valid */
+            
+            return 1;                                                                  /* return error */
+        }
+    }
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     get the expected burst conversion time
+ * @param[in] config device configuration register
+ * @return    conversion time in ms
+ * @note      18 bit 320 ms, 16 bit 80 ms, 14 bit 20 ms and 12 bit 5 ms per sample
+ */
+static uint32_t a_mcp9600_conversion_time(uint8_t config)
+{
+    const uint32_t sample_ms[4] = {320, 80, 20, 5};
+    
+    return sample_ms[(config >> 5) & 0x3] << ((config >> 2) & 0x7);        /* sample time * burst samples */
+}
+
+/**
+ * @brief     set the iic address pin
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @param[in] addr_pin address pin
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t mcp9600_set_addr_pin(mcp9600_handle_t *handle, mcp9600_address_t addr_pin)
+{
+    if (handle == NULL)                          /* check handle */
+    {
+        return 2;                                /* return error */
+    }
+    
+    handle->iic_addr = (uint8_t)addr_pin;        /* set pin */
+    
+    return 0;                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the iic address pin
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *addr_pin pointer to an address pin buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t mcp9600_get_addr_pin(mcp9600_handle_t *handle, mcp9600_address_t *addr_pin)
+{
+    if (handle == NULL)                                       /* check handle */
+    {
+        return 2;                                             /* return error */
+    }
+    
+    *addr_pin = (mcp9600_address_t)(handle->iic_addr);        /* get pin */
+    
+    return 0;                                                 /* success return 0 */
+}
+
+/**
+ * @brief      scan the iic bus for chips
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *addr pointer to an address list buffer with at least 8 members
+ * @param[out] *num pointer to a found number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 iic initialization failed
+ *             - 2 handle is NULL
+ *             - 3 linked functions is NULL
+ * @note       it reads the device id at all the 8 addresses in one pass,
+ *             the bus is opened and closed here when the handle is not initialized
+ */
+uint8_t mcp9600_scan(mcp9600_handle_t *handle, mcp9600_address_t *addr, uint8_t *num)
+{
+    uint8_t i;
+    uint8_t iic_addr;
+    uint8_t buf[2];
+    
+    if (handle == NULL)                                                                   /* check handle */
+    {
+        return 2;                                                                         /* return error */
+    }
+    if (handle->debug_print == NULL)                                                      /* check debug_print */
+    {
+        return 3;                                                                         /* return error */
+    }
+#if (MCP9600_STATIC_BINDING == 0)
+    if ((handle->iic_init == NULL) && (handle->iic_init_ctx == NULL))                     /* check iic_init */
+    {
+        handle->debug_print("mcp9600: iic_init is null.\n");                              /* iic_init is null */
+       
+        return 3;                                                                         /* return error */
+    }
+    if ((handle->iic_deinit == NULL) && (handle->iic_deinit_ctx == NULL))                 /* check iic_deinit */
+    {
+        handle->debug_print("mcp9600: iic_deinit is null.\n");                            /* iic_deinit is null */
+       
+        return 3;                                                                         /* return error */
+    }
+    if ((handle->iic_read_cmd == NULL) && (handle->iic_read_cmd_ctx == NULL))             /* check iic_read_cmd */
+    {
+        handle->debug_print("mcp9600: iic_read_cmd is null.\n");                          /* iic_read_cmd is null */
+       
+        return 3;                                                                         /* return error */
+    }
+    if ((handle->iic_write_cmd == NULL) && (handle->iic_write_cmd_ctx == NULL))           /* check iic_write_cmd */
+    {
+        handle->debug_print("mcp9600: iic_write_cmd is null.\n");                         /* iic_write_cmd is null */
+       
+        return 3;                                                                         /* return error */
+    }
+#endif
+    
+    if (handle->inited != 1)                                                              /* check handle initialization */
+    {
+        if (a_mcp9600_bus_init(handle) != 0)                                              /* iic init */
+        {
+            handle->debug_print("mcp9600: iic init failed.\n");                           /* iic init failed */
+           
+            return 1;                                                                     /* return error */
+        }
+    }
+    iic_addr = handle->iic_addr;                                                          /* save address */
+    *num = 0;                                                                             /* init num */
+    for (i = 0; i < 8; i++)                                                               /* all addresses */
+    {
+        handle->iic_addr = (uint8_t)(MCP9600_ADDRESS_0 + i * 2);                          /* set address */
+        memset(buf, 0, sizeof(uint8_t) * 2);                                              /* clear the buffer */
+        if (a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_ID_REVISON,
+                               (uint8_t *)buf, 2) != 0)                                   /* read device id */
+        {
+            continue;                                                                     /* no ack */
+        }
+        if (buf[0] == 0x40)                                                               /* check id */
+        {
+            addr[*num] = (mcp9600_address_t)(handle->iic_addr);                           /* save found address */
+            (*num)++;                                                                     /* num++ */
+        }
+    }
+    handle->iic_addr = iic_addr;                                                          /* restore address */
+    if (handle->inited != 1)                                                              /* check handle initialization */
+    {
+        (void)a_mcp9600_bus_deinit(handle);                                               /* iic deinit */
+    }
+    
+    return 0;                                                                             /* success return 0 */
+}
+
+/**
+ * @brief     initialize the chip
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic initialization failed
+ *            - 2 handle is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 id is invalid
+ * @note      none
+ */
+uint8_t mcp9600_init(mcp9600_handle_t *handle)
+{
+    uint8_t res;
+    uint8_t buf[2];
+    
+    if (handle == NULL)                                                             /* check handle */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (handle->debug_print == NULL)                                                /* check debug_print */
+    {
+        return 3;                                                                   /* return error */
+    }
+#if (MCP9600_STATIC_BINDING == 0)
+    if ((handle->iic_init == NULL) && (handle->iic_init_ctx == NULL))               /* check iic_init */
+    {
+        handle->debug_print("mcp9600: iic_init is null.\n");                        /* iic_init is null */
+       
+        return 3;                                                                   /* return error */
+    }
+    if ((handle->iic_deinit == NULL) && (handle->iic_deinit_ctx == NULL))           /* check iic_deinit */
+    {
+        handle->debug_print("mcp9600: iic_deinit is null.\n");                      /* iic_deinit is null */
+       
+        return 3;                                                                   /* return error */
+    }
+    if ((handle->iic_read_cmd == NULL) && (handle->iic_read_cmd_ctx == NULL))       /* check iic_read_cmd */
+    {
+        handle->debug_print("mcp9600: iic_read_cmd is null.\n");                    /* iic_read_cmd is null */
+       
+        return 3;                                                                   /* return error */
+    }
+    if ((handle->iic_write_cmd == NULL) && (handle->iic_write_cmd_ctx == NULL))     /* check iic_write_cmd */
+    {
+        handle->debug_print("mcp9600: iic_write_cmd is null.\n");                   /* iic_write_cmd is null */
+       
+        return 3;                                                                   /* return error */
+    }
+    if ((handle->delay_ms == NULL) && (handle->delay_ms_ctx == NULL))               /* check delay_ms */
+    {
+        handle->debug_print("mcp9600: delay_ms is null.\n");                        /* delay_ms is null */
+       
+        return 3;                                                                   /* return error */
+    }
+#endif
+    
+    if (a_mcp9600_bus_init(handle) != 0)                                            /* iic init */
+    {
+        handle->debug_print("mcp9600: iic init failed.\n");                         /* iic init failed */
+       
+        return 1;                                                                   /* return error */
+    }
+    memset(buf, 0, sizeof(uint8_t) * 2);                                            /* clear the buffer */
+    res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_ID_REVISON,
+                            (uint8_t *)buf, 2);                                     /* read device id */
+    if (res != 0)                                                                   /* check result */
+    {
+        handle->debug_print("mcp9600: read device id failed.\n");                   /* read device id failed */
+        (void)a_mcp9600_bus_deinit(handle);                                         /* iic deinit */
+        
+        return 1;                                                                   /* return error */
+    }
+    if (buf[0] != 0x40)                                                             /* check id */
+    {
+        handle->debug_print("mcp9600: id is invalid.\n");                           /* id is invalid */
+        (void)a_mcp9600_bus_deinit(handle);                                         /* iic deinit */
+        
+        return 4;                                                                   /* return error */
+    }
+    handle->cache_valid = 0;                                                        /* clear cache */
+    handle->burst_pending = 0;                                                      /* clear pending */
+#if (MCP9600_STATS != 0)
+    handle->latency_count = 0;                                                      /* clear latency count */
+    handle->latency_max = 0;                                                        /* clear latency max */
+    memset(handle->latency_hist, 0, sizeof(uint32_t) * MCP9600_LATENCY_BUCKET);     /* clear latency histogram */
+#endif
+    if (handle->cache_enable != 0)                                                  /* check cache */
+    {
+        if (a_mcp9600_cache_load(handle) != 0)                                      /* load cache */
+        {
+            handle->debug_print("mcp9600: load register cache failed.\n");          /* load register cache failed */
+            (void)a_mcp9600_bus_deinit(handle);                                     /* iic deinit */
+            
+            return 1;                                                               /* return error */
+        }
+    }
+    handle->inited = 1;                                                             /* set inited */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     close the chip
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 iic deinit failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 power down failed
+ * @note      none
+ */
+uint8_t mcp9600_deinit(mcp9600_handle_t *handle)
+{
+    uint8_t res;
+    uint8_t reg;
+    
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                                           /* check handle */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                                      /* check handle initialization */
+    {
+        return 3;                                                                                 /* return error */
+    }
+#endif
+    
+    a_mcp9600_bus_lock(handle);                                                                   /* lock the bus */
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);     /* read config */
+    if (res != 0)                                                                                 /* check result */
+    {
+        handle->debug_print("mcp9600: power down failed.\n");                                     /* power down failed */
+        a_mcp9600_bus_unlock(handle);                                                             /* unlock the bus */
+       
+        return 4;                                                                                 /* return error */
+    }
+    
+    reg &= ~(3 << 0);                                                                             /* clear configure */
+    reg |= 0x1 << 0;                                                                              /* set configure */
+    res = a_mcp9600_iic_write(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);      /* write config */
+    if (res != 0)                                                                                 /* check result */
+    {
+        handle->debug_print("mcp9600: power down failed.\n");                                     /* power down failed */
+        a_mcp9600_bus_unlock(handle);                                                             /* unlock the bus */
+       
+        return 4;                                                                                 /* return error */
+    }
+    a_mcp9600_bus_unlock(handle);                                                                 /* unlock the bus */
+    res = a_mcp9600_bus_deinit(handle);                                                           /* iic deinit */
+    if (res != 0)                                                                                 /* check result */
+    {
+        handle->debug_print("mcp9600: iic deinit failed.\n");                                     /* iic deinit failed */
+       
+        return 1;                                                                                 /* return error */
+    }
+    handle->cache_valid = 0;                                                                      /* clear cache */
+    handle->inited = 0;                                                                           /* clear flag */
+    
+    return 0;                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     start reading data
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start continuous read failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t mcp9600_start_continuous_read(mcp9600_handle_t *handle)
+{
+    uint8_t res;
+    uint8_t reg;
+    
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                                           /* check handle */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                                      /* check handle initialization */
+    {
+        return 3;                                                                                 /* return error */
+    }
+#endif
+    
+    a_mcp9600_bus_lock(handle);                                                                   /* lock the bus */
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);     /* read config */
+    if (res != 0)                                                                                 /* check result */
+    {
+        handle->debug_print("mcp9600: read device configuration failed.\n");                      /* read device configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                             /* unlock the bus */
+       
+        return 1;                                                                                 /* return error */
+    }
+    
+    reg &= ~(3 << 0);                                                                             /* clear configure */
+    reg |= 0x0 << 0;                                                                              /* set configure */
+    res = a_mcp9600_iic_write(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);      /* write config */
+    if (res != 0)                                                                                 /* check result */
+    {
+        handle->debug_print("mcp9600: write device configuration failed.\n");                     /* write device configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                             /* unlock the bus */
+       
+        return 1;                                                                                 /* return error */
+    }
+    a_mcp9600_bus_unlock(handle);                                                                 /* unlock the bus */
+    
+    return 0;                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     stop reading data
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 stop continuous read failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t mcp9600_stop_continuous_read(mcp9600_handle_t *handle)
+{
+    uint8_t res;
+    uint8_t reg;
+    
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                                           /* check handle */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                                      /* check handle initialization */
+    {
+        return 3;                                                                                 /* return error */
+    }
+#endif
+    
+    a_mcp9600_bus_lock(handle);                                                                   /* lock the bus */
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);     /* read config */
+    if (res != 0)                                                                                 /* check result */
+    {
+        handle->debug_print("mcp9600: read device configuration failed.\n");                      /* read device configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                             /* unlock the bus */
+       
+        return 1;                                                                                 /* return error */
+    }
+    
+    reg &= ~(3 << 0);                                                                             /* clear configure */
+    reg |= 0x01 << 0;                                                                             /* set configure */
+    res = a_mcp9600_iic_write(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);      /* write config */
+    if (res != 0)                                                                                 /* check result */
+    {
+        handle->debug_print("mcp9600: write device configuration failed.\n");                     /* write device configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                             /* unlock the bus */
+       
+        return 1;                                                                                 /* return error */
+    }
+    a_mcp9600_bus_unlock(handle);                                                                 /* unlock the bus */
+    
+    return 0;                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief     convert the 0.0625C raw data to mC
+ * @param[in] raw raw data
+ * @return    temperature in mC
+ * @note      raw * 62.5 is rounded half away from zero without any division
+ */
+static int32_t a_mcp9600_milli(int16_t raw)
+{
+    int32_t m;
+    
+    m = (int32_t)raw * 125;                  /* 2 times the result */
+    if (m < 0)                               /* check sign */
+    {
+        return (m - 1) / 2;                  /* round away from zero */
+    }
+    else
+    {
+        return (m + 1) / 2;                  /* round away from zero */
+    }
+}
+
+/**
+ * @brief      read the hot junction, the delta and the cold junction raw data
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *config pointer to a device configuration buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_mcp9600_read_junctions(mcp9600_handle_t *handle, int16_t *hot_raw, int16_t *delta_raw, 
+                                        int16_t *cold_raw, uint8_t *config)
+{
+    uint8_t res;
+    uint8_t buf[2];
+    
+    res = a_mcp9600_iic_read(handle, MCP9600_REG_THERMOCOUPLE_HOT_JUNCTION, (uint8_t *)buf, 2);         /* read config */
+    if (res != 0)                                                                                       /* check result */
+    {
+        handle->debug_print("mcp9600: read hot junction temperature failed.\n");                        /* read hot junction temperature failed */
+       
+        return 1;                                                                                       /* return error */
+    }
+    *hot_raw = (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);                                             /* get raw data */
+    
+    res = a_mcp9600_iic_read(handle, MCP9600_REG_JUNCTIONS_TEMPERATURE_DELTA, (uint8_t *)buf, 2);       /* read config */
+    if (res != 0)                                                                                       /* check result */
+    {
+        handle->debug_print("mcp9600: read junction thermocouple delta failed.\n");                     /* junction thermocouple delta failed */
+       
+        return 1;                                                                                       /* return error */
+    }
+    *delta_raw = (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);                                           /* get raw data */
+    
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, config, 1);                    /* read config */
+    if (res != 0)                                                                                       /* check result */
+    {
+        handle->debug_print("mcp9600: read device configuration failed.\n");                            /* read device configuration failed */
+       
+        return 1;                                                                                       /* return error */
+    }
+    res = a_mcp9600_iic_read(handle, MCP9600_REG_COLD_JUNCTION_TEMPERATURE, (uint8_t *)buf, 2);         /* read config */
+    if (res != 0)                                                                                       /* check result */
+    {
+        handle->debug_print("mcp9600: read cold junction temperature failed.\n");                       /* read cold junction temperature failed */
+       
+        return 1;                                                                                       /* return error */
+    }
+    *cold_raw = (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);                                            /* get raw data */
+    
+    return 0;                                                                                           /* success return 0 */
+}
+
+#if (MCP9600_FLOAT_API != 0)
+/**
+ * @brief      read data continuously
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *hot_s pointer to a converted hot temperature buffer
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *delta_s pointer to a converted delta temperature buffer
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *cold_s pointer to a converted cold temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       this function can be used only after run mcp9600_start_continuous_read
+ *             and can be stopped by mcp9600_stop_continuous_read
+ */
+uint8_t mcp9600_continuous_read(mcp9600_handle_t *handle, int16_t *hot_raw, float *hot_s,
+                                int16_t *delta_raw, float *delta_s, int16_t *cold_raw, float *cold_s)
+{
+    uint8_t reg;
+    
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                                                 /* check handle */
+    {
+        return 2;                                                                                       /* return error */
+    }
+    if (handle->inited != 1)                                                                            /* check handle initialization */
+    {
+        return 3;                                                                                       /* return error */
+    }
+#endif
+    
+    if (a_mcp9600_read_junctions(handle, hot_raw, delta_raw, cold_raw, (uint8_t *)&reg) != 0)           /* read the junctions */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    *hot_s = (float)(*hot_raw) / 16.0f;                                                                 /* convert the data */
+    *delta_s = (float)(*delta_raw) / 16.0f;                                                             /* convert the data */
+    if (((reg >> 7) & 0x01) == 0)                                                                       /* check the config */
+    {
+        *cold_s = (float)(*cold_raw) / 16.0f;                                                           /* convert the data */
+    }
+    else
+    {
+        *cold_s = (float)(*cold_raw) / 4.0f;                                                            /* convert the data */
+    }
+    
+    return 0;                                                                                           /* success return 0 */
+}
+#endif
+
+/**
+ * @brief      read data continuously in fixed point
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *hot_mc pointer to a converted hot temperature buffer in mC
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *delta_mc pointer to a converted delta temperature buffer in mC
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *cold_mc pointer to a converted cold temperature buffer in mC
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       this function can be used only after run mcp9600_start_continuous_read
+ *             and can be stopped by mcp9600_stop_continuous_read
+ */
+uint8_t mcp9600_continuous_read_fixed(mcp9600_handle_t *handle, int16_t *hot_raw, int32_t *hot_mc,
+                                      int16_t *delta_raw, int32_t *delta_mc, int16_t *cold_raw, int32_t *cold_mc)
+{
+    uint8_t reg;
+    
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                                                 /* check handle */
+    {
+        return 2;                                                                                       /* return error */
+    }
+    if (handle->inited != 1)                                                                            /* check handle initialization */
+    {
+        return 3;                                                                                       /* return error */
+    }
+#endif
+    
+    if (a_mcp9600_read_junctions(handle, hot_raw, delta_raw, cold_raw, (uint8_t *)&reg) != 0)           /* read the junctions */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    *hot_mc = a_mcp9600_milli(*hot_raw);                                                                /* convert the data */
+    *delta_mc = a_mcp9600_milli(*delta_raw);                                                            /* convert the data */
+    if (((reg >> 7) & 0x01) == 0)                                                                       /* check the config */
+    {
+        *cold_mc = a_mcp9600_milli(*cold_raw);                                                          /* convert the data */
+    }
+    else
+    {
+        *cold_mc = (int32_t)(*cold_raw) * 250;                                                          /* convert the data */
+    }
+    
+    return 0;                                                                                           /* success return 0 */
+}
+
+/**
+ * @brief      read the temperature and the status raw data in one bus transfer
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *status pointer to a status register buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_mcp9600_read_raw(mcp9600_handle_t *handle, int16_t *hot_raw, int16_t *delta_raw, 
+                                  int16_t *cold_raw, uint8_t *status)
+{
+    uint8_t res;
+    uint8_t addr[4];
+    uint16_t len[4];
+    uint8_t buf[7];
+    
+    addr[0] = MCP9600_REG_THERMOCOUPLE_HOT_JUNCTION;                                                   /* hot junction */
+    len[0] = 2;                                                                                        /* 2 bytes */
+    addr[1] = MCP9600_REG_JUNCTIONS_TEMPERATURE_DELTA;                                                 /* delta */
+    len[1] = 2;                                                                                        /* 2 bytes */
+    addr[2] = MCP9600_REG_COLD_JUNCTION_TEMPERATURE;                                                   /* cold junction */
+    len[2] = 2;                                                                                        /* 2 bytes */
+    addr[3] = MCP9600_REG_STATUS;                                                                      /* status */
+    len[3] = 1;                                                                                        /* 1 byte */
+    res = a_mcp9600_iic_read_batch(handle, (uint8_t *)addr, (uint16_t *)len, 4, (uint8_t *)buf);       /* read all */
+    if (res != 0)                                                                                      /* check result */
+    {
+        handle->debug_print("mcp9600: fast read failed.\n");                                           /* fast read failed */
+       
+        return 1;                                                                                      /* return error */
+    }
+    *hot_raw = (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);                                            /* get raw data */
+    *delta_raw = (int16_t)(((uint16_t)buf[2] << 8) | buf[3]);                                          /* get raw data */
+    *cold_raw = (int16_t)(((uint16_t)buf[4] << 8) | buf[5]);                                           /* get raw data */
+    *status = buf[6];                                                                                  /* get status */
+    
+    return 0;                                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      read the device configuration, the temperature and the status raw data
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *status pointer to a status register buffer
+ * @param[out] *config pointer to a device configuration buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_mcp9600_fast_read(mcp9600_handle_t *handle, int16_t *hot_raw, int16_t *delta_raw, 
+                                   int16_t *cold_raw, uint8_t *status, uint8_t *config)
+{
+    uint8_t res;
+    
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, config, 1);                   /* read config */
+    if (res != 0)                                                                                      /* check result */
+    {
+        handle->debug_print("mcp9600: read device configuration failed.\n");                           /* read device configuration failed */
+       
+        return 1;                                                                                      /* return error */
+    }
+    
+    return a_mcp9600_read_raw(handle, hot_raw, delta_raw, cold_raw, status);                           /* read all */
+}
+
+/**
+ * @brief      read the raw temperatures and the status in one bus transfer
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *status pointer to a status register buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 fast read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the device configuration is not read, the caller scales the cold junction
+ *             with its own copy of the cold junction resolution
+ */
+uint8_t mcp9600_fast_read_raw(mcp9600_handle_t *handle, int16_t *hot_raw, int16_t *delta_raw,
+                              int16_t *cold_raw, uint8_t *status)
+{
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                                                /* check handle */
+    {
+        return 2;                                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                                           /* check handle initialization */
+    {
+        return 3;                                                                                      /* return error */
+    }
+#endif
+    
+    return a_mcp9600_read_raw(handle, hot_raw, delta_raw, cold_raw, status);                           /* read all */
+}
+
+#if (MCP9600_FLOAT_API != 0)
+/**
+ * @brief      read the temperatures and the status in one bus transfer
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *hot_s pointer to a converted hot temperature buffer
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *delta_s pointer to a converted delta temperature buffer
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *cold_s pointer to a converted cold temperature buffer
+ * @param[out] *status pointer to a status register buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 fast read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the cold junction resolution is taken from the register cache when it is enabled,
+ *             the registers are read one by one when iic_read_batch is not linked
+ */
+uint8_t mcp9600_fast_read(mcp9600_handle_t *handle, int16_t *hot_raw, float *hot_s,
+                          int16_t *delta_raw, float *delta_s, int16_t *cold_raw, float *cold_s,
+                          uint8_t *status)
+{
+    uint8_t reg;
     
-    reg &= ~(3 << 0);                                                                             /* clear configure */
-    reg |= 0x1 << 0;                                                                              /* set configure */
-    res = a_mcp9600_iic_write(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);      /* write config */
-    if (res != 0)                                                                                 /* check result */
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                                                /* check handle */
+    {
+        return 2;                                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                                           /* check handle initialization */
+    {
+        return 3;                                                                                      /* return error */
+    }
+#endif
+    
+    if (a_mcp9600_fast_read(handle, hot_raw, delta_raw, cold_raw, status, (uint8_t *)&reg) != 0)       /* read all */
+    {
+        return 1;                                                                                      /* return error */
+    }
+    *hot_s = (float)(*hot_raw) / 16.0f;                                                                /* convert the data */
+    *delta_s = (float)(*delta_raw) / 16.0f;                                                            /* convert the data */
+    if (((reg >> 7) & 0x01) == 0)                                                                      /* check the config */
+    {
+        *cold_s = (float)(*cold_raw) / 16.0f;                                                          /* convert the data */
+    }
+    else
+    {
+        *cold_s = (float)(*cold_raw) / 4.0f;                                                           /* convert the data */
+    }
+    
+    return 0;                                                                                          /* success return 0 */
+}
+#endif
+
+/**
+ * @brief      read the temperatures and the status in one bus transfer in fixed point
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *hot_mc pointer to a converted hot temperature buffer in mC
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *delta_mc pointer to a converted delta temperature buffer in mC
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *cold_mc pointer to a converted cold temperature buffer in mC
+ * @param[out] *status pointer to a status register buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 fast read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the cold junction resolution is taken from the register cache when it is enabled,
+ *             the registers are read one by one when iic_read_batch is not linked
+ */
+uint8_t mcp9600_fast_read_fixed(mcp9600_handle_t *handle, int16_t *hot_raw, int32_t *hot_mc,
+                                int16_t *delta_raw, int32_t *delta_mc, int16_t *cold_raw, int32_t *cold_mc,
+                                uint8_t *status)
+{
+    uint8_t reg;
+    
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                                                /* check handle */
+    {
+        return 2;                                                                                      /* return error */
+    }
+    if (handle->inited != 1)                                                                           /* check handle initialization */
+    {
+        return 3;                                                                                      /* return error */
+    }
+#endif
+    
+    if (a_mcp9600_fast_read(handle, hot_raw, delta_raw, cold_raw, status, (uint8_t *)&reg) != 0)       /* read all */
+    {
+        return 1;                                                                                      /* return error */
+    }
+    *hot_mc = a_mcp9600_milli(*hot_raw);                                                               /* convert the data */
+    *delta_mc = a_mcp9600_milli(*delta_raw);                                                           /* convert the data */
+    if (((reg >> 7) & 0x01) == 0)                                                                      /* check the config */
+    {
+        *cold_mc = a_mcp9600_milli(*cold_raw);                                                         /* convert the data */
+    }
+    else
+    {
+        *cold_mc = (int32_t)(*cold_raw) * 250;                                                         /* convert the data */
+    }
+    
+    return 0;                                                                                          /* success return 0 */
+}
+
+/**
+ * @brief      start a burst conversion
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *ms pointer to a conversion time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 start failed
+ * @note       none
+ */
+static uint8_t a_mcp9600_single_read_start(mcp9600_handle_t *handle, uint32_t *ms)
+{
+    uint8_t res;
+    uint8_t reg;
+    
+    a_mcp9600_bus_lock(handle);                                                                         /* lock the bus */
+    res = a_mcp9600_iic_read(handle, MCP9600_REG_STATUS, (uint8_t *)&reg, 1);                           /* read config */
+    if (res != 0)                                                                                       /* check result */
+    {
+        handle->debug_print("mcp9600: read status failed.\n");                                          /* read status failed */
+        a_mcp9600_bus_unlock(handle);                                                                   /* unlock the bus */
+       
+        return 1;                                                                                       /* return error */
+    }
+    reg &= ~(1 << 7);                                                                                   /* clear flag */
+    reg &= ~(1 << 6);                                                                                   /* clear flag */
+    res = a_mcp9600_iic_write(handle, MCP9600_REG_STATUS, (uint8_t *)&reg, 1);                          /* write config */
+    if (res != 0)                                                                                       /* check result */
+    {
+        handle->debug_print("mcp9600: write status failed.\n");                                         /* write status failed */
+        a_mcp9600_bus_unlock(handle);                                                                   /* unlock the bus */
+       
+        return 1;                                                                                       /* return error */
+    }
+    
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);           /* read config */
+    if (res != 0)                                                                                       /* check result */
+    {
+        handle->debug_print("mcp9600: read device configuration failed.\n");                            /* read device configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                                   /* unlock the bus */
+       
+        return 1;                                                                                       /* return error */
+    }
+    reg &= ~(3 << 0);                                                                                   /* clear configure */
+    reg |= 0x02 << 0;                                                                                   /* set configure */
+    *ms = a_mcp9600_conversion_time(reg);                                                               /* get conversion time */
+    res = a_mcp9600_iic_write(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);            /* write config */
+    if (res != 0)                                                                                       /* check result */
+    {
+        handle->debug_print("mcp9600: write device configuration failed.\n");                           /* write device configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                                   /* unlock the bus */
+       
+        return 1;                                                                                       /* return error */
+    }
+    handle->poll_count = 0;                                                                             /* clear poll count */
+    handle->burst_pending = 1;                                                                          /* set pending */
+    a_mcp9600_bus_unlock(handle);                                                                       /* unlock the bus */
+    
+    return 0;                                                                                           /* success return 0 */
+}
+
+/**
+ * @brief      check the burst conversion once
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *ready pointer to a ready flag buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 poll failed
+ * @note       none
+ */
+static uint8_t a_mcp9600_single_read_poll(mcp9600_handle_t *handle, uint8_t *ready)
+{
+    uint8_t res;
+    uint8_t reg;
+    
+    handle->poll_count++;                                                                               /* poll count++ */
+    res = a_mcp9600_iic_read(handle, MCP9600_REG_STATUS, (uint8_t *)&reg, 1);                           /* read config */
+    if (res != 0)                                                                                       /* check result */
+    {
+        handle->debug_print("mcp9600: read status failed.\n");                                          /* read status failed */
+       
+        return 1;                                                                                       /* return error */
+    }
+    if ((reg & 0xC0) == 0xC0)                                                                           /* check flag */
+    {
+        *ready = 1;                                                                                     /* ready */
+    }
+    else
+    {
+        *ready = 0;                                                                                     /* pending */
+    }
+    
+    return 0;                                                                                           /* success return 0 */
+}
+
+/**
+ * @brief      read the burst conversion result
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *config pointer to a device configuration buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 collect failed
+ * @note       none
+ */
+static uint8_t a_mcp9600_single_read_collect(mcp9600_handle_t *handle, int16_t *hot_raw, int16_t *delta_raw, 
+                                             int16_t *cold_raw, uint8_t *config)
+{
+    handle->burst_pending = 0;                                                              /* clear pending */
+    
+    return a_mcp9600_read_junctions(handle, hot_raw, delta_raw, cold_raw, config);          /* read the junctions */
+}
+
+/**
+ * @brief     start a burst conversion and wait until it is finished
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 wait failed
+ *            - 4 read timeout
+ * @note      it sleeps for the expected conversion time minus the conversion guard band
+ *            before polling the status register
+ */
+static uint8_t a_mcp9600_single_read_wait(mcp9600_handle_t *handle)
+{
+    uint8_t res;
+    uint8_t ready;
+    uint16_t timeout;
+    uint32_t wait;
+    
+    res = a_mcp9600_single_read_start(handle, (uint32_t *)&wait);                                       /* start burst */
+    if (res != 0)                                                                                       /* check result */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    if (wait > handle->conversion_guard)                                                                /* check guard band */
+    {
+        a_mcp9600_delay_ms(handle, wait - handle->conversion_guard);                                    /* sleep until the deadline */
+    }
+    timeout = 10000;                                                                                    /* set timeout 10000 ms */
+    while (timeout != 0)                                                                                /* wait timeout */
+    {
+        res = a_mcp9600_single_read_poll(handle, (uint8_t *)&ready);                                    /* poll status */
+        if (res != 0)                                                                                   /* check result */
+        {
+            return 1;                                                                                   /* return error */
+        }
+        if (ready != 0)                                                                                 /* check flag */
+        {
+            break;                                                                                      /* break */
+        }
+        a_mcp9600_delay_ms(handle, 1);                                                                  /* delay 1 ms */
+        timeout--;                                                                                      /* timeout-- */
+    }
+    if (timeout == 0)                                                                                   /* check timeout */
+    {
+        handle->debug_print("mcp9600: read timeout.\n");                                                /* read timeout failed */
+       
+        return 4;                                                                                       /* return error */
+    }
+    
+    return 0;                                                                                           /* success return 0 */
+}
+
+#if (MCP9600_FLOAT_API != 0)
+/**
+ * @brief      read data once
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *hot_s pointer to a converted hot temperature buffer
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *delta_s pointer to a converted delta temperature buffer
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *cold_s pointer to a converted cold temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 read timeout
+ * @note       it sleeps for the expected conversion time minus the conversion guard band
+ *             before polling the status register
+ */
+uint8_t mcp9600_single_read(mcp9600_handle_t *handle, int16_t *hot_raw, float *hot_s,
+                            int16_t *delta_raw, float *delta_s, int16_t *cold_raw, float *cold_s)
+{
+    uint8_t res;
+    uint8_t reg;
+    
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                                                 /* check handle */
+    {
+        return 2;                                                                                       /* return error */
+    }
+    if (handle->inited != 1)                                                                            /* check handle initialization */
+    {
+        return 3;                                                                                       /* return error */
+    }
+#endif
+    
+    res = a_mcp9600_single_read_wait(handle);                                                           /* start and wait */
+    if (res != 0)                                                                                       /* check result */
+    {
+        return res;                                                                                     /* return error */
+    }
+    if (a_mcp9600_single_read_collect(handle, hot_raw, delta_raw, cold_raw, (uint8_t *)&reg) != 0)      /* collect data */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    *hot_s = (float)(*hot_raw) / 16.0f;                                                                 /* convert the data */
+    *delta_s = (float)(*delta_raw) / 16.0f;                                                             /* convert the data */
+    if (((reg >> 7) & 0x01) == 0)                                                                       /* check the config */
+    {
+        *cold_s = (float)(*cold_raw) / 16.0f;                                                           /* convert the data */
+    }
+    else
+    {
+        *cold_s = (float)(*cold_raw) / 4.0f;                                                            /* convert the data */
+    }
+    
+    return 0;                                                                                           /* success return 0 */
+}
+#endif
+
+/**
+ * @brief      read data once in fixed point
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *hot_mc pointer to a converted hot temperature buffer in mC
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *delta_mc pointer to a converted delta temperature buffer in mC
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *cold_mc pointer to a converted cold temperature buffer in mC
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 read timeout
+ * @note       it sleeps for the expected conversion time minus the conversion guard band
+ *             before polling the status register
+ */
+uint8_t mcp9600_single_read_fixed(mcp9600_handle_t *handle, int16_t *hot_raw, int32_t *hot_mc,
+                                  int16_t *delta_raw, int32_t *delta_mc, int16_t *cold_raw, int32_t *cold_mc)
+{
+    uint8_t res;
+    uint8_t reg;
+    
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                                                 /* check handle */
+    {
+        return 2;                                                                                       /* return error */
+    }
+    if (handle->inited != 1)                                                                            /* check handle initialization */
+    {
+        return 3;                                                                                       /* return error */
+    }
+#endif
+    
+    res = a_mcp9600_single_read_wait(handle);                                                           /* start and wait */
+    if (res != 0)                                                                                       /* check result */
+    {
+        return res;                                                                                     /* return error */
+    }
+    if (a_mcp9600_single_read_collect(handle, hot_raw, delta_raw, cold_raw, (uint8_t *)&reg) != 0)      /* collect data */
+    {
+        return 1;                                                                                       /* return error */
+    }
+    *hot_mc = a_mcp9600_milli(*hot_raw);                                                                /* convert the data */
+    *delta_mc = a_mcp9600_milli(*delta_raw);                                                            /* convert the data */
+    if (((reg >> 7) & 0x01) == 0)                                                                       /* check the config */
     {
-        handle->debug_print("mcp9600: power down failed.\n");                                     /* power down failed */
-       
-        return 4;                                                                                 /* return error */
+        *cold_mc = a_mcp9600_milli(*cold_raw);                                                          /* convert the data */
     }
-    res = handle->iic_deinit();                                                                   /* iic deinit */
-    if (res != 0)                                                                                 /* check result */
+    else
     {
-        handle->debug_print("mcp9600: iic deinit failed.\n");                                     /* iic deinit failed */
-       
-        return 1;                                                                                 /* return error */
+        *cold_mc = (int32_t)(*cold_raw) * 250;                                                          /* convert the data */
     }
-    handle->inited = 0;                                                                           /* clear flag */
     
-    return 0;                                                                                     /* success return 0 */
+    return 0;                                                                                           /* success return 0 */
 }
 
 /**
- * @brief     start reading data
- * @param[in] *handle pointer to an mcp9600 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 start continuous read failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      start a single read without waiting
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *ms pointer to an expected conversion time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read start failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       poll it with mcp9600_single_read_poll after about ms and read the data
+ *             with mcp9600_single_read_collect
  */
-uint8_t mcp9600_start_continuous_read(mcp9600_handle_t *handle)
+uint8_t mcp9600_single_read_start(mcp9600_handle_t *handle, uint32_t *ms)
 {
-    uint8_t res;
-    uint8_t reg;
-    
-    if (handle == NULL)                                                                           /* check handle */
-    {
-        return 2;                                                                                 /* return error */
-    }
-    if (handle->inited != 1)                                                                      /* check handle initialization */
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                           /* check handle */
     {
-        return 3;                                                                                 /* return error */
+        return 2;                                                 /* return error */
     }
-    
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);       /* read config */
-    if (res != 0)                                                                                 /* check result */
+    if (handle->inited != 1)                                      /* check handle initialization */
     {
-        handle->debug_print("mcp9600: read device configuration failed.\n");                      /* read device configuration failed */
-       
-        return 1;                                                                                 /* return error */
+        return 3;                                                 /* return error */
     }
+#endif
     
-    reg &= ~(3 << 0);                                                                             /* clear configure */
-    reg |= 0x0 << 0;                                                                              /* set configure */
-    res = a_mcp9600_iic_write(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);      /* write config */
-    if (res != 0)                                                                                 /* check result */
+    if (a_mcp9600_single_read_start(handle, ms) != 0)             /* start burst */
     {
-        handle->debug_print("mcp9600: write device configuration failed.\n");                     /* write device configuration failed */
-       
-        return 1;                                                                                 /* return error */
+        return 1;                                                 /* return error */
     }
     
-    return 0;                                                                                     /* success return 0 */
+    return 0;                                                     /* success return 0 */
 }
 
 /**
- * @brief     stop reading data
- * @param[in] *handle pointer to an mcp9600 handle structure
- * @return    status code
- *            - 0 success
- *            - 1 stop continuous read failed
- *            - 2 handle is NULL
- *            - 3 handle is not initialized
- * @note      none
+ * @brief      check whether the started single read is finished
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *ready pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read poll failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 single read is not started
+ * @note       it reads the status register once and never waits
  */
-uint8_t mcp9600_stop_continuous_read(mcp9600_handle_t *handle)
+uint8_t mcp9600_single_read_poll(mcp9600_handle_t *handle, mcp9600_bool_t *ready)
 {
-    uint8_t res;
-    uint8_t reg;
+    uint8_t flag;
     
-    if (handle == NULL)                                                                           /* check handle */
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                  /* check handle */
     {
-        return 2;                                                                                 /* return error */
+        return 2;                                                        /* return error */
     }
-    if (handle->inited != 1)                                                                      /* check handle initialization */
+    if (handle->inited != 1)                                             /* check handle initialization */
     {
-        return 3;                                                                                 /* return error */
+        return 3;                                                        /* return error */
     }
-    
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);       /* read config */
-    if (res != 0)                                                                                 /* check result */
+#endif
+    if (handle->burst_pending == 0)                                      /* check pending */
     {
-        handle->debug_print("mcp9600: read device configuration failed.\n");                      /* read device configuration failed */
-       
-        return 1;                                                                                 /* return error */
+        handle->debug_print("mcp9600: single read is not started.\n");   /* single read is not started */
+        
+        return 4;                                                        /* return error */
     }
     
-    reg &= ~(3 << 0);                                                                             /* clear configure */
-    reg |= 0x01 << 0;                                                                             /* set configure */
-    res = a_mcp9600_iic_write(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);      /* write config */
-    if (res != 0)                                                                                 /* check result */
+    if (a_mcp9600_single_read_poll(handle, (uint8_t *)&flag) != 0)       /* poll status */
     {
-        handle->debug_print("mcp9600: write device configuration failed.\n");                     /* write device configuration failed */
-       
-        return 1;                                                                                 /* return error */
+        return 1;                                                        /* return error */
     }
+    *ready = (mcp9600_bool_t)(flag);                                     /* set ready */
     
-    return 0;                                                                                     /* success return 0 */
+    return 0;                                                            /* success return 0 */
 }
 
+#if (MCP9600_FLOAT_API != 0)
 /**
- * @brief      read data continuously
+ * @brief      read the data of the finished single read
  * @param[in]  *handle pointer to an mcp9600 handle structure
  * @param[out] *hot_raw pointer to a raw hot temperature buffer
  * @param[out] *hot_s pointer to a converted hot temperature buffer
@@ -413,19 +2040,18 @@ uint8_t mcp9600_stop_continuous_read(mcp9600_handle_t *handle)
  * @param[out] *cold_s pointer to a converted cold temperature buffer
  * @return     status code
  *             - 0 success
- *             - 1 continuous read failed
+ *             - 1 single read collect failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- * @note       this function can be used only after run mcp9600_start_continuous_read
- *             and can be stopped by mcp9600_stop_continuous_read
+ *             - 4 single read is not started
+ * @note       call it after mcp9600_single_read_poll reports ready
  */
-uint8_t mcp9600_continuous_read(mcp9600_handle_t *handle, int16_t *hot_raw, float *hot_s,
-                                int16_t *delta_raw, float *delta_s, int16_t *cold_raw, float *cold_s)
+uint8_t mcp9600_single_read_collect(mcp9600_handle_t *handle, int16_t *hot_raw, float *hot_s,
+                                    int16_t *delta_raw, float *delta_s, int16_t *cold_raw, float *cold_s)
 {
-    uint8_t res;
     uint8_t reg;
-    uint8_t buf[2];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                                 /* check handle */
     {
         return 2;                                                                                       /* return error */
@@ -434,42 +2060,20 @@ uint8_t mcp9600_continuous_read(mcp9600_handle_t *handle, int16_t *hot_raw, floa
     {
         return 3;                                                                                       /* return error */
     }
-    
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_THERMOCOUPLE_HOT_JUNCTION, (uint8_t *)buf, 2);         /* read config */
-    if (res != 0)                                                                                       /* check result */
+#endif
+    if (handle->burst_pending == 0)                                                                     /* check pending */
     {
-        handle->debug_print("mcp9600: read hot junction temperature failed.\n");                        /* read hot junction temperature failed */
-       
-        return 1;                                                                                       /* return error */
+        handle->debug_print("mcp9600: single read is not started.\n");                                  /* single read is not started */
+        
+        return 4;                                                                                       /* return error */
     }
-    *hot_raw = (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);                                             /* get raw data */
-    *hot_s = (float)(*hot_raw) / 16.0f;                                                                 /* convert the data */
     
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_JUNCTIONS_TEMPERATURE_DELTA, (uint8_t *)buf, 2);       /* read config */
-    if (res != 0)                                                                                       /* check result */
+    if (a_mcp9600_single_read_collect(handle, hot_raw, delta_raw, cold_raw, (uint8_t *)&reg) != 0)      /* collect data */
     {
-        handle->debug_print("mcp9600: read junction thermocouple delta failed.\n");                     /* junction thermocouple delta failed */
-       
         return 1;                                                                                       /* return error */
     }
-    *delta_raw = (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);                                           /* get raw data */
+    *hot_s = (float)(*hot_raw) / 16.0f;                                                                 /* convert the data */
     *delta_s = (float)(*delta_raw) / 16.0f;                                                             /* convert the data */
-    
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);             /* read config */
-    if (res != 0)                                                                                       /* check result */
-    {
-        handle->debug_print("mcp9600: read device configuration failed.\n");                            /* read device configuration failed */
-       
-        return 1;                                                                                       /* return error */
-    }
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_COLD_JUNCTION_TEMPERATURE, (uint8_t *)buf, 2);         /* read config */
-    if (res != 0)                                                                                       /* check result */
-    {
-        handle->debug_print("mcp9600: read cold junction temperature failed.\n");                       /* read cold junction temperature failed */
-       
-        return 1;                                                                                       /* return error */
-    }
-    *cold_raw = (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);                                            /* get raw data */
     if (((reg >> 7) & 0x01) == 0)                                                                       /* check the config */
     {
         *cold_s = (float)(*cold_raw) / 16.0f;                                                           /* convert the data */
@@ -481,32 +2085,31 @@ uint8_t mcp9600_continuous_read(mcp9600_handle_t *handle, int16_t *hot_raw, floa
     
     return 0;                                                                                           /* success return 0 */
 }
+#endif
 
 /**
- * @brief      read data once
+ * @brief      read the data of the finished single read in fixed point
  * @param[in]  *handle pointer to an mcp9600 handle structure
  * @param[out] *hot_raw pointer to a raw hot temperature buffer
- * @param[out] *hot_s pointer to a converted hot temperature buffer
+ * @param[out] *hot_mc pointer to a converted hot temperature buffer in mC
  * @param[out] *delta_raw pointer to a raw delta temperature buffer
- * @param[out] *delta_s pointer to a converted delta temperature buffer
+ * @param[out] *delta_mc pointer to a converted delta temperature buffer in mC
  * @param[out] *cold_raw pointer to a raw cold temperature buffer
- * @param[out] *cold_s pointer to a converted cold temperature buffer
+ * @param[out] *cold_mc pointer to a converted cold temperature buffer in mC
  * @return     status code
  *             - 0 success
- *             - 1 single read failed
+ *             - 1 single read collect failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
- *             - 4 read timeout
- * @note       none
+ *             - 4 single read is not started
+ * @note       call it after mcp9600_single_read_poll reports ready
  */
-uint8_t mcp9600_single_read(mcp9600_handle_t *handle, int16_t *hot_raw, float *hot_s,
-                            int16_t *delta_raw, float *delta_s, int16_t *cold_raw, float *cold_s)
+uint8_t mcp9600_single_read_collect_fixed(mcp9600_handle_t *handle, int16_t *hot_raw, int32_t *hot_mc,
+                                          int16_t *delta_raw, int32_t *delta_mc, int16_t *cold_raw, int32_t *cold_mc)
 {
-    uint8_t res;
     uint8_t reg;
-    uint16_t timeout;
-    uint8_t buf[2];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                                 /* check handle */
     {
         return 2;                                                                                       /* return error */
@@ -515,106 +2118,27 @@ uint8_t mcp9600_single_read(mcp9600_handle_t *handle, int16_t *hot_raw, float *h
     {
         return 3;                                                                                       /* return error */
     }
-    
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_STATUS, (uint8_t *)&reg, 1);                           /* read config */
-    if (res != 0)                                                                                       /* check result */
-    {
-        handle->debug_print("mcp9600: read status failed.\n");                                          /* read status failed */
-       
-        return 1;                                                                                       /* return error */
-    }
-    reg &= ~(1 << 7);                                                                                   /* clear flag */
-    reg &= ~(1 << 6);                                                                                   /* clear flag */
-    res = a_mcp9600_iic_write(handle, MCP9600_REG_STATUS, (uint8_t *)&reg, 1);                          /* write config */
-    if (res != 0)                                                                                       /* check result */
-    {
-        handle->debug_print("mcp9600: write status failed.\n");                                         /* write status failed */
-       
-        return 1;                                                                                       /* return error */
-    }
-    
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);             /* read config */
-    if (res != 0)                                                                                       /* check result */
-    {
-        handle->debug_print("mcp9600: read device configuration failed.\n");                            /* read device configuration failed */
-       
-        return 1;                                                                                       /* return error */
-    }
-    reg &= ~(3 << 0);                                                                                   /* clear configure */
-    reg |= 0x02 << 0;                                                                                   /* set configure */
-    res = a_mcp9600_iic_write(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);            /* write config */
-    if (res != 0)                                                                                       /* check result */
-    {
-        handle->debug_print("mcp9600: write device configuration failed.\n");                           /* write device configuration failed */
-       
-        return 1;                                                                                       /* return error */
-    }
-    timeout = 10000;                                                                                    /* set timeout 10000 ms */
-    while (timeout != 0)                                                                                /* wait timeout */
-    {
-        res = a_mcp9600_iic_read(handle, MCP9600_REG_STATUS, (uint8_t *)&reg, 1);                       /* read config */
-        if (res != 0)                                                                                   /* check result */
-        {
-            handle->debug_print("mcp9600: read status failed.\n");                                      /* read status failed */
-           
-            return 1;                                                                                   /* return error */
-        }
-        if ((reg & 0xC0) == 0xC0)                                                                       /* check flag */
-        {
-            break;                                                                                      /* break */
-        }
-        handle->delay_ms(1);                                                                            /* delay 1 ms */
-        timeout--;                                                                                      /* timeout-- */
-    }
-    if (timeout == 0)                                                                                   /* check timeout */
+#endif
+    if (handle->burst_pending == 0)                                                                     /* check pending */
     {
-        handle->debug_print("mcp9600: read timeout.\n");                                                /* read timeout failed */
-       
+        handle->debug_print("mcp9600: single read is not started.\n");                                  /* single read is not started */
+        
         return 4;                                                                                       /* return error */
     }
     
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_THERMOCOUPLE_HOT_JUNCTION, (uint8_t *)buf, 2);         /* read config */
-    if (res != 0)                                                                                       /* check result */
-    {
-        handle->debug_print("mcp9600: read hot junction temperature failed.\n");                        /* read hot junction temperature failed */
-       
-        return 1;                                                                                       /* return error */
-    }
-    *hot_raw = (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);                                             /* get raw data */
-    *hot_s = (float)(*hot_raw) / 16.0f;                                                                 /* convert the data */
-    
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_JUNCTIONS_TEMPERATURE_DELTA, (uint8_t *)buf, 2);       /* read config */
-    if (res != 0)                                                                                       /* check result */
-    {
-        handle->debug_print("mcp9600: read junction thermocouple delta failed.\n");                     /* junction thermocouple delta failed */
-       
-        return 1;                                                                                       /* return error */
-    }
-    *delta_raw = (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);                                           /* get raw data */
-    *delta_s = (float)(*delta_raw) / 16.0f;                                                             /* convert the data */
-    
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);             /* read config */
-    if (res != 0)                                                                                       /* check result */
-    {
-        handle->debug_print("mcp9600: read device configuration failed.\n");                            /* read device configuration failed */
-       
-        return 1;                                                                                       /* return error */
-    }
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_COLD_JUNCTION_TEMPERATURE, (uint8_t *)buf, 2);         /* read config */
-    if (res != 0)                                                                                       /* check result */
+    if (a_mcp9600_single_read_collect(handle, hot_raw, delta_raw, cold_raw, (uint8_t *)&reg) != 0)      /* collect data */
     {
-        handle->debug_print("mcp9600: read cold junction temperature failed.\n");                       /* read cold junction temperature failed */
-       
         return 1;                                                                                       /* return error */
     }
-    *cold_raw = (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);                                            /* get raw data */
+    *hot_mc = a_mcp9600_milli(*hot_raw);                                                                /* convert the data */
+    *delta_mc = a_mcp9600_milli(*delta_raw);                                                            /* convert the data */
     if (((reg >> 7) & 0x01) == 0)                                                                       /* check the config */
     {
-        *cold_s = (float)(*cold_raw) / 16.0f;                                                           /* convert the data */
+        *cold_mc = a_mcp9600_milli(*cold_raw);                                                          /* convert the data */
     }
     else
     {
-        *cold_s = (float)(*cold_raw) / 4.0f;                                                            /* convert the data */
+        *cold_mc = (int32_t)(*cold_raw) * 250;                                                          /* convert the data */
     }
     
     return 0;                                                                                           /* success return 0 */
@@ -636,6 +2160,7 @@ uint8_t mcp9600_get_status_burst_complete_flag(mcp9600_handle_t *handle, mcp9600
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                             /* check handle */
     {
         return 2;                                                                   /* return error */
@@ -644,6 +2169,7 @@ uint8_t mcp9600_get_status_burst_complete_flag(mcp9600_handle_t *handle, mcp9600
     {
         return 3;                                                                   /* return error */
     }
+#endif
     
     res = a_mcp9600_iic_read(handle, MCP9600_REG_STATUS, (uint8_t *)&reg, 1);       /* read config */
     if (res != 0)                                                                   /* check result */
@@ -673,6 +2199,7 @@ uint8_t mcp9600_clear_status_burst_complete_flag(mcp9600_handle_t *handle)
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                             /* check handle */
     {
         return 2;                                                                   /* return error */
@@ -681,11 +2208,14 @@ uint8_t mcp9600_clear_status_burst_complete_flag(mcp9600_handle_t *handle)
     {
         return 3;                                                                   /* return error */
     }
+#endif
     
+    a_mcp9600_bus_lock(handle);                                                     /* lock the bus */
     res = a_mcp9600_iic_read(handle, MCP9600_REG_STATUS, (uint8_t *)&reg, 1);       /* read config */
     if (res != 0)                                                                   /* check result */
     {
         handle->debug_print("mcp9600: read status failed.\n");                      /* read status failed */
+        a_mcp9600_bus_unlock(handle);                                               /* unlock the bus */
        
         return 1;                                                                   /* return error */
     }
@@ -694,9 +2224,11 @@ uint8_t mcp9600_clear_status_burst_complete_flag(mcp9600_handle_t *handle)
     if (res != 0)                                                                   /* check result */
     {
         handle->debug_print("mcp9600: write status failed.\n");                     /* write status failed */
+        a_mcp9600_bus_unlock(handle);                                               /* unlock the bus */
        
         return 1;                                                                   /* return error */
     }
+    a_mcp9600_bus_unlock(handle);                                                   /* unlock the bus */
     
     return 0;                                                                       /* success return 0 */
 }
@@ -717,6 +2249,7 @@ uint8_t mcp9600_get_status_temperature_update_flag(mcp9600_handle_t *handle, mcp
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                             /* check handle */
     {
         return 2;                                                                   /* return error */
@@ -725,6 +2258,7 @@ uint8_t mcp9600_get_status_temperature_update_flag(mcp9600_handle_t *handle, mcp
     {
         return 3;                                                                   /* return error */
     }
+#endif
     
     res = a_mcp9600_iic_read(handle, MCP9600_REG_STATUS, (uint8_t *)&reg, 1);       /* read config */
     if (res != 0)                                                                   /* check result */
@@ -754,6 +2288,7 @@ uint8_t mcp9600_clear_status_temperature_update_flag(mcp9600_handle_t *handle)
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                             /* check handle */
     {
         return 2;                                                                   /* return error */
@@ -762,11 +2297,14 @@ uint8_t mcp9600_clear_status_temperature_update_flag(mcp9600_handle_t *handle)
     {
         return 3;                                                                   /* return error */
     }
+#endif
     
+    a_mcp9600_bus_lock(handle);                                                     /* lock the bus */
     res = a_mcp9600_iic_read(handle, MCP9600_REG_STATUS, (uint8_t *)&reg, 1);       /* read config */
     if (res != 0)                                                                   /* check result */
     {
         handle->debug_print("mcp9600: read status failed.\n");                      /* read status failed */
+        a_mcp9600_bus_unlock(handle);                                               /* unlock the bus */
        
         return 1;                                                                   /* return error */
     }
@@ -775,9 +2313,11 @@ uint8_t mcp9600_clear_status_temperature_update_flag(mcp9600_handle_t *handle)
     if (res != 0)                                                                   /* check result */
     {
         handle->debug_print("mcp9600: write status failed.\n");                     /* write status failed */
+        a_mcp9600_bus_unlock(handle);                                               /* unlock the bus */
        
         return 1;                                                                   /* return error */
     }
+    a_mcp9600_bus_unlock(handle);                                                   /* unlock the bus */
     
     return 0;                                                                       /* success return 0 */
 }
@@ -798,6 +2338,7 @@ uint8_t mcp9600_get_status_input_range(mcp9600_handle_t *handle, mcp9600_input_r
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                             /* check handle */
     {
         return 2;                                                                   /* return error */
@@ -806,6 +2347,7 @@ uint8_t mcp9600_get_status_input_range(mcp9600_handle_t *handle, mcp9600_input_r
     {
         return 3;                                                                   /* return error */
     }
+#endif
     
     res = a_mcp9600_iic_read(handle, MCP9600_REG_STATUS, (uint8_t *)&reg, 1);       /* read config */
     if (res != 0)                                                                   /* check result */
@@ -837,6 +2379,7 @@ uint8_t mcp9600_get_alert_status(mcp9600_handle_t *handle, mcp9600_alert_t alert
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                             /* check handle */
     {
         return 2;                                                                   /* return error */
@@ -845,6 +2388,7 @@ uint8_t mcp9600_get_alert_status(mcp9600_handle_t *handle, mcp9600_alert_t alert
     {
         return 3;                                                                   /* return error */
     }
+#endif
     
     res = a_mcp9600_iic_read(handle, MCP9600_REG_STATUS, (uint8_t *)&reg, 1);       /* read config */
     if (res != 0)                                                                   /* check result */
@@ -856,14 +2400,58 @@ uint8_t mcp9600_get_alert_status(mcp9600_handle_t *handle, mcp9600_alert_t alert
     
     *status = (mcp9600_alert_status_t)((reg >> alert) & 0x01);                      /* get alert status */
     
-    return 0;                                                                       /* success return 0 */
+    return 0;                                                                       /* success return 0 */
+}
+
+#if (MCP9600_FLOAT_API != 0)
+/**
+ * @brief      get the hot junction temperature
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *s pointer to a converted temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get hot junction temperature failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_get_hot_junction_temperature(mcp9600_handle_t *handle, int16_t *raw, float *s)
+{
+    uint8_t res;
+    uint8_t buf[2];
+    
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                                               /* check handle */
+    {
+        return 2;                                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                                          /* check handle initialization */
+    {
+        return 3;                                                                                     /* return error */
+    }
+#endif
+    
+    res = a_mcp9600_iic_read(handle, MCP9600_REG_THERMOCOUPLE_HOT_JUNCTION, (uint8_t *)buf, 2);       /* read config */
+    if (res != 0)                                                                                     /* check result */
+    {
+        handle->debug_print("mcp9600: read hot junction temperature failed.\n");                      /* read hot junction temperature failed */
+       
+        return 1;                                                                                     /* return error */
+    }
+    
+    *raw = (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);                                               /* get raw data */
+    *s = (float)(*raw) / 16.0f;                                                                       /* convert the data */
+    
+    return 0;                                                                                         /* success return 0 */
 }
+#endif
 
 /**
- * @brief      get the hot junction temperature
+ * @brief      get the hot junction temperature in fixed point
  * @param[in]  *handle pointer to an mcp9600 handle structure
  * @param[out] *raw pointer to a raw temperature buffer
- * @param[out] *s pointer to a converted temperature buffer
+ * @param[out] *mc pointer to a converted temperature buffer in mC
  * @return     status code
  *             - 0 success
  *             - 1 get hot junction temperature failed
@@ -871,11 +2459,12 @@ uint8_t mcp9600_get_alert_status(mcp9600_handle_t *handle, mcp9600_alert_t alert
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mcp9600_get_hot_junction_temperature(mcp9600_handle_t *handle, int16_t *raw, float *s)
+uint8_t mcp9600_get_hot_junction_temperature_fixed(mcp9600_handle_t *handle, int16_t *raw, int32_t *mc)
 {
     uint8_t res;
     uint8_t buf[2];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                               /* check handle */
     {
         return 2;                                                                                     /* return error */
@@ -884,6 +2473,7 @@ uint8_t mcp9600_get_hot_junction_temperature(mcp9600_handle_t *handle, int16_t *
     {
         return 3;                                                                                     /* return error */
     }
+#endif
     
     res = a_mcp9600_iic_read(handle, MCP9600_REG_THERMOCOUPLE_HOT_JUNCTION, (uint8_t *)buf, 2);       /* read config */
     if (res != 0)                                                                                     /* check result */
@@ -894,11 +2484,12 @@ uint8_t mcp9600_get_hot_junction_temperature(mcp9600_handle_t *handle, int16_t *
     }
     
     *raw = (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);                                               /* get raw data */
-    *s = (float)(*raw) / 16.0f;                                                                       /* convert the data */
+    *mc = a_mcp9600_milli(*raw);                                                                      /* convert the data */
     
     return 0;                                                                                         /* success return 0 */
 }
 
+#if (MCP9600_FLOAT_API != 0)
 /**
  * @brief      get the junction thermocouple delta
  * @param[in]  *handle pointer to an mcp9600 handle structure
@@ -916,6 +2507,7 @@ uint8_t mcp9600_get_junction_thermocouple_delta(mcp9600_handle_t *handle, int16_
     uint8_t res;
     uint8_t buf[2];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                                 /* check handle */
     {
         return 2;                                                                                       /* return error */
@@ -924,6 +2516,7 @@ uint8_t mcp9600_get_junction_thermocouple_delta(mcp9600_handle_t *handle, int16_
     {
         return 3;                                                                                       /* return error */
     }
+#endif
     
     res = a_mcp9600_iic_read(handle, MCP9600_REG_JUNCTIONS_TEMPERATURE_DELTA, (uint8_t *)buf, 2);       /* read config */
     if (res != 0)                                                                                       /* check result */
@@ -938,7 +2531,51 @@ uint8_t mcp9600_get_junction_thermocouple_delta(mcp9600_handle_t *handle, int16_
     
     return 0;                                                                                           /* success return 0 */
 }
+#endif
+
+/**
+ * @brief      get the junction thermocouple delta in fixed point
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *mc pointer to a converted temperature buffer in mC
+ * @return     status code
+ *             - 0 success
+ *             - 1 get junction thermocouple delta failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_get_junction_thermocouple_delta_fixed(mcp9600_handle_t *handle, int16_t *raw, int32_t *mc)
+{
+    uint8_t res;
+    uint8_t buf[2];
+    
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                                                 /* check handle */
+    {
+        return 2;                                                                                       /* return error */
+    }
+    if (handle->inited != 1)                                                                            /* check handle initialization */
+    {
+        return 3;                                                                                       /* return error */
+    }
+#endif
+    
+    res = a_mcp9600_iic_read(handle, MCP9600_REG_JUNCTIONS_TEMPERATURE_DELTA, (uint8_t *)buf, 2);       /* read config */
+    if (res != 0)                                                                                       /* check result */
+    {
+        handle->debug_print("mcp9600: read junction thermocouple delta failed.\n");                     /* junction thermocouple delta failed */
+       
+        return 1;                                                                                       /* return error */
+    }
+    
+    *raw = (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);                                                 /* get raw data */
+    *mc = a_mcp9600_milli(*raw);                                                                        /* convert the data */
+    
+    return 0;                                                                                           /* success return 0 */
+}
 
+#if (MCP9600_FLOAT_API != 0)
 /**
  * @brief      get the cold junction temperature
  * @param[in]  *handle pointer to an mcp9600 handle structure
@@ -957,6 +2594,7 @@ uint8_t mcp9600_get_cold_junction_temperature(mcp9600_handle_t *handle, int16_t
     uint8_t reg;
     uint8_t buf[2];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                               /* check handle */
     {
         return 2;                                                                                     /* return error */
@@ -965,8 +2603,9 @@ uint8_t mcp9600_get_cold_junction_temperature(mcp9600_handle_t *handle, int16_t
     {
         return 3;                                                                                     /* return error */
     }
+#endif
     
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);           /* read config */
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);         /* read config */
     if (res != 0)                                                                                     /* check result */
     {
         handle->debug_print("mcp9600: read device configuration failed.\n");                          /* read device configuration failed */
@@ -994,28 +2633,27 @@ uint8_t mcp9600_get_cold_junction_temperature(mcp9600_handle_t *handle, int16_t
     
     return 0;                                                                                         /* success return 0 */
 }
+#endif
 
 /**
- * @brief      get the raw adc
+ * @brief      get the cold junction temperature in fixed point
  * @param[in]  *handle pointer to an mcp9600 handle structure
- * @param[out] *raw pointer to a raw adc buffer
- * @param[out] *uv pointer to a converted voltage buffer
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *mc pointer to a converted temperature buffer in mC
  * @return     status code
  *             - 0 success
- *             - 1 get raw adc failed
+ *             - 1 get cold junction temperature failed
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mcp9600_get_raw_adc(mcp9600_handle_t *handle, int32_t *raw, double *uv)
+uint8_t mcp9600_get_cold_junction_temperature_fixed(mcp9600_handle_t *handle, int16_t *raw, int32_t *mc)
 {
     uint8_t res;
     uint8_t reg;
-    uint8_t shift;
-    uint16_t mask;
-    uint8_t buf[3];
-    double resolution;
+    uint8_t buf[2];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                               /* check handle */
     {
         return 2;                                                                                     /* return error */
@@ -1024,8 +2662,56 @@ uint8_t mcp9600_get_raw_adc(mcp9600_handle_t *handle, int32_t *raw, double *uv)
     {
         return 3;                                                                                     /* return error */
     }
+#endif
+    
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);         /* read config */
+    if (res != 0)                                                                                     /* check result */
+    {
+        handle->debug_print("mcp9600: read device configuration failed.\n");                          /* read device configuration failed */
+       
+        return 1;                                                                                     /* return error */
+    }
+    
+    res = a_mcp9600_iic_read(handle, MCP9600_REG_COLD_JUNCTION_TEMPERATURE, (uint8_t *)buf, 2);       /* read config */
+    if (res != 0)                                                                                     /* check result */
+    {
+        handle->debug_print("mcp9600: read cold junction temperature failed.\n");                     /* read cold junction temperature failed */
+       
+        return 1;                                                                                     /* return error */
+    }
+    
+    *raw = (int16_t)(((uint16_t)buf[0] << 8) | buf[1]);                                               /* get raw data */
+    if (((reg >> 7) & 0x01) == 0)                                                                     /* check the config */
+    {
+        *mc = a_mcp9600_milli(*raw);                                                                  /* convert the data */
+    }
+    else
+    {
+        *mc = (int32_t)(*raw) * 250;                                                                  /* convert the data */
+    }
+    
+    return 0;                                                                                         /* success return 0 */
+}
+
+/**
+ * @brief      read the raw adc data
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *raw pointer to a raw adc buffer
+ * @param[out] *resolution pointer to an adc resolution buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       none
+ */
+static uint8_t a_mcp9600_get_raw_adc(mcp9600_handle_t *handle, int32_t *raw, uint8_t *resolution)
+{
+    uint8_t res;
+    uint8_t reg;
+    uint8_t shift;
+    uint16_t mask;
+    uint8_t buf[3];
     
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);           /* read config */
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);         /* read config */
     if (res != 0)                                                                                     /* check result */
     {
         handle->debug_print("mcp9600: read device configuration failed.\n");                          /* read device configuration failed */
@@ -1034,27 +2720,24 @@ uint8_t mcp9600_get_raw_adc(mcp9600_handle_t *handle, int32_t *raw, double *uv)
     }
     
     reg = (reg >> 5) & 0x3;                                                                           /* get type */
+    *resolution = reg;                                                                                /* save resolution */
     if (reg == 0x0)                                                                                   /* get 18 bit */
     {
-        resolution = 2.0;                                                                             /* set 2.0 */
         shift = 0;                                                                                    /* set shift 0 */
         mask = 0x0;                                                                                   /* set mask 0x0 */
     }
     else if (reg == 0x1)                                                                              /* get 16 bit */
     {
-        resolution = 8.0;                                                                             /* set 8.0 */
         shift = 2;                                                                                    /* set shift 2 */
         mask = 0x03;                                                                                  /* set mask 0x03 */
     }
     else if (reg == 0x2)                                                                              /* get 14 bit */
     {
-        resolution = 32.0;                                                                            /* set 32.0 */
         shift = 4;                                                                                    /* set shift 4 */
         mask = 0x0F;                                                                                  /* set mask 0x0F */
     }
     else                                                                                              /* get 12 bit */
     {
-        resolution = 128.0;                                                                           /* set 128.0 */
         shift = 6;                                                                                    /* set shift 6 */
         mask = 0x3F;                                                                                  /* set mask 0x3F */
     }
@@ -1081,7 +2764,79 @@ uint8_t mcp9600_get_raw_adc(mcp9600_handle_t *handle, int32_t *raw, double *uv)
         *raw = ((*raw) >> shift);                                                                     /* set raw */
     }
     
-    *uv = (double)(*raw) * resolution;                                                                /* convert the data */
+    return 0;                                                                                         /* success return 0 */
+}
+
+#if (MCP9600_FLOAT_API != 0)
+/**
+ * @brief      get the raw adc
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *raw pointer to a raw adc buffer
+ * @param[out] *uv pointer to a converted voltage buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get raw adc failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_get_raw_adc(mcp9600_handle_t *handle, int32_t *raw, double *uv)
+{
+    uint8_t resolution;
+    
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                                               /* check handle */
+    {
+        return 2;                                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                                          /* check handle initialization */
+    {
+        return 3;                                                                                     /* return error */
+    }
+#endif
+    
+    if (a_mcp9600_get_raw_adc(handle, raw, (uint8_t *)&resolution) != 0)                              /* read raw adc */
+    {
+        return 1;                                                                                     /* return error */
+    }
+    *uv = (double)(*raw) * (double)(2 << (resolution * 2));                                           /* 2, 8, 32 or 128 uV */
+    
+    return 0;                                                                                         /* success return 0 */
+}
+#endif
+
+/**
+ * @brief      get the raw adc in fixed point
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *raw pointer to a raw adc buffer
+ * @param[out] *nv pointer to a converted voltage buffer in nV
+ * @return     status code
+ *             - 0 success
+ *             - 1 get raw adc failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_get_raw_adc_fixed(mcp9600_handle_t *handle, int32_t *raw, int32_t *nv)
+{
+    uint8_t resolution;
+    
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                                               /* check handle */
+    {
+        return 2;                                                                                     /* return error */
+    }
+    if (handle->inited != 1)                                                                          /* check handle initialization */
+    {
+        return 3;                                                                                     /* return error */
+    }
+#endif
+    
+    if (a_mcp9600_get_raw_adc(handle, raw, (uint8_t *)&resolution) != 0)                              /* read raw adc */
+    {
+        return 1;                                                                                     /* return error */
+    }
+    *nv = (*raw) * ((int32_t)2000 << (resolution * 2));                                               /* 2000, 8000, 32000 or 128000 nV */
     
     return 0;                                                                                         /* success return 0 */
 }
@@ -1102,6 +2857,7 @@ uint8_t mcp9600_set_cold_junction_resolution(mcp9600_handle_t *handle, mcp9600_c
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                           /* check handle */
     {
         return 2;                                                                                 /* return error */
@@ -1110,11 +2866,14 @@ uint8_t mcp9600_set_cold_junction_resolution(mcp9600_handle_t *handle, mcp9600_c
     {
         return 3;                                                                                 /* return error */
     }
+#endif
     
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);       /* read config */
+    a_mcp9600_bus_lock(handle);                                                                   /* lock the bus */
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);     /* read config */
     if (res != 0)                                                                                 /* check result */
     {
         handle->debug_print("mcp9600: read device configuration failed.\n");                      /* read device configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                             /* unlock the bus */
        
         return 1;                                                                                 /* return error */
     }
@@ -1125,9 +2884,11 @@ uint8_t mcp9600_set_cold_junction_resolution(mcp9600_handle_t *handle, mcp9600_c
     if (res != 0)                                                                                 /* check result */
     {
         handle->debug_print("mcp9600: write device configuration failed.\n");                     /* write device configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                             /* unlock the bus */
        
         return 1;                                                                                 /* return error */
     }
+    a_mcp9600_bus_unlock(handle);                                                                 /* unlock the bus */
     
     return 0;                                                                                     /* success return 0 */
 }
@@ -1148,6 +2909,7 @@ uint8_t mcp9600_get_cold_junction_resolution(mcp9600_handle_t *handle, mcp9600_c
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                           /* check handle */
     {
         return 2;                                                                                 /* return error */
@@ -1156,8 +2918,9 @@ uint8_t mcp9600_get_cold_junction_resolution(mcp9600_handle_t *handle, mcp9600_c
     {
         return 3;                                                                                 /* return error */
     }
+#endif
     
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);       /* read config */
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);     /* read config */
     if (res != 0)                                                                                 /* check result */
     {
         handle->debug_print("mcp9600: read device configuration failed.\n");                      /* read device configuration failed */
@@ -1186,6 +2949,7 @@ uint8_t mcp9600_set_adc_resolution(mcp9600_handle_t *handle, mcp9600_adc_resolut
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                           /* check handle */
     {
         return 2;                                                                                 /* return error */
@@ -1194,11 +2958,14 @@ uint8_t mcp9600_set_adc_resolution(mcp9600_handle_t *handle, mcp9600_adc_resolut
     {
         return 3;                                                                                 /* return error */
     }
+#endif
     
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);       /* read config */
+    a_mcp9600_bus_lock(handle);                                                                   /* lock the bus */
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);     /* read config */
     if (res != 0)                                                                                 /* check result */
     {
         handle->debug_print("mcp9600: read device configuration failed.\n");                      /* read device configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                             /* unlock the bus */
        
         return 1;                                                                                 /* return error */
     }
@@ -1209,9 +2976,11 @@ uint8_t mcp9600_set_adc_resolution(mcp9600_handle_t *handle, mcp9600_adc_resolut
     if (res != 0)                                                                                 /* check result */
     {
         handle->debug_print("mcp9600: write device configuration failed.\n");                     /* write device configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                             /* unlock the bus */
        
         return 1;                                                                                 /* return error */
     }
+    a_mcp9600_bus_unlock(handle);                                                                 /* unlock the bus */
     
     return 0;                                                                                     /* success return 0 */
 }
@@ -1232,6 +3001,7 @@ uint8_t mcp9600_get_adc_resolution(mcp9600_handle_t *handle, mcp9600_adc_resolut
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                           /* check handle */
     {
         return 2;                                                                                 /* return error */
@@ -1240,8 +3010,9 @@ uint8_t mcp9600_get_adc_resolution(mcp9600_handle_t *handle, mcp9600_adc_resolut
     {
         return 3;                                                                                 /* return error */
     }
+#endif
     
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);       /* read config */
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);     /* read config */
     if (res != 0)                                                                                 /* check result */
     {
         handle->debug_print("mcp9600: read device configuration failed.\n");                      /* read device configuration failed */
@@ -1270,6 +3041,7 @@ uint8_t mcp9600_set_burst_mode_sample(mcp9600_handle_t *handle, mcp9600_burst_mo
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                           /* check handle */
     {
         return 2;                                                                                 /* return error */
@@ -1278,11 +3050,14 @@ uint8_t mcp9600_set_burst_mode_sample(mcp9600_handle_t *handle, mcp9600_burst_mo
     {
         return 3;                                                                                 /* return error */
     }
+#endif
     
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);       /* read config */
+    a_mcp9600_bus_lock(handle);                                                                   /* lock the bus */
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);     /* read config */
     if (res != 0)                                                                                 /* check result */
     {
         handle->debug_print("mcp9600: read device configuration failed.\n");                      /* read device configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                             /* unlock the bus */
        
         return 1;                                                                                 /* return error */
     }
@@ -1293,9 +3068,11 @@ uint8_t mcp9600_set_burst_mode_sample(mcp9600_handle_t *handle, mcp9600_burst_mo
     if (res != 0)                                                                                 /* check result */
     {
         handle->debug_print("mcp9600: write device configuration failed.\n");                     /* write device configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                             /* unlock the bus */
        
         return 1;                                                                                 /* return error */
     }
+    a_mcp9600_bus_unlock(handle);                                                                 /* unlock the bus */
     
     return 0;                                                                                     /* success return 0 */
 }
@@ -1316,6 +3093,7 @@ uint8_t mcp9600_get_burst_mode_sample(mcp9600_handle_t *handle, mcp9600_burst_mo
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                           /* check handle */
     {
         return 2;                                                                                 /* return error */
@@ -1324,8 +3102,9 @@ uint8_t mcp9600_get_burst_mode_sample(mcp9600_handle_t *handle, mcp9600_burst_mo
     {
         return 3;                                                                                 /* return error */
     }
+#endif
     
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);       /* read config */
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);     /* read config */
     if (res != 0)                                                                                 /* check result */
     {
         handle->debug_print("mcp9600: read device configuration failed.\n");                      /* read device configuration failed */
@@ -1354,6 +3133,7 @@ uint8_t mcp9600_set_mode(mcp9600_handle_t *handle, mcp9600_mode_t mode)
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                           /* check handle */
     {
         return 2;                                                                                 /* return error */
@@ -1362,11 +3142,14 @@ uint8_t mcp9600_set_mode(mcp9600_handle_t *handle, mcp9600_mode_t mode)
     {
         return 3;                                                                                 /* return error */
     }
+#endif
     
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);       /* read config */
+    a_mcp9600_bus_lock(handle);                                                                   /* lock the bus */
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);     /* read config */
     if (res != 0)                                                                                 /* check result */
     {
         handle->debug_print("mcp9600: read device configuration failed.\n");                      /* read device configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                             /* unlock the bus */
        
         return 1;                                                                                 /* return error */
     }
@@ -1377,9 +3160,11 @@ uint8_t mcp9600_set_mode(mcp9600_handle_t *handle, mcp9600_mode_t mode)
     if (res != 0)                                                                                 /* check result */
     {
         handle->debug_print("mcp9600: write device configuration failed.\n");                     /* write device configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                             /* unlock the bus */
        
         return 1;                                                                                 /* return error */
     }
+    a_mcp9600_bus_unlock(handle);                                                                 /* unlock the bus */
     
     return 0;                                                                                     /* success return 0 */
 }
@@ -1400,6 +3185,7 @@ uint8_t mcp9600_get_mode(mcp9600_handle_t *handle, mcp9600_mode_t *mode)
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                           /* check handle */
     {
         return 2;                                                                                 /* return error */
@@ -1408,6 +3194,7 @@ uint8_t mcp9600_get_mode(mcp9600_handle_t *handle, mcp9600_mode_t *mode)
     {
         return 3;                                                                                 /* return error */
     }
+#endif
     
     res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);       /* read config */
     if (res != 0)                                                                                 /* check result */
@@ -1438,6 +3225,7 @@ uint8_t mcp9600_set_thermocouple_type(mcp9600_handle_t *handle, mcp9600_thermoco
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                                        /* check handle */
     {
         return 2;                                                                                              /* return error */
@@ -1446,11 +3234,14 @@ uint8_t mcp9600_set_thermocouple_type(mcp9600_handle_t *handle, mcp9600_thermoco
     {
         return 3;                                                                                              /* return error */
     }
+#endif
     
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_THERMOCOUPLE_SENSOR_CONFIGURATION, (uint8_t *)&reg, 1);       /* read config */
+    a_mcp9600_bus_lock(handle);                                                                                /* lock the bus */
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_THERMOCOUPLE_SENSOR_CONFIGURATION, (uint8_t *)&reg, 1);     /* read config */
     if (res != 0)                                                                                              /* check result */
     {
         handle->debug_print("mcp9600: read thermocouple sensor configuration failed.\n");                      /* read thermocouple sensor configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                                          /* unlock the bus */
        
         return 1;                                                                                              /* return error */
     }
@@ -1461,9 +3252,11 @@ uint8_t mcp9600_set_thermocouple_type(mcp9600_handle_t *handle, mcp9600_thermoco
     if (res != 0)                                                                                              /* check result */
     {
         handle->debug_print("mcp9600: write thermocouple sensor configuration failed.\n");                     /* write thermocouple sensor configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                                          /* unlock the bus */
        
         return 1;                                                                                              /* return error */
     }
+    a_mcp9600_bus_unlock(handle);                                                                              /* unlock the bus */
     
     return 0;                                                                                                  /* success return 0 */
 }
@@ -1484,6 +3277,7 @@ uint8_t mcp9600_get_thermocouple_type(mcp9600_handle_t *handle, mcp9600_thermoco
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                                        /* check handle */
     {
         return 2;                                                                                              /* return error */
@@ -1492,8 +3286,9 @@ uint8_t mcp9600_get_thermocouple_type(mcp9600_handle_t *handle, mcp9600_thermoco
     {
         return 3;                                                                                              /* return error */
     }
+#endif
     
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_THERMOCOUPLE_SENSOR_CONFIGURATION, (uint8_t *)&reg, 1);       /* read config */
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_THERMOCOUPLE_SENSOR_CONFIGURATION, (uint8_t *)&reg, 1);     /* read config */
     if (res != 0)                                                                                              /* check result */
     {
         handle->debug_print("mcp9600: read thermocouple sensor configuration failed.\n");                      /* read thermocouple sensor configuration failed */
@@ -1521,6 +3316,7 @@ uint8_t mcp9600_set_filter_coefficient(mcp9600_handle_t *handle, mcp9600_filter_
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                                        /* check handle */
     {
         return 2;                                                                                              /* return error */
@@ -1529,11 +3325,14 @@ uint8_t mcp9600_set_filter_coefficient(mcp9600_handle_t *handle, mcp9600_filter_
     {
         return 3;                                                                                              /* return error */
     }
+#endif
     
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_THERMOCOUPLE_SENSOR_CONFIGURATION, (uint8_t *)&reg, 1);       /* read config */
+    a_mcp9600_bus_lock(handle);                                                                                /* lock the bus */
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_THERMOCOUPLE_SENSOR_CONFIGURATION, (uint8_t *)&reg, 1);     /* read config */
     if (res != 0)                                                                                              /* check result */
     {
         handle->debug_print("mcp9600: read thermocouple sensor configuration failed.\n");                      /* read thermocouple sensor configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                                          /* unlock the bus */
        
         return 1;                                                                                              /* return error */
     }
@@ -1544,9 +3343,11 @@ uint8_t mcp9600_set_filter_coefficient(mcp9600_handle_t *handle, mcp9600_filter_
     if (res != 0)                                                                                              /* check result */
     {
         handle->debug_print("mcp9600: write thermocouple sensor configuration failed.\n");                     /* write thermocouple sensor configuration failed */
+        a_mcp9600_bus_unlock(handle);                                                                          /* unlock the bus */
        
         return 1;                                                                                              /* return error */
     }
+    a_mcp9600_bus_unlock(handle);                                                                              /* unlock the bus */
     
     return 0;                                                                                                  /* success return 0 */
 }
@@ -1567,6 +3368,7 @@ uint8_t mcp9600_get_filter_coefficient(mcp9600_handle_t *handle, mcp9600_filter_
     uint8_t res;
     uint8_t reg;
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                                        /* check handle */
     {
         return 2;                                                                                              /* return error */
@@ -1575,8 +3377,9 @@ uint8_t mcp9600_get_filter_coefficient(mcp9600_handle_t *handle, mcp9600_filter_
     {
         return 3;                                                                                              /* return error */
     }
+#endif
     
-    res = a_mcp9600_iic_read(handle, MCP9600_REG_THERMOCOUPLE_SENSOR_CONFIGURATION, (uint8_t *)&reg, 1);       /* read config */
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_THERMOCOUPLE_SENSOR_CONFIGURATION, (uint8_t *)&reg, 1);     /* read config */
     if (res != 0)                                                                                              /* check result */
     {
         handle->debug_print("mcp9600: read thermocouple sensor configuration failed.\n");                      /* read thermocouple sensor configuration failed */
@@ -1588,6 +3391,7 @@ uint8_t mcp9600_get_filter_coefficient(mcp9600_handle_t *handle, mcp9600_filter_
     return 0;                                                                                                  /* success return 0 */
 }
 
+#if (MCP9600_FLOAT_API != 0)
 /**
  * @brief      convert the alert limit to the register raw data
  * @param[in]  *handle pointer to an mcp9600 handle structure
@@ -1601,6 +3405,7 @@ uint8_t mcp9600_get_filter_coefficient(mcp9600_handle_t *handle, mcp9600_filter_
  */
 uint8_t mcp9600_alert_limit_convert_to_register(mcp9600_handle_t *handle, float c, int16_t *reg)
 {
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                 /* check handle */
     {
         return 2;                       /* return error */
@@ -1609,12 +3414,48 @@ uint8_t mcp9600_alert_limit_convert_to_register(mcp9600_handle_t *handle, float
     {
         return 3;                       /* return error */
     }
+#else
+    (void)handle;                       /* unused */
+#endif
     
     *reg = (int16_t)(c * 16.0f);        /* convert */
     
     return 0;                           /* success return 0 */
 }
+#endif
+
+/**
+ * @brief      convert the alert limit in fixed point to the register raw data
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[in]  mc alert limit in mC
+ * @param[out] *reg pointer to a register raw buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_alert_limit_convert_to_register_fixed(mcp9600_handle_t *handle, int32_t mc, int16_t *reg)
+{
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                 /* check handle */
+    {
+        return 2;                       /* return error */
+    }
+    if (handle->inited != 1)            /* check handle initialization */
+    {
+        return 3;                       /* return error */
+    }
+#else
+    (void)handle;                       /* unused */
+#endif
+    
+    *reg = (int16_t)((mc * 2) / 125);   /* convert */
+    
+    return 0;                           /* success return 0 */
+}
 
+#if (MCP9600_FLOAT_API != 0)
 /**
  * @brief      convert the register raw data to the alert limit
  * @param[in]  *handle pointer to an mcp9600 handle structure
@@ -1628,6 +3469,7 @@ uint8_t mcp9600_alert_limit_convert_to_register(mcp9600_handle_t *handle, float
  */
 uint8_t mcp9600_alert_limit_convert_to_data(mcp9600_handle_t *handle, int16_t reg, float *c)
 {
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)              /* check handle */
     {
         return 2;                    /* return error */
@@ -1636,11 +3478,46 @@ uint8_t mcp9600_alert_limit_convert_to_data(mcp9600_handle_t *handle, int16_t re
     {
         return 3;                    /* return error */
     }
+#else
+    (void)handle;                    /* unused */
+#endif
     
     *c  = (float)reg / 16.0f;        /* convert */
     
     return 0;                        /* success return 0 */
 }
+#endif
+
+/**
+ * @brief      convert the register raw data to the alert limit in fixed point
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[in]  reg register raw data
+ * @param[out] *mc pointer to an alert limit buffer in mC
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_alert_limit_convert_to_data_fixed(mcp9600_handle_t *handle, int16_t reg, int32_t *mc)
+{
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)              /* check handle */
+    {
+        return 2;                    /* return error */
+    }
+    if (handle->inited != 1)         /* check handle initialization */
+    {
+        return 3;                    /* return error */
+    }
+#else
+    (void)handle;                    /* unused */
+#endif
+    
+    *mc = a_mcp9600_milli(reg);      /* convert */
+    
+    return 0;                        /* success return 0 */
+}
 
 /**
  * @brief     set the alert limit
@@ -1661,6 +3538,7 @@ uint8_t mcp9600_set_alert_limit(mcp9600_handle_t *handle, mcp9600_alert_t alert,
     uint8_t reg_addr;
     uint8_t buf[2];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                   /* check handle */
     {
         return 2;                                                         /* return error */
@@ -1669,6 +3547,7 @@ uint8_t mcp9600_set_alert_limit(mcp9600_handle_t *handle, mcp9600_alert_t alert,
     {
         return 3;                                                         /* return error */
     }
+#endif
     
     switch (alert)                                                        /* alert type */
     {
@@ -1745,6 +3624,7 @@ uint8_t mcp9600_get_alert_limit(mcp9600_handle_t *handle, mcp9600_alert_t alert,
     uint8_t reg_addr;
     uint8_t buf[2];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                   /* check handle */
     {
         return 2;                                                         /* return error */
@@ -1753,6 +3633,7 @@ uint8_t mcp9600_get_alert_limit(mcp9600_handle_t *handle, mcp9600_alert_t alert,
     {
         return 3;                                                         /* return error */
     }
+#endif
     
     switch (alert)                                                        /* alert type */
     {
@@ -1797,7 +3678,7 @@ uint8_t mcp9600_get_alert_limit(mcp9600_handle_t *handle, mcp9600_alert_t alert,
         
         return 4;                                                         /* return error */
     }
-    res = a_mcp9600_iic_read(handle, reg_addr, (uint8_t *)buf, 2);        /* get alert limit */
+    res = a_mcp9600_cache_read(handle, reg_addr, (uint8_t *)buf, 2);      /* get alert limit */
     if (res != 0)                                                         /* check result */
     {
         handle->debug_print("mcp9600: get alert limit failed.\n");        /* get alert limit failed */
@@ -1809,6 +3690,7 @@ uint8_t mcp9600_get_alert_limit(mcp9600_handle_t *handle, mcp9600_alert_t alert,
     return 0;                                                             /* success return 0 */
 }
 
+#if (MCP9600_FLOAT_API != 0)
 /**
  * @brief      convert the alert hysteresis to the register raw data
  * @param[in]  *handle pointer to an mcp9600 handle structure
@@ -1820,8 +3702,73 @@ uint8_t mcp9600_get_alert_limit(mcp9600_handle_t *handle, mcp9600_alert_t alert,
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mcp9600_alert_hysteresis_convert_to_register(mcp9600_handle_t *handle, float c, uint8_t *reg)
+uint8_t mcp9600_alert_hysteresis_convert_to_register(mcp9600_handle_t *handle, float c, uint8_t *reg)
+{
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)             /* check handle */
+    {
+        return 2;                   /* return error */
+    }
+    if (handle->inited != 1)        /* check handle initialization */
+    {
+        return 3;                   /* return error */
+    }
+#else
+    (void)handle;                   /* unused */
+#endif
+    
+    *reg = (uint8_t)(c);            /* convert */
+    
+    return 0;                       /* success return 0 */
+}
+#endif
+
+/**
+ * @brief      convert the alert hysteresis in fixed point to the register raw data
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[in]  mc alert hysteresis in mC
+ * @param[out] *reg pointer to a register raw buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_alert_hysteresis_convert_to_register_fixed(mcp9600_handle_t *handle, int32_t mc, uint8_t *reg)
+{
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)             /* check handle */
+    {
+        return 2;                   /* return error */
+    }
+    if (handle->inited != 1)        /* check handle initialization */
+    {
+        return 3;                   /* return error */
+    }
+#else
+    (void)handle;                   /* unused */
+#endif
+    
+    *reg = (uint8_t)(mc / 1000);    /* convert */
+    
+    return 0;                       /* success return 0 */
+}
+
+#if (MCP9600_FLOAT_API != 0)
+/**
+ * @brief      convert the register raw data to the alert hysteresis
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[in]  reg register raw data
+ * @param[out] *c pointer to an alert hysteresis buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_alert_hysteresis_convert_to_data(mcp9600_handle_t *handle, uint8_t reg, float *c)
 {
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)             /* check handle */
     {
         return 2;                   /* return error */
@@ -1830,25 +3777,30 @@ uint8_t mcp9600_alert_hysteresis_convert_to_register(mcp9600_handle_t *handle, f
     {
         return 3;                   /* return error */
     }
+#else
+    (void)handle;                   /* unused */
+#endif
     
-    *reg = (uint8_t)(c);            /* convert */
+    *c  = (float)(reg);             /* convert */
     
     return 0;                       /* success return 0 */
 }
+#endif
 
 /**
- * @brief      convert the register raw data to the alert hysteresis
+ * @brief      convert the register raw data to the alert hysteresis in fixed point
  * @param[in]  *handle pointer to an mcp9600 handle structure
  * @param[in]  reg register raw data
- * @param[out] *c pointer to an alert hysteresis buffer
+ * @param[out] *mc pointer to an alert hysteresis buffer in mC
  * @return     status code
  *             - 0 success
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  * @note       none
  */
-uint8_t mcp9600_alert_hysteresis_convert_to_data(mcp9600_handle_t *handle, uint8_t reg, float *c)
+uint8_t mcp9600_alert_hysteresis_convert_to_data_fixed(mcp9600_handle_t *handle, uint8_t reg, int32_t *mc)
 {
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)             /* check handle */
     {
         return 2;                   /* return error */
@@ -1857,8 +3809,11 @@ uint8_t mcp9600_alert_hysteresis_convert_to_data(mcp9600_handle_t *handle, uint8
     {
         return 3;                   /* return error */
     }
+#else
+    (void)handle;                   /* unused */
+#endif
     
-    *c  = (float)(reg);             /* convert */
+    *mc = (int32_t)(reg) * 1000;    /* convert */
     
     return 0;                       /* success return 0 */
 }
@@ -1882,6 +3837,7 @@ uint8_t mcp9600_set_alert_hysteresis(mcp9600_handle_t *handle, mcp9600_alert_t a
     uint8_t reg_addr;
     uint8_t buf[1];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                        /* check handle */
     {
         return 2;                                                              /* return error */
@@ -1890,6 +3846,7 @@ uint8_t mcp9600_set_alert_hysteresis(mcp9600_handle_t *handle, mcp9600_alert_t a
     {
         return 3;                                                              /* return error */
     }
+#endif
     
     switch (alert)                                                             /* alert type */
     {
@@ -1965,6 +3922,7 @@ uint8_t mcp9600_get_alert_hysteresis(mcp9600_handle_t *handle, mcp9600_alert_t a
     uint8_t reg_addr;
     uint8_t buf[1];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                        /* check handle */
     {
         return 2;                                                              /* return error */
@@ -1973,6 +3931,7 @@ uint8_t mcp9600_get_alert_hysteresis(mcp9600_handle_t *handle, mcp9600_alert_t a
     {
         return 3;                                                              /* return error */
     }
+#endif
     
     switch (alert)                                                             /* alert type */
     {
@@ -2017,7 +3976,7 @@ uint8_t mcp9600_get_alert_hysteresis(mcp9600_handle_t *handle, mcp9600_alert_t a
         
         return 4;                                                              /* return error */
     }
-    res = a_mcp9600_iic_read(handle, reg_addr, (uint8_t *)buf, 1);             /* get alert hysteresis */
+    res = a_mcp9600_cache_read(handle, reg_addr, (uint8_t *)buf, 1);           /* get alert hysteresis */
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("mcp9600: get alert hysteresis failed.\n");        /* get alert hysteresis failed */
@@ -2047,6 +4006,7 @@ uint8_t mcp9600_clear_interrupt(mcp9600_handle_t *handle, mcp9600_alert_t alert)
     uint8_t reg_addr;
     uint8_t buf[1];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                        /* check handle */
     {
         return 2;                                                              /* return error */
@@ -2055,6 +4015,7 @@ uint8_t mcp9600_clear_interrupt(mcp9600_handle_t *handle, mcp9600_alert_t alert)
     {
         return 3;                                                              /* return error */
     }
+#endif
     
     switch (alert)                                                             /* alert type */
     {
@@ -2099,10 +4060,12 @@ uint8_t mcp9600_clear_interrupt(mcp9600_handle_t *handle, mcp9600_alert_t alert)
         
         return 4;                                                              /* return error */
     }
-    res = a_mcp9600_iic_read(handle, reg_addr, (uint8_t *)buf, 1);             /* get alert config */
+    a_mcp9600_bus_lock(handle);                                                /* lock the bus */
+    res = a_mcp9600_cache_read(handle, reg_addr, (uint8_t *)buf, 1);           /* get alert config */
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("mcp9600: get alert config failed.\n");            /* get alert config failed */
+        a_mcp9600_bus_unlock(handle);                                          /* unlock the bus */
        
         return 1;                                                              /* return error */
     }
@@ -2112,9 +4075,11 @@ uint8_t mcp9600_clear_interrupt(mcp9600_handle_t *handle, mcp9600_alert_t alert)
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("mcp9600: set alert config failed.\n");            /* set alert config failed */
+        a_mcp9600_bus_unlock(handle);                                          /* unlock the bus */
        
         return 1;                                                              /* return error */
     }
+    a_mcp9600_bus_unlock(handle);                                              /* unlock the bus */
     
     return 0;                                                                  /* success return 0 */
 }
@@ -2138,6 +4103,7 @@ uint8_t mcp9600_get_interrupt(mcp9600_handle_t *handle, mcp9600_alert_t alert, u
     uint8_t reg_addr;
     uint8_t buf[1];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                        /* check handle */
     {
         return 2;                                                              /* return error */
@@ -2146,6 +4112,7 @@ uint8_t mcp9600_get_interrupt(mcp9600_handle_t *handle, mcp9600_alert_t alert, u
     {
         return 3;                                                              /* return error */
     }
+#endif
     
     switch (alert)                                                             /* alert type */
     {
@@ -2222,6 +4189,7 @@ uint8_t mcp9600_set_temperature_maintain_detect(mcp9600_handle_t *handle, mcp960
     uint8_t reg_addr;
     uint8_t buf[1];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                        /* check handle */
     {
         return 2;                                                              /* return error */
@@ -2230,6 +4198,7 @@ uint8_t mcp9600_set_temperature_maintain_detect(mcp9600_handle_t *handle, mcp960
     {
         return 3;                                                              /* return error */
     }
+#endif
     
     switch (alert)                                                             /* alert type */
     {
@@ -2274,10 +4243,12 @@ uint8_t mcp9600_set_temperature_maintain_detect(mcp9600_handle_t *handle, mcp960
         
         return 4;                                                              /* return error */
     }
-    res = a_mcp9600_iic_read(handle, reg_addr, (uint8_t *)buf, 1);             /* get alert config */
+    a_mcp9600_bus_lock(handle);                                                /* lock the bus */
+    res = a_mcp9600_cache_read(handle, reg_addr, (uint8_t *)buf, 1);           /* get alert config */
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("mcp9600: get alert config failed.\n");            /* get alert config failed */
+        a_mcp9600_bus_unlock(handle);                                          /* unlock the bus */
        
         return 1;                                                              /* return error */
     }
@@ -2287,9 +4258,11 @@ uint8_t mcp9600_set_temperature_maintain_detect(mcp9600_handle_t *handle, mcp960
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("mcp9600: set alert config failed.\n");            /* set alert config failed */
+        a_mcp9600_bus_unlock(handle);                                          /* unlock the bus */
        
         return 1;                                                              /* return error */
     }
+    a_mcp9600_bus_unlock(handle);                                              /* unlock the bus */
     
     return 0;                                                                  /* success return 0 */
 }
@@ -2314,6 +4287,7 @@ uint8_t mcp9600_get_temperature_maintain_detect(mcp9600_handle_t *handle, mcp960
     uint8_t reg_addr;
     uint8_t buf[1];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                      /* check handle */
     {
         return 2;                                                                            /* return error */
@@ -2322,6 +4296,7 @@ uint8_t mcp9600_get_temperature_maintain_detect(mcp9600_handle_t *handle, mcp960
     {
         return 3;                                                                            /* return error */
     }
+#endif
     
     switch (alert)                                                                           /* alert type */
     {
@@ -2366,7 +4341,7 @@ uint8_t mcp9600_get_temperature_maintain_detect(mcp9600_handle_t *handle, mcp960
         
         return 4;                                                                            /* return error */
     }
-    res = a_mcp9600_iic_read(handle, reg_addr, (uint8_t *)buf, 1);                           /* get alert config */
+    res = a_mcp9600_cache_read(handle, reg_addr, (uint8_t *)buf, 1);                         /* get alert config */
     if (res != 0)                                                                            /* check result */
     {
         handle->debug_print("mcp9600: get alert config failed.\n");                          /* get alert config failed */
@@ -2397,6 +4372,7 @@ uint8_t mcp9600_set_detect_edge(mcp9600_handle_t *handle, mcp9600_alert_t alert,
     uint8_t reg_addr;
     uint8_t buf[1];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                        /* check handle */
     {
         return 2;                                                              /* return error */
@@ -2405,6 +4381,7 @@ uint8_t mcp9600_set_detect_edge(mcp9600_handle_t *handle, mcp9600_alert_t alert,
     {
         return 3;                                                              /* return error */
     }
+#endif
     
     switch (alert)                                                             /* alert type */
     {
@@ -2449,10 +4426,12 @@ uint8_t mcp9600_set_detect_edge(mcp9600_handle_t *handle, mcp9600_alert_t alert,
         
         return 4;                                                              /* return error */
     }
-    res = a_mcp9600_iic_read(handle, reg_addr, (uint8_t *)buf, 1);             /* get alert config */
+    a_mcp9600_bus_lock(handle);                                                /* lock the bus */
+    res = a_mcp9600_cache_read(handle, reg_addr, (uint8_t *)buf, 1);           /* get alert config */
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("mcp9600: get alert config failed.\n");            /* get alert config failed */
+        a_mcp9600_bus_unlock(handle);                                          /* unlock the bus */
        
         return 1;                                                              /* return error */
     }
@@ -2462,9 +4441,11 @@ uint8_t mcp9600_set_detect_edge(mcp9600_handle_t *handle, mcp9600_alert_t alert,
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("mcp9600: set alert config failed.\n");            /* set alert config failed */
+        a_mcp9600_bus_unlock(handle);                                          /* unlock the bus */
        
         return 1;                                                              /* return error */
     }
+    a_mcp9600_bus_unlock(handle);                                              /* unlock the bus */
     
     return 0;                                                                  /* success return 0 */
 }
@@ -2488,6 +4469,7 @@ uint8_t mcp9600_get_detect_edge(mcp9600_handle_t *handle, mcp9600_alert_t alert,
     uint8_t reg_addr;
     uint8_t buf[1];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                        /* check handle */
     {
         return 2;                                                              /* return error */
@@ -2496,6 +4478,7 @@ uint8_t mcp9600_get_detect_edge(mcp9600_handle_t *handle, mcp9600_alert_t alert,
     {
         return 3;                                                              /* return error */
     }
+#endif
     
     switch (alert)                                                             /* alert type */
     {
@@ -2540,7 +4523,7 @@ uint8_t mcp9600_get_detect_edge(mcp9600_handle_t *handle, mcp9600_alert_t alert,
         
         return 4;                                                              /* return error */
     }
-    res = a_mcp9600_iic_read(handle, reg_addr, (uint8_t *)buf, 1);             /* get alert config */
+    res = a_mcp9600_cache_read(handle, reg_addr, (uint8_t *)buf, 1);           /* get alert config */
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("mcp9600: get alert config failed.\n");            /* get alert config failed */
@@ -2571,6 +4554,7 @@ uint8_t mcp9600_set_active_level(mcp9600_handle_t *handle, mcp9600_alert_t alert
     uint8_t reg_addr;
     uint8_t buf[1];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                        /* check handle */
     {
         return 2;                                                              /* return error */
@@ -2579,6 +4563,7 @@ uint8_t mcp9600_set_active_level(mcp9600_handle_t *handle, mcp9600_alert_t alert
     {
         return 3;                                                              /* return error */
     }
+#endif
     
     switch (alert)                                                             /* alert type */
     {
@@ -2623,10 +4608,12 @@ uint8_t mcp9600_set_active_level(mcp9600_handle_t *handle, mcp9600_alert_t alert
         
         return 4;                                                              /* return error */
     }
-    res = a_mcp9600_iic_read(handle, reg_addr, (uint8_t *)buf, 1);             /* get alert config */
+    a_mcp9600_bus_lock(handle);                                                /* lock the bus */
+    res = a_mcp9600_cache_read(handle, reg_addr, (uint8_t *)buf, 1);           /* get alert config */
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("mcp9600: get alert config failed.\n");            /* get alert config failed */
+        a_mcp9600_bus_unlock(handle);                                          /* unlock the bus */
        
         return 1;                                                              /* return error */
     }
@@ -2636,9 +4623,11 @@ uint8_t mcp9600_set_active_level(mcp9600_handle_t *handle, mcp9600_alert_t alert
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("mcp9600: set alert config failed.\n");            /* set alert config failed */
+        a_mcp9600_bus_unlock(handle);                                          /* unlock the bus */
        
         return 1;                                                              /* return error */
     }
+    a_mcp9600_bus_unlock(handle);                                              /* unlock the bus */
     
     return 0;                                                                  /* success return 0 */
 }
@@ -2662,6 +4651,7 @@ uint8_t mcp9600_get_active_level(mcp9600_handle_t *handle, mcp9600_alert_t alert
     uint8_t reg_addr;
     uint8_t buf[1];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                        /* check handle */
     {
         return 2;                                                              /* return error */
@@ -2670,6 +4660,7 @@ uint8_t mcp9600_get_active_level(mcp9600_handle_t *handle, mcp9600_alert_t alert
     {
         return 3;                                                              /* return error */
     }
+#endif
     
     switch (alert)                                                             /* alert type */
     {
@@ -2714,7 +4705,7 @@ uint8_t mcp9600_get_active_level(mcp9600_handle_t *handle, mcp9600_alert_t alert
         
         return 4;                                                              /* return error */
     }
-    res = a_mcp9600_iic_read(handle, reg_addr, (uint8_t *)buf, 1);             /* get alert config */
+    res = a_mcp9600_cache_read(handle, reg_addr, (uint8_t *)buf, 1);           /* get alert config */
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("mcp9600: get alert config failed.\n");            /* get alert config failed */
@@ -2745,6 +4736,7 @@ uint8_t mcp9600_set_interrupt_mode(mcp9600_handle_t *handle, mcp9600_alert_t ale
     uint8_t reg_addr;
     uint8_t buf[1];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                        /* check handle */
     {
         return 2;                                                              /* return error */
@@ -2753,6 +4745,7 @@ uint8_t mcp9600_set_interrupt_mode(mcp9600_handle_t *handle, mcp9600_alert_t ale
     {
         return 3;                                                              /* return error */
     }
+#endif
     
     switch (alert)                                                             /* alert type */
     {
@@ -2797,10 +4790,12 @@ uint8_t mcp9600_set_interrupt_mode(mcp9600_handle_t *handle, mcp9600_alert_t ale
         
         return 4;                                                              /* return error */
     }
-    res = a_mcp9600_iic_read(handle, reg_addr, (uint8_t *)buf, 1);             /* get alert config */
+    a_mcp9600_bus_lock(handle);                                                /* lock the bus */
+    res = a_mcp9600_cache_read(handle, reg_addr, (uint8_t *)buf, 1);           /* get alert config */
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("mcp9600: get alert config failed.\n");            /* get alert config failed */
+        a_mcp9600_bus_unlock(handle);                                          /* unlock the bus */
        
         return 1;                                                              /* return error */
     }
@@ -2810,9 +4805,11 @@ uint8_t mcp9600_set_interrupt_mode(mcp9600_handle_t *handle, mcp9600_alert_t ale
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("mcp9600: set alert config failed.\n");            /* set alert config failed */
+        a_mcp9600_bus_unlock(handle);                                          /* unlock the bus */
        
         return 1;                                                              /* return error */
     }
+    a_mcp9600_bus_unlock(handle);                                              /* unlock the bus */
     
     return 0;                                                                  /* success return 0 */
 }
@@ -2836,6 +4833,7 @@ uint8_t mcp9600_get_interrupt_mode(mcp9600_handle_t *handle, mcp9600_alert_t ale
     uint8_t reg_addr;
     uint8_t buf[1];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                        /* check handle */
     {
         return 2;                                                              /* return error */
@@ -2844,6 +4842,7 @@ uint8_t mcp9600_get_interrupt_mode(mcp9600_handle_t *handle, mcp9600_alert_t ale
     {
         return 3;                                                              /* return error */
     }
+#endif
     
     switch (alert)                                                             /* alert type */
     {
@@ -2888,7 +4887,7 @@ uint8_t mcp9600_get_interrupt_mode(mcp9600_handle_t *handle, mcp9600_alert_t ale
         
         return 4;                                                              /* return error */
     }
-    res = a_mcp9600_iic_read(handle, reg_addr, (uint8_t *)buf, 1);             /* get alert config */
+    res = a_mcp9600_cache_read(handle, reg_addr, (uint8_t *)buf, 1);           /* get alert config */
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("mcp9600: get alert config failed.\n");            /* get alert config failed */
@@ -2919,6 +4918,7 @@ uint8_t mcp9600_set_alert_output(mcp9600_handle_t *handle, mcp9600_alert_t alert
     uint8_t reg_addr;
     uint8_t buf[1];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                        /* check handle */
     {
         return 2;                                                              /* return error */
@@ -2927,6 +4927,7 @@ uint8_t mcp9600_set_alert_output(mcp9600_handle_t *handle, mcp9600_alert_t alert
     {
         return 3;                                                              /* return error */
     }
+#endif
     
     switch (alert)                                                             /* alert type */
     {
@@ -2971,10 +4972,12 @@ uint8_t mcp9600_set_alert_output(mcp9600_handle_t *handle, mcp9600_alert_t alert
         
         return 4;                                                              /* return error */
     }
-    res = a_mcp9600_iic_read(handle, reg_addr, (uint8_t *)buf, 1);             /* get alert config */
+    a_mcp9600_bus_lock(handle);                                                /* lock the bus */
+    res = a_mcp9600_cache_read(handle, reg_addr, (uint8_t *)buf, 1);           /* get alert config */
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("mcp9600: get alert config failed.\n");            /* get alert config failed */
+        a_mcp9600_bus_unlock(handle);                                          /* unlock the bus */
        
         return 1;                                                              /* return error */
     }
@@ -2984,9 +4987,11 @@ uint8_t mcp9600_set_alert_output(mcp9600_handle_t *handle, mcp9600_alert_t alert
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("mcp9600: set alert config failed.\n");            /* set alert config failed */
+        a_mcp9600_bus_unlock(handle);                                          /* unlock the bus */
        
         return 1;                                                              /* return error */
     }
+    a_mcp9600_bus_unlock(handle);                                              /* unlock the bus */
     
     return 0;                                                                  /* success return 0 */
 }
@@ -3010,6 +5015,7 @@ uint8_t mcp9600_get_alert_output(mcp9600_handle_t *handle, mcp9600_alert_t alert
     uint8_t reg_addr;
     uint8_t buf[1];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                        /* check handle */
     {
         return 2;                                                              /* return error */
@@ -3018,6 +5024,7 @@ uint8_t mcp9600_get_alert_output(mcp9600_handle_t *handle, mcp9600_alert_t alert
     {
         return 3;                                                              /* return error */
     }
+#endif
     
     switch (alert)                                                             /* alert type */
     {
@@ -3062,7 +5069,7 @@ uint8_t mcp9600_get_alert_output(mcp9600_handle_t *handle, mcp9600_alert_t alert
         
         return 4;                                                              /* return error */
     }
-    res = a_mcp9600_iic_read(handle, reg_addr, (uint8_t *)buf, 1);             /* get alert config */
+    res = a_mcp9600_cache_read(handle, reg_addr, (uint8_t *)buf, 1);           /* get alert config */
     if (res != 0)                                                              /* check result */
     {
         handle->debug_print("mcp9600: get alert config failed.\n");            /* get alert config failed */
@@ -3091,6 +5098,7 @@ uint8_t mcp9600_get_device_id_revision(mcp9600_handle_t *handle, uint8_t *id, ui
     uint8_t res;
     uint8_t buf[2];
     
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                                                       /* check handle */
     {
         return 2;                                                                             /* return error */
@@ -3099,6 +5107,7 @@ uint8_t mcp9600_get_device_id_revision(mcp9600_handle_t *handle, uint8_t *id, ui
     {
         return 3;                                                                             /* return error */
     }
+#endif
     
     res = a_mcp9600_iic_read(handle, MCP9600_REG_DEVICE_ID_REVISON, (uint8_t *)buf, 2);       /* read device id */
     if (res != 0)                                                                             /* check result */
@@ -3113,6 +5122,389 @@ uint8_t mcp9600_get_device_id_revision(mcp9600_handle_t *handle, uint8_t *id, ui
     return 0;                                                                                 /* success return 0 */
 }
 
+/**
+ * @brief     set the single read conversion guard band
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @param[in] ms guard band in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      mcp9600_single_read sleeps until the expected conversion time minus the guard band
+ *            and then polls the status register every 1 ms, it can be called before mcp9600_init
+ */
+uint8_t mcp9600_set_conversion_guard(mcp9600_handle_t *handle, uint32_t ms)
+{
+    if (handle == NULL)                          /* check handle */
+    {
+        return 2;                                /* return error */
+    }
+    
+    handle->conversion_guard = ms;               /* set guard */
+    
+    return 0;                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the single read conversion guard band
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *ms pointer to a guard band buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t mcp9600_get_conversion_guard(mcp9600_handle_t *handle, uint32_t *ms)
+{
+    if (handle == NULL)                          /* check handle */
+    {
+        return 2;                                /* return error */
+    }
+    
+    *ms = handle->conversion_guard;              /* get guard */
+    
+    return 0;                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the expected burst conversion time
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *ms pointer to a conversion time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get conversion time failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the time is modeled from the current adc resolution and burst mode sample
+ */
+uint8_t mcp9600_get_conversion_time(mcp9600_handle_t *handle, uint32_t *ms)
+{
+    uint8_t res;
+    uint8_t reg;
+    
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                                           /* check handle */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    if (handle->inited != 1)                                                                      /* check handle initialization */
+    {
+        return 3;                                                                                 /* return error */
+    }
+#endif
+    
+    res = a_mcp9600_cache_read(handle, MCP9600_REG_DEVICE_CONFIGURATION, (uint8_t *)&reg, 1);     /* read config */
+    if (res != 0)                                                                                 /* check result */
+    {
+        handle->debug_print("mcp9600: read device configuration failed.\n");                      /* read device configuration failed */
+       
+        return 1;                                                                                 /* return error */
+    }
+    *ms = a_mcp9600_conversion_time(reg);                                                         /* get conversion time */
+    
+    return 0;                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      get the status poll count of the last single read
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *count pointer to a poll count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t mcp9600_get_single_read_poll_count(mcp9600_handle_t *handle, uint32_t *count)
+{
+    if (handle == NULL)                          /* check handle */
+    {
+        return 2;                                /* return error */
+    }
+    
+    *count = handle->poll_count;                 /* get poll count */
+    
+    return 0;                                    /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable the register cache
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set register cache failed
+ *            - 2 handle is NULL
+ * @note      it can be called before mcp9600_init, the cache is loaded in mcp9600_init or
+ *            immediately when the handle is already initialized
+ */
+uint8_t mcp9600_set_register_cache(mcp9600_handle_t *handle, mcp9600_bool_t enable)
+{
+    if (handle == NULL)                                                          /* check handle */
+    {
+        return 2;                                                                /* return error */
+    }
+    
+    handle->cache_enable = (uint8_t)enable;                                      /* set cache */
+    handle->cache_valid = 0;                                                     /* clear cache */
+    if ((handle->inited == 1) && (enable == MCP9600_BOOL_TRUE))                  /* check handle initialization */
+    {
+        if (a_mcp9600_cache_load(handle) != 0)                                   /* load cache */
+        {
+            handle->debug_print("mcp9600: load register cache failed.\n");       /* load register cache failed */
+            
+            return 1;                                                            /* return error */
+        }
+    }
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief      get the register cache status
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t mcp9600_get_register_cache(mcp9600_handle_t *handle, mcp9600_bool_t *enable)
+{
+    if (handle == NULL)                                               /* check handle */
+    {
+        return 2;                                                     /* return error */
+    }
+    
+    *enable = (mcp9600_bool_t)(handle->cache_enable);                 /* get cache */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief     reload the register cache from the chip
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 refresh register cache failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 register cache is disabled
+ * @note      call it after the registers are changed by another master or a chip reset
+ */
+uint8_t mcp9600_refresh_register_cache(mcp9600_handle_t *handle)
+{
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                      /* check handle */
+    {
+        return 2;                                                            /* return error */
+    }
+    if (handle->inited != 1)                                                 /* check handle initialization */
+    {
+        return 3;                                                            /* return error */
+    }
+#endif
+    if (handle->cache_enable == 0)                                           /* check cache */
+    {
+        handle->debug_print("mcp9600: register cache is disabled.\n");       /* register cache is disabled */
+        
+        return 4;                                                            /* return error */
+    }
+    
+    if (a_mcp9600_cache_load(handle) != 0)                                   /* load cache */
+    {
+        handle->debug_print("mcp9600: load register cache failed.\n");       /* load register cache failed */
+        
+        return 1;                                                            /* return error */
+    }
+    
+    return 0;                                                                /* success return 0 */
+}
+
+#if (MCP9600_STATS != 0)
+/**
+ * @brief      record the latency from an event to the completion of a reading
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[in]  timestamp event timestamp in ns
+ * @param[out] *us pointer to a latency buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 timestamp is null
+ * @note       call it right after the reading, the completion time is taken from the linked timestamp
+ *             function which must share its clock with the event timestamp
+ */
+uint8_t mcp9600_latency_record(mcp9600_handle_t *handle, uint64_t timestamp, uint32_t *us)
+{
+    uint64_t now;
+    uint64_t diff;
+    
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                    /* check handle */
+    {
+        return 2;                                                          /* return error */
+    }
+    if (handle->inited != 1)                                               /* check handle initialization */
+    {
+        return 3;                                                          /* return error */
+    }
+#endif
+    if ((handle->timestamp == NULL) && (handle->timestamp_ctx == NULL))    /* check timestamp */
+    {
+        handle->debug_print("mcp9600: timestamp is null.\n");              /* timestamp is null */
+        
+        return 4;                                                          /* return error */
+    }
+    
+    now = a_mcp9600_timestamp(handle);                                     /* stamp the completion */
+    diff = (now > timestamp) ? ((now - timestamp) / 1000) : 0;             /* get the latency in us */
+    if (diff > 0xFFFFFFFFU)                                                /* check the range */
+    {
+        diff = 0xFFFFFFFFU;                                                /* saturate */
+    }
+    *us = (uint32_t)diff;                                                  /* set the latency */
+    handle->latency_hist[a_mcp9600_latency_bucket(*us)]++;                 /* count the latency */
+    handle->latency_count++;                                               /* count++ */
+    if (*us > handle->latency_max)                                         /* check max */
+    {
+        handle->latency_max = *us;                                         /* set max */
+    }
+    
+    return 0;                                                              /* success return 0 */
+}
+
+/**
+ * @brief      get the latency statistics
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *latency pointer to an mcp9600 latency structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the percentiles are the upper bounds of the histogram buckets capped by the max latency
+ */
+uint8_t mcp9600_latency_get(mcp9600_handle_t *handle, mcp9600_latency_t *latency)
+{
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                 /* check handle */
+    {
+        return 2;                                                       /* return error */
+    }
+    if (handle->inited != 1)                                            /* check handle initialization */
+    {
+        return 3;                                                       /* return error */
+    }
+#endif
+    
+    memset(latency, 0, sizeof(mcp9600_latency_t));                     /* clear the latency */
+    latency->count = handle->latency_count;                             /* set count */
+    latency->max_us = handle->latency_max;                              /* set max */
+    if (handle->latency_count != 0)                                     /* check count */
+    {
+        latency->p50_us = a_mcp9600_latency_percentile(handle->latency_hist, 
+                                                       handle->latency_max, 50);        /* get p50 */
+        latency->p99_us = a_mcp9600_latency_percentile(handle->latency_hist, 
+                                                       handle->latency_max, 99);        /* get p99 */
+    }
+    
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief     clear the latency statistics
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t mcp9600_latency_reset(mcp9600_handle_t *handle)
+{
+#if (MCP9600_TRUSTED == 0)
+    if (handle == NULL)                                                                 /* check handle */
+    {
+        return 2;                                                                       /* return error */
+    }
+    if (handle->inited != 1)                                                            /* check handle initialization */
+    {
+        return 3;                                                                       /* return error */
+    }
+#endif
+    
+    handle->latency_count = 0;                                                          /* clear count */
+    handle->latency_max = 0;                                                            /* clear max */
+    memset(handle->latency_hist, 0, sizeof(uint32_t) * MCP9600_LATENCY_BUCKET);         /* clear histogram */
+    
+    return 0;                                                                           /* success return 0 */
+}
+
+/**
+ * @brief     enable or disable the transport statistics
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      it can be called before mcp9600_init, the latency is only recorded with timestamp linked
+ */
+uint8_t mcp9600_set_stats(mcp9600_handle_t *handle, mcp9600_bool_t enable)
+{
+    if (handle == NULL)                                  /* check handle */
+    {
+        return 2;                                        /* return error */
+    }
+    
+    handle->stats_enable = (uint8_t)enable;              /* set enable */
+    
+    return 0;                                            /* success return 0 */
+}
+
+/**
+ * @brief      get the transport statistics
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *stats pointer to an mcp9600 stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t mcp9600_get_stats(mcp9600_handle_t *handle, mcp9600_stats_t *stats)
+{
+    if (handle == NULL)                                                                         /* check handle */
+    {
+        return 2;                                                                               /* return error */
+    }
+    
+    memcpy(stats, &handle->stats, sizeof(mcp9600_stats_t));                                     /* copy the stats */
+    stats->latency_p50_us = a_mcp9600_latency_percentile(handle->stats.latency_hist, 
+                                                         handle->stats.latency_max_us, 50);     /* get p50 */
+    stats->latency_p99_us = a_mcp9600_latency_percentile(handle->stats.latency_hist, 
+                                                         handle->stats.latency_max_us, 99);     /* get p99 */
+    
+    return 0;                                                                                   /* success return 0 */
+}
+
+/**
+ * @brief     clear the transport statistics
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t mcp9600_reset_stats(mcp9600_handle_t *handle)
+{
+    if (handle == NULL)                                              /* check handle */
+    {
+        return 2;                                                    /* return error */
+    }
+    
+    memset(&handle->stats, 0, sizeof(mcp9600_stats_t));              /* clear the stats */
+    
+    return 0;                                                        /* success return 0 */
+}
+#endif
+
 /**
  * @brief     set the chip register
  * @param[in] *handle pointer to an mcp9600 handle structure
@@ -3128,6 +5520,7 @@ uint8_t mcp9600_get_device_id_revision(mcp9600_handle_t *handle, uint8_t *id, ui
  */
 uint8_t mcp9600_set_reg(mcp9600_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len)
 {
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                      /* check handle */
     {
         return 2;                                            /* return error */
@@ -3136,6 +5529,7 @@ uint8_t mcp9600_set_reg(mcp9600_handle_t *handle, uint8_t reg, uint8_t *buf, uin
     {
         return 3;                                            /* return error */
     }
+#endif
   
     return a_mcp9600_iic_write(handle, reg, buf, len);       /* write data */
 }
@@ -3155,6 +5549,7 @@ uint8_t mcp9600_set_reg(mcp9600_handle_t *handle, uint8_t reg, uint8_t *buf, uin
  */
 uint8_t mcp9600_get_reg(mcp9600_handle_t *handle, uint8_t reg, uint8_t *buf, uint16_t len)
 {
+#if (MCP9600_TRUSTED == 0)
     if (handle == NULL)                                     /* check handle */
     {
         return 2;                                           /* return error */
@@ -3163,6 +5558,7 @@ uint8_t mcp9600_get_reg(mcp9600_handle_t *handle, uint8_t reg, uint8_t *buf, uin
     {
         return 3;                                           /* return error */
     }
+#endif
   
     return a_mcp9600_iic_read(handle, reg, buf, len);       /* read data */
 }
@@ -63,6 +63,12 @@ typedef enum
 {
     MCP9600_ADDRESS_0 = 0xC0,        /**< addr pin connected to the GND */
     MCP9600_ADDRESS_1 = 0xC2,        /**< addr pin connected to the VCC */
+    MCP9600_ADDRESS_2 = 0xC4,        /**< addr pin divider level 2 */
+    MCP9600_ADDRESS_3 = 0xC6,        /**< addr pin divider level 3 */
+    MCP9600_ADDRESS_4 = 0xC8,        /**< addr pin divider level 4 */
+    MCP9600_ADDRESS_5 = 0xCA,        /**< addr pin divider level 5 */
+    MCP9600_ADDRESS_6 = 0xCC,        /**< addr pin divider level 6 */
+    MCP9600_ADDRESS_7 = 0xCE,        /**< addr pin divider level 7 */
 } mcp9600_address_t;
 
 /**
@@ -214,19 +220,144 @@ typedef enum
     MCP9600_INTERRUPT_MODE_INTERRUPT  = 0x01,        /**< interrupt mode */
 } mcp9600_interrupt_mode_t;
 
+/**
+ * @brief mcp9600 latency histogram bucket number definition
+ * @note  bucket i counts the latency in [2^i, 2^(i+1)) us and bucket 0 also counts 0 us
+ */
+#ifndef MCP9600_LATENCY_BUCKET
+    #define MCP9600_LATENCY_BUCKET        32        /**< 32 buckets */
+#endif
+
+/**
+ * @brief mcp9600 statistics definition
+ * @note  set it to 1 to build the transport statistics and the latency api, it adds the counters of
+ *        every register and the latency histograms to each handle
+ */
+#ifndef MCP9600_STATS
+    #define MCP9600_STATS                 0         /**< disable the statistics api */
+#endif
+
+/**
+ * @brief mcp9600 statistics register number definition
+ */
+#ifndef MCP9600_STATS_REGISTER
+    #define MCP9600_STATS_REGISTER        0x21      /**< register 0x00 - 0x20 */
+#endif
+
+/**
+ * @brief mcp9600 float api definition
+ * @note  set it to 0 to build the driver without any float code, only the fixed point api is left
+ */
+#ifndef MCP9600_FLOAT_API
+    #define MCP9600_FLOAT_API             1         /**< enable the float api */
+#endif
+
+/**
+ * @brief mcp9600 static binding definition
+ * @note  set it to 1 to call the transport through the MCP9600_BIND_XXX macros instead of the linked function pointers,
+ *        so the compiler can inline the whole register access path
+ */
+#ifndef MCP9600_STATIC_BINDING
+    #define MCP9600_STATIC_BINDING        0         /**< use the linked function pointers */
+#endif
+
+/**
+ * @brief mcp9600 trusted api definition
+ * @note  set it to 1 to remove the handle NULL and initialization checks from the apis that need an initialized handle,
+ *        the caller must only pass a handle after mcp9600_init succeeded
+ */
+#ifndef MCP9600_TRUSTED
+    #define MCP9600_TRUSTED               0         /**< check the handle in every api */
+#endif
+
+#if (MCP9600_STATIC_BINDING != 0)
+/**
+ * @brief mcp9600 static binding transport definition
+ * @note  each macro can be defined before this header to bind another function, a static inline function
+ *        in a header included before this one is fully inlined, the plain interface functions need lto to be inlined,
+ *        MCP9600_BIND_IIC_READ(USER, ADDR, REG, BUF, LEN) and MCP9600_BIND_IIC_READ_BATCH(USER, ADDR, REG, LEN, NUM, BUF)
+ *        are optional and the register pointer is written by a separate command when they are not defined,
+ *        MCP9600_BIND_BUS_LOCK(USER) and MCP9600_BIND_BUS_UNLOCK(USER) are optional and the bus is not locked
+ *        when they are not defined
+ */
+#ifndef MCP9600_BIND_IIC_INIT
+    #define MCP9600_BIND_IIC_INIT(USER)                             mcp9600_interface_iic_init()
+#endif
+#ifndef MCP9600_BIND_IIC_DEINIT
+    #define MCP9600_BIND_IIC_DEINIT(USER)                           mcp9600_interface_iic_deinit()
+#endif
+#ifndef MCP9600_BIND_IIC_WRITE_COMMAND
+    #define MCP9600_BIND_IIC_WRITE_COMMAND(USER, ADDR, BUF, LEN)    mcp9600_interface_iic_write_cmd(ADDR, BUF, LEN)
+#endif
+#ifndef MCP9600_BIND_IIC_READ_COMMAND
+    #define MCP9600_BIND_IIC_READ_COMMAND(USER, ADDR, BUF, LEN)     mcp9600_interface_iic_read_cmd(ADDR, BUF, LEN)
+#endif
+#ifndef MCP9600_BIND_DELAY_MS
+    #define MCP9600_BIND_DELAY_MS(USER, MS)                         mcp9600_interface_delay_ms(MS)
+#endif
+#endif
+
+#if (MCP9600_STATS != 0)
+/**
+ * @brief mcp9600 stats structure definition
+ */
+typedef struct mcp9600_stats_s
+{
+    uint32_t read_count;                                  /**< read transaction number */
+    uint32_t read_bytes;                                  /**< read byte number */
+    uint32_t read_failed;                                 /**< failed read transaction number */
+    uint32_t write_count;                                 /**< write transaction number */
+    uint32_t write_bytes;                                 /**< written byte number */
+    uint32_t write_failed;                                /**< failed write transaction number */
+    uint32_t reg_count[MCP9600_STATS_REGISTER];           /**< access number of each register */
+    uint32_t latency_max_us;                              /**< max transaction latency in us */
+    uint32_t latency_p50_us;                              /**< 50th percentile transaction latency in us */
+    uint32_t latency_p99_us;                              /**< 99th percentile transaction latency in us */
+    uint32_t latency_hist[MCP9600_LATENCY_BUCKET];        /**< transaction latency histogram */
+} mcp9600_stats_t;
+#endif
+
 /**
  * @brief mcp9600 handle structure definition
  */
 typedef struct mcp9600_handle_s
 {
-    uint8_t (*iic_init)(void);                                                 /**< point to an iic_init function address */
-    uint8_t (*iic_deinit)(void);                                               /**< point to an iic_deinit function address */
-    uint8_t (*iic_write_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);        /**< point to an iic_write_cmd function address */
-    uint8_t (*iic_read_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);         /**< point to an iic_read_cmd function address */
-    void (*delay_ms)(uint32_t ms);                                             /**< point to a delay_ms function address */
-    void (*debug_print)(const char *const fmt, ...);                           /**< point to a debug_print function address */
-    uint8_t inited;                                                            /**< inited flag */
-    uint8_t iic_addr;                                                          /**< iic address */
+    uint8_t (*iic_init)(void);                                                                                          /**< point to an iic_init function address */
+    uint8_t (*iic_deinit)(void);                                                                                        /**< point to an iic_deinit function address */
+    uint8_t (*iic_write_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);                                                 /**< point to an iic_write_cmd function address */
+    uint8_t (*iic_read_cmd)(uint8_t addr, uint8_t *buf, uint16_t len);                                                  /**< point to an iic_read_cmd function address */
+    uint8_t (*iic_read)(uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);                                         /**< point to an iic_read function address */
+    uint8_t (*iic_read_batch)(uint8_t addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf);                    /**< point to an iic_read_batch function address */
+    void (*delay_ms)(uint32_t ms);                                                                                      /**< point to a delay_ms function address */
+    void (*debug_print)(const char *const fmt, ...);                                                                    /**< point to a debug_print function address */
+    uint8_t (*iic_init_ctx)(void *user);                                                                                /**< point to an iic_init_ctx function address */
+    uint8_t (*iic_deinit_ctx)(void *user);                                                                              /**< point to an iic_deinit_ctx function address */
+    uint8_t (*iic_write_cmd_ctx)(void *user, uint8_t addr, uint8_t *buf, uint16_t len);                                 /**< point to an iic_write_cmd_ctx function address */
+    uint8_t (*iic_read_cmd_ctx)(void *user, uint8_t addr, uint8_t *buf, uint16_t len);                                  /**< point to an iic_read_cmd_ctx function address */
+    uint8_t (*iic_read_ctx)(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len);                         /**< point to an iic_read_ctx function address */
+    uint8_t (*iic_read_batch_ctx)(void *user, uint8_t addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf);    /**< point to an iic_read_batch_ctx function address */
+    void (*delay_ms_ctx)(void *user, uint32_t ms);                                                                      /**< point to a delay_ms_ctx function address */
+    void (*bus_lock)(void *user);                                                                                       /**< point to a bus_lock function address */
+    void (*bus_unlock)(void *user);                                                                                     /**< point to a bus_unlock function address */
+    uint64_t (*timestamp)(void);                                                                                        /**< point to a timestamp function address */
+    uint64_t (*timestamp_ctx)(void *user);                                                                              /**< point to a timestamp_ctx function address */
+    void *user;                                                                                                         /**< user context passed to the ctx functions */
+    uint8_t inited;                                                                                                     /**< inited flag */
+    uint8_t lock_depth;                                                                                                 /**< bus lock nesting depth */
+    uint8_t iic_addr;                                                                                                   /**< iic address */
+    uint8_t cache_enable;                                                                                               /**< register cache enable flag */
+    uint16_t cache_valid;                                                                                               /**< register cache valid mask */
+    uint8_t cache[18];                                                                                                  /**< register cache of 0x05, 0x06 and 0x08 - 0x13 */
+    uint32_t conversion_guard;                                                                                          /**< conversion guard band in ms */
+    uint32_t poll_count;                                                                                                /**< status polls of the last single read */
+    uint8_t burst_pending;                                                                                              /**< single read pending flag */
+#if (MCP9600_STATS != 0)
+    uint32_t latency_count;                                                                                             /**< recorded latency number */
+    uint32_t latency_max;                                                                                               /**< max recorded latency in us */
+    uint32_t latency_hist[MCP9600_LATENCY_BUCKET];                                                                      /**< latency histogram */
+    uint8_t stats_enable;                                                                                               /**< statistics enable flag */
+    mcp9600_stats_t stats;                                                                                              /**< transport statistics */
+#endif
 } mcp9600_handle_t;
 
 /**
@@ -245,6 +376,19 @@ typedef struct mcp9600_info_s
     uint32_t driver_version;           /**< driver version */
 } mcp9600_info_t;
 
+#if (MCP9600_STATS != 0)
+/**
+ * @brief mcp9600 latency structure definition
+ */
+typedef struct mcp9600_latency_s
+{
+    uint32_t count;         /**< recorded latency number */
+    uint32_t p50_us;        /**< 50th percentile latency in us */
+    uint32_t p99_us;        /**< 99th percentile latency in us */
+    uint32_t max_us;        /**< max latency in us */
+} mcp9600_latency_t;
+#endif
+
 /**
  * @}
  */
@@ -262,7 +406,7 @@ typedef struct mcp9600_info_s
  * @param[in] STRUCTURE mcp9600_handle_t
  * @note      none
  */
-#define DRIVER_MCP9600_LINK_INIT(HANDLE, STRUCTURE)           memset(HANDLE, 0, sizeof(STRUCTURE))
+#define DRIVER_MCP9600_LINK_INIT(HANDLE, STRUCTURE)                memset(HANDLE, 0, sizeof(STRUCTURE))
 
 /**
  * @brief     link iic_init function
@@ -270,7 +414,7 @@ typedef struct mcp9600_info_s
  * @param[in] FUC pointer to an iic_init function address
  * @note      none
  */
-#define DRIVER_MCP9600_LINK_IIC_INIT(HANDLE, FUC)             (HANDLE)->iic_init = FUC
+#define DRIVER_MCP9600_LINK_IIC_INIT(HANDLE, FUC)                  (HANDLE)->iic_init = FUC
 
 /**
  * @brief     link iic_deinit function
@@ -278,7 +422,7 @@ typedef struct mcp9600_info_s
  * @param[in] FUC pointer to an iic_deinit function address
  * @note      none
  */
-#define DRIVER_MCP9600_LINK_IIC_DEINIT(HANDLE, FUC)           (HANDLE)->iic_deinit = FUC
+#define DRIVER_MCP9600_LINK_IIC_DEINIT(HANDLE, FUC)                (HANDLE)->iic_deinit = FUC
 
 /**
  * @brief     link iic_read_cmd function
@@ -286,7 +430,7 @@ typedef struct mcp9600_info_s
  * @param[in] FUC pointer to an iic_read_cmd function address
  * @note      none
  */
-#define DRIVER_MCP9600_LINK_IIC_READ_COMMAND(HANDLE, FUC)     (HANDLE)->iic_read_cmd = FUC
+#define DRIVER_MCP9600_LINK_IIC_READ_COMMAND(HANDLE, FUC)          (HANDLE)->iic_read_cmd = FUC
 
 /**
  * @brief     link iic_write_cmd function
@@ -294,7 +438,24 @@ typedef struct mcp9600_info_s
  * @param[in] FUC pointer to an iic_write_cmd function address
  * @note      none
  */
-#define DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND(HANDLE, FUC)    (HANDLE)->iic_write_cmd = FUC
+#define DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND(HANDLE, FUC)         (HANDLE)->iic_write_cmd = FUC
+
+/**
+ * @brief     link iic_read function
+ * @param[in] HANDLE pointer to an mcp9600 handle structure
+ * @param[in] FUC pointer to an iic_read function address
+ * @note      optional, the register pointer write and the data read are done
+ *            in one repeated start transaction when it is linked
+ */
+#define DRIVER_MCP9600_LINK_IIC_READ(HANDLE, FUC)                  (HANDLE)->iic_read = FUC
+
+/**
+ * @brief     link iic_read_batch function
+ * @param[in] HANDLE pointer to an mcp9600 handle structure
+ * @param[in] FUC pointer to an iic_read_batch function address
+ * @note      optional, several registers are read in one bus transfer when it is linked
+ */
+#define DRIVER_MCP9600_LINK_IIC_READ_BATCH(HANDLE, FUC)            (HANDLE)->iic_read_batch = FUC
 
 /**
  * @brief     link delay_ms function
@@ -302,7 +463,7 @@ typedef struct mcp9600_info_s
  * @param[in] FUC pointer to a delay_ms function address
  * @note      none
  */
-#define DRIVER_MCP9600_LINK_IIC_DELAY_MS(HANDLE, FUC)         (HANDLE)->delay_ms = FUC
+#define DRIVER_MCP9600_LINK_IIC_DELAY_MS(HANDLE, FUC)              (HANDLE)->delay_ms = FUC
 
 /**
  * @brief     link debug_print function
@@ -310,7 +471,106 @@ typedef struct mcp9600_info_s
  * @param[in] FUC pointer to a debug_print function address
  * @note      none
  */
-#define DRIVER_MCP9600_LINK_DEBUG_PRINT(HANDLE, FUC)          (HANDLE)->debug_print = FUC
+#define DRIVER_MCP9600_LINK_DEBUG_PRINT(HANDLE, FUC)               (HANDLE)->debug_print = FUC
+
+/**
+ * @brief     link iic_init_ctx function
+ * @param[in] HANDLE pointer to an mcp9600 handle structure
+ * @param[in] FUC pointer to an iic_init_ctx function address
+ * @note      optional, it is used instead of the iic_init function and gets the linked user context
+ */
+#define DRIVER_MCP9600_LINK_IIC_INIT_CTX(HANDLE, FUC)              (HANDLE)->iic_init_ctx = FUC
+
+/**
+ * @brief     link iic_deinit_ctx function
+ * @param[in] HANDLE pointer to an mcp9600 handle structure
+ * @param[in] FUC pointer to an iic_deinit_ctx function address
+ * @note      optional, it is used instead of the iic_deinit function and gets the linked user context
+ */
+#define DRIVER_MCP9600_LINK_IIC_DEINIT_CTX(HANDLE, FUC)            (HANDLE)->iic_deinit_ctx = FUC
+
+/**
+ * @brief     link iic_read_cmd_ctx function
+ * @param[in] HANDLE pointer to an mcp9600 handle structure
+ * @param[in] FUC pointer to an iic_read_cmd_ctx function address
+ * @note      optional, it is used instead of the iic_read_cmd function and gets the linked user context
+ */
+#define DRIVER_MCP9600_LINK_IIC_READ_COMMAND_CTX(HANDLE, FUC)      (HANDLE)->iic_read_cmd_ctx = FUC
+
+/**
+ * @brief     link iic_write_cmd_ctx function
+ * @param[in] HANDLE pointer to an mcp9600 handle structure
+ * @param[in] FUC pointer to an iic_write_cmd_ctx function address
+ * @note      optional, it is used instead of the iic_write_cmd function and gets the linked user context
+ */
+#define DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND_CTX(HANDLE, FUC)     (HANDLE)->iic_write_cmd_ctx = FUC
+
+/**
+ * @brief     link iic_read_ctx function
+ * @param[in] HANDLE pointer to an mcp9600 handle structure
+ * @param[in] FUC pointer to an iic_read_ctx function address
+ * @note      optional, it is used instead of the iic_read function and gets the linked user context
+ */
+#define DRIVER_MCP9600_LINK_IIC_READ_CTX(HANDLE, FUC)              (HANDLE)->iic_read_ctx = FUC
+
+/**
+ * @brief     link iic_read_batch_ctx function
+ * @param[in] HANDLE pointer to an mcp9600 handle structure
+ * @param[in] FUC pointer to an iic_read_batch_ctx function address
+ * @note      optional, it is used instead of the iic_read_batch function and gets the linked user context
+ */
+#define DRIVER_MCP9600_LINK_IIC_READ_BATCH_CTX(HANDLE, FUC)        (HANDLE)->iic_read_batch_ctx = FUC
+
+/**
+ * @brief     link delay_ms_ctx function
+ * @param[in] HANDLE pointer to an mcp9600 handle structure
+ * @param[in] FUC pointer to a delay_ms_ctx function address
+ * @note      optional, it is used instead of the delay_ms function and gets the linked user context
+ */
+#define DRIVER_MCP9600_LINK_IIC_DELAY_MS_CTX(HANDLE, FUC)          (HANDLE)->delay_ms_ctx = FUC
+
+/**
+ * @brief     link the user context
+ * @param[in] HANDLE pointer to an mcp9600 handle structure
+ * @param[in] USER pointer to a user context
+ * @note      it is passed as the first argument of all the ctx functions
+ */
+#define DRIVER_MCP9600_LINK_USER(HANDLE, USER)                     (HANDLE)->user = USER
+
+/**
+ * @brief     link timestamp function
+ * @param[in] HANDLE pointer to an mcp9600 handle structure
+ * @param[in] FUC pointer to a timestamp function address
+ * @note      it is optional, the function returns a monotonic time in ns and is only
+ *            needed by mcp9600_latency_record and the transport statistics
+ */
+#define DRIVER_MCP9600_LINK_TIMESTAMP(HANDLE, FUC)                 (HANDLE)->timestamp = FUC
+
+/**
+ * @brief     link timestamp_ctx function
+ * @param[in] HANDLE pointer to an mcp9600 handle structure
+ * @param[in] FUC pointer to a timestamp_ctx function address
+ * @note      optional, it is used instead of the timestamp function and gets the linked user context
+ */
+#define DRIVER_MCP9600_LINK_TIMESTAMP_CTX(HANDLE, FUC)             (HANDLE)->timestamp_ctx = FUC
+
+/**
+ * @brief     link bus_lock function
+ * @param[in] HANDLE pointer to an mcp9600 handle structure
+ * @param[in] FUC pointer to a bus_lock function address
+ * @note      it is optional, the function is called with the user context before each
+ *            indivisible register sequence and must block until the bus is owned
+ */
+#define DRIVER_MCP9600_LINK_BUS_LOCK(HANDLE, FUC)                  (HANDLE)->bus_lock = FUC
+
+/**
+ * @brief     link bus_unlock function
+ * @param[in] HANDLE pointer to an mcp9600 handle structure
+ * @param[in] FUC pointer to a bus_unlock function address
+ * @note      it is optional, the function is called with the user context after each
+ *            indivisible register sequence
+ */
+#define DRIVER_MCP9600_LINK_BUS_UNLOCK(HANDLE, FUC)                (HANDLE)->bus_unlock = FUC
 
 /**
  * @}
@@ -355,6 +615,21 @@ uint8_t mcp9600_set_addr_pin(mcp9600_handle_t *handle, mcp9600_address_t addr_pi
  */
 uint8_t mcp9600_get_addr_pin(mcp9600_handle_t *handle, mcp9600_address_t *addr_pin);
 
+/**
+ * @brief      scan the iic bus for chips
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *addr pointer to an address list buffer with at least 8 members
+ * @param[out] *num pointer to a found number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 iic initialization failed
+ *             - 2 handle is NULL
+ *             - 3 linked functions is NULL
+ * @note       it reads the device id at all the 8 addresses in one pass,
+ *             the bus is opened and closed here when the handle is not initialized
+ */
+uint8_t mcp9600_scan(mcp9600_handle_t *handle, mcp9600_address_t *addr, uint8_t *num);
+
 /**
  * @brief     initialize the chip
  * @param[in] *handle pointer to an mcp9600 handle structure
@@ -405,6 +680,7 @@ uint8_t mcp9600_start_continuous_read(mcp9600_handle_t *handle);
  */
 uint8_t mcp9600_stop_continuous_read(mcp9600_handle_t *handle);
 
+#if (MCP9600_FLOAT_API != 0)
 /**
  * @brief      read data continuously
  * @param[in]  *handle pointer to an mcp9600 handle structure
@@ -424,7 +700,93 @@ uint8_t mcp9600_stop_continuous_read(mcp9600_handle_t *handle);
  */
 uint8_t mcp9600_continuous_read(mcp9600_handle_t *handle, int16_t *hot_raw, float *hot_s,
                                 int16_t *delta_raw, float *delta_s, int16_t *cold_raw, float *cold_s);
+#endif
+
+/**
+ * @brief      read data continuously in fixed point
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *hot_mc pointer to a converted hot temperature buffer in mC
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *delta_mc pointer to a converted delta temperature buffer in mC
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *cold_mc pointer to a converted cold temperature buffer in mC
+ * @return     status code
+ *             - 0 success
+ *             - 1 continuous read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       this function can be used only after run mcp9600_start_continuous_read
+ *             and can be stopped by mcp9600_stop_continuous_read
+ */
+uint8_t mcp9600_continuous_read_fixed(mcp9600_handle_t *handle, int16_t *hot_raw, int32_t *hot_mc,
+                                      int16_t *delta_raw, int32_t *delta_mc, int16_t *cold_raw, int32_t *cold_mc);
+
+#if (MCP9600_FLOAT_API != 0)
+/**
+ * @brief      read the temperatures and the status in one bus transfer
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *hot_s pointer to a converted hot temperature buffer
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *delta_s pointer to a converted delta temperature buffer
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *cold_s pointer to a converted cold temperature buffer
+ * @param[out] *status pointer to a status register buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 fast read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the cold junction resolution is taken from the register cache when it is enabled,
+ *             the registers are read one by one when iic_read_batch is not linked
+ */
+uint8_t mcp9600_fast_read(mcp9600_handle_t *handle, int16_t *hot_raw, float *hot_s,
+                          int16_t *delta_raw, float *delta_s, int16_t *cold_raw, float *cold_s,
+                          uint8_t *status);
+#endif
+
+/**
+ * @brief      read the temperatures and the status in one bus transfer in fixed point
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *hot_mc pointer to a converted hot temperature buffer in mC
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *delta_mc pointer to a converted delta temperature buffer in mC
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *cold_mc pointer to a converted cold temperature buffer in mC
+ * @param[out] *status pointer to a status register buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 fast read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the cold junction resolution is taken from the register cache when it is enabled,
+ *             the registers are read one by one when iic_read_batch is not linked
+ */
+uint8_t mcp9600_fast_read_fixed(mcp9600_handle_t *handle, int16_t *hot_raw, int32_t *hot_mc,
+                                int16_t *delta_raw, int32_t *delta_mc, int16_t *cold_raw, int32_t *cold_mc,
+                                uint8_t *status);
 
+/**
+ * @brief      read the raw temperatures and the status in one bus transfer
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *status pointer to a status register buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 fast read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the device configuration is not read, the caller scales the cold junction
+ *             with its own copy of the cold junction resolution
+ */
+uint8_t mcp9600_fast_read_raw(mcp9600_handle_t *handle, int16_t *hot_raw, int16_t *delta_raw,
+                              int16_t *cold_raw, uint8_t *status);
+
+#if (MCP9600_FLOAT_API != 0)
 /**
  * @brief      read data once
  * @param[in]  *handle pointer to an mcp9600 handle structure
@@ -440,11 +802,105 @@ uint8_t mcp9600_continuous_read(mcp9600_handle_t *handle, int16_t *hot_raw, floa
  *             - 2 handle is NULL
  *             - 3 handle is not initialized
  *             - 4 read timeout
- * @note       none
+ * @note       it sleeps for the expected conversion time minus the conversion guard band
+ *             before polling the status register
  */
 uint8_t mcp9600_single_read(mcp9600_handle_t *handle, int16_t *hot_raw, float *hot_s,
                             int16_t *delta_raw, float *delta_s, int16_t *cold_raw, float *cold_s);
+#endif
+
+/**
+ * @brief      read data once in fixed point
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *hot_mc pointer to a converted hot temperature buffer in mC
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *delta_mc pointer to a converted delta temperature buffer in mC
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *cold_mc pointer to a converted cold temperature buffer in mC
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 read timeout
+ * @note       it sleeps for the expected conversion time minus the conversion guard band
+ *             before polling the status register
+ */
+uint8_t mcp9600_single_read_fixed(mcp9600_handle_t *handle, int16_t *hot_raw, int32_t *hot_mc,
+                                  int16_t *delta_raw, int32_t *delta_mc, int16_t *cold_raw, int32_t *cold_mc);
+
+/**
+ * @brief      start a single read without waiting
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *ms pointer to an expected conversion time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read start failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       poll it with mcp9600_single_read_poll after about ms and read the data
+ *             with mcp9600_single_read_collect
+ */
+uint8_t mcp9600_single_read_start(mcp9600_handle_t *handle, uint32_t *ms);
+
+/**
+ * @brief      check whether the started single read is finished
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *ready pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read poll failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 single read is not started
+ * @note       it reads the status register once and never waits
+ */
+uint8_t mcp9600_single_read_poll(mcp9600_handle_t *handle, mcp9600_bool_t *ready);
+
+#if (MCP9600_FLOAT_API != 0)
+/**
+ * @brief      read the data of the finished single read
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *hot_s pointer to a converted hot temperature buffer
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *delta_s pointer to a converted delta temperature buffer
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *cold_s pointer to a converted cold temperature buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read collect failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 single read is not started
+ * @note       call it after mcp9600_single_read_poll reports ready
+ */
+uint8_t mcp9600_single_read_collect(mcp9600_handle_t *handle, int16_t *hot_raw, float *hot_s,
+                                    int16_t *delta_raw, float *delta_s, int16_t *cold_raw, float *cold_s);
+#endif
+
+/**
+ * @brief      read the data of the finished single read in fixed point
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *hot_raw pointer to a raw hot temperature buffer
+ * @param[out] *hot_mc pointer to a converted hot temperature buffer in mC
+ * @param[out] *delta_raw pointer to a raw delta temperature buffer
+ * @param[out] *delta_mc pointer to a converted delta temperature buffer in mC
+ * @param[out] *cold_raw pointer to a raw cold temperature buffer
+ * @param[out] *cold_mc pointer to a converted cold temperature buffer in mC
+ * @return     status code
+ *             - 0 success
+ *             - 1 single read collect failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 single read is not started
+ * @note       call it after mcp9600_single_read_poll reports ready
+ */
+uint8_t mcp9600_single_read_collect_fixed(mcp9600_handle_t *handle, int16_t *hot_raw, int32_t *hot_mc,
+                                          int16_t *delta_raw, int32_t *delta_mc, int16_t *cold_raw, int32_t *cold_mc);
 
+#if (MCP9600_FLOAT_API != 0)
 /**
  * @brief      get the hot junction temperature
  * @param[in]  *handle pointer to an mcp9600 handle structure
@@ -458,7 +914,23 @@ uint8_t mcp9600_single_read(mcp9600_handle_t *handle, int16_t *hot_raw, float *h
  * @note       none
  */
 uint8_t mcp9600_get_hot_junction_temperature(mcp9600_handle_t *handle, int16_t *raw, float *s);
+#endif
+
+/**
+ * @brief      get the hot junction temperature in fixed point
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *mc pointer to a converted temperature buffer in mC
+ * @return     status code
+ *             - 0 success
+ *             - 1 get hot junction temperature failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_get_hot_junction_temperature_fixed(mcp9600_handle_t *handle, int16_t *raw, int32_t *mc);
 
+#if (MCP9600_FLOAT_API != 0)
 /**
  * @brief      get the junction thermocouple delta
  * @param[in]  *handle pointer to an mcp9600 handle structure
@@ -472,7 +944,23 @@ uint8_t mcp9600_get_hot_junction_temperature(mcp9600_handle_t *handle, int16_t *
  * @note       none
  */
 uint8_t mcp9600_get_junction_thermocouple_delta(mcp9600_handle_t *handle, int16_t *raw, float *s);
+#endif
+
+/**
+ * @brief      get the junction thermocouple delta in fixed point
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *mc pointer to a converted temperature buffer in mC
+ * @return     status code
+ *             - 0 success
+ *             - 1 get junction thermocouple delta failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_get_junction_thermocouple_delta_fixed(mcp9600_handle_t *handle, int16_t *raw, int32_t *mc);
 
+#if (MCP9600_FLOAT_API != 0)
 /**
  * @brief      get the cold junction temperature
  * @param[in]  *handle pointer to an mcp9600 handle structure
@@ -486,7 +974,23 @@ uint8_t mcp9600_get_junction_thermocouple_delta(mcp9600_handle_t *handle, int16_
  * @note       none
  */
 uint8_t mcp9600_get_cold_junction_temperature(mcp9600_handle_t *handle, int16_t *raw, float *s);
+#endif
+
+/**
+ * @brief      get the cold junction temperature in fixed point
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *raw pointer to a raw temperature buffer
+ * @param[out] *mc pointer to a converted temperature buffer in mC
+ * @return     status code
+ *             - 0 success
+ *             - 1 get cold junction temperature failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_get_cold_junction_temperature_fixed(mcp9600_handle_t *handle, int16_t *raw, int32_t *mc);
 
+#if (MCP9600_FLOAT_API != 0)
 /**
  * @brief      get the raw adc
  * @param[in]  *handle pointer to an mcp9600 handle structure
@@ -500,6 +1004,21 @@ uint8_t mcp9600_get_cold_junction_temperature(mcp9600_handle_t *handle, int16_t
  * @note       none
  */
 uint8_t mcp9600_get_raw_adc(mcp9600_handle_t *handle, int32_t *raw, double *uv);
+#endif
+
+/**
+ * @brief      get the raw adc in fixed point
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *raw pointer to a raw adc buffer
+ * @param[out] *nv pointer to a converted voltage buffer in nV
+ * @return     status code
+ *             - 0 success
+ *             - 1 get raw adc failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_get_raw_adc_fixed(mcp9600_handle_t *handle, int32_t *raw, int32_t *nv);
 
 /**
  * @brief     set the filter coefficient
@@ -734,6 +1253,7 @@ uint8_t mcp9600_set_mode(mcp9600_handle_t *handle, mcp9600_mode_t mode);
  */
 uint8_t mcp9600_get_mode(mcp9600_handle_t *handle, mcp9600_mode_t *mode);
 
+#if (MCP9600_FLOAT_API != 0)
 /**
  * @brief      convert the alert limit to the register raw data
  * @param[in]  *handle pointer to an mcp9600 handle structure
@@ -746,7 +1266,22 @@ uint8_t mcp9600_get_mode(mcp9600_handle_t *handle, mcp9600_mode_t *mode);
  * @note       none
  */
 uint8_t mcp9600_alert_limit_convert_to_register(mcp9600_handle_t *handle, float c, int16_t *reg);
+#endif
+
+/**
+ * @brief      convert the alert limit in fixed point to the register raw data
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[in]  mc alert limit in mC
+ * @param[out] *reg pointer to a register raw buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_alert_limit_convert_to_register_fixed(mcp9600_handle_t *handle, int32_t mc, int16_t *reg);
 
+#if (MCP9600_FLOAT_API != 0)
 /**
  * @brief      convert the register raw data to the alert limit
  * @param[in]  *handle pointer to an mcp9600 handle structure
@@ -759,6 +1294,20 @@ uint8_t mcp9600_alert_limit_convert_to_register(mcp9600_handle_t *handle, float
  * @note       none
  */
 uint8_t mcp9600_alert_limit_convert_to_data(mcp9600_handle_t *handle, int16_t reg, float *c);
+#endif
+
+/**
+ * @brief      convert the register raw data to the alert limit in fixed point
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[in]  reg register raw data
+ * @param[out] *mc pointer to an alert limit buffer in mC
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_alert_limit_convert_to_data_fixed(mcp9600_handle_t *handle, int16_t reg, int32_t *mc);
 
 /**
  * @brief     set the alert limit
@@ -790,6 +1339,7 @@ uint8_t mcp9600_set_alert_limit(mcp9600_handle_t *handle, mcp9600_alert_t alert,
  */
 uint8_t mcp9600_get_alert_limit(mcp9600_handle_t *handle, mcp9600_alert_t alert, int16_t *reg);
 
+#if (MCP9600_FLOAT_API != 0)
 /**
  * @brief      convert the alert hysteresis to the register raw data
  * @param[in]  *handle pointer to an mcp9600 handle structure
@@ -802,7 +1352,22 @@ uint8_t mcp9600_get_alert_limit(mcp9600_handle_t *handle, mcp9600_alert_t alert,
  * @note       none
  */
 uint8_t mcp9600_alert_hysteresis_convert_to_register(mcp9600_handle_t *handle, float c, uint8_t *reg);
+#endif
 
+/**
+ * @brief      convert the alert hysteresis in fixed point to the register raw data
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[in]  mc alert hysteresis in mC
+ * @param[out] *reg pointer to a register raw buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_alert_hysteresis_convert_to_register_fixed(mcp9600_handle_t *handle, int32_t mc, uint8_t *reg);
+
+#if (MCP9600_FLOAT_API != 0)
 /**
  * @brief      convert the register raw data to the alert hysteresis
  * @param[in]  *handle pointer to an mcp9600 handle structure
@@ -815,6 +1380,20 @@ uint8_t mcp9600_alert_hysteresis_convert_to_register(mcp9600_handle_t *handle, f
  * @note       none
  */
 uint8_t mcp9600_alert_hysteresis_convert_to_data(mcp9600_handle_t *handle, uint8_t reg, float *c);
+#endif
+
+/**
+ * @brief      convert the register raw data to the alert hysteresis in fixed point
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[in]  reg register raw data
+ * @param[out] *mc pointer to an alert hysteresis buffer in mC
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_alert_hysteresis_convert_to_data_fixed(mcp9600_handle_t *handle, uint8_t reg, int32_t *mc);
 
 /**
  * @brief     set the alert hysteresis
@@ -1041,6 +1620,162 @@ uint8_t mcp9600_get_alert_output(mcp9600_handle_t *handle, mcp9600_alert_t alert
  */
 uint8_t mcp9600_get_device_id_revision(mcp9600_handle_t *handle, uint8_t *id, uint8_t *revision);
 
+/**
+ * @brief     set the single read conversion guard band
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @param[in] ms guard band in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      mcp9600_single_read sleeps until the expected conversion time minus the guard band
+ *            and then polls the status register every 1 ms, it can be called before mcp9600_init
+ */
+uint8_t mcp9600_set_conversion_guard(mcp9600_handle_t *handle, uint32_t ms);
+
+/**
+ * @brief      get the single read conversion guard band
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *ms pointer to a guard band buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t mcp9600_get_conversion_guard(mcp9600_handle_t *handle, uint32_t *ms);
+
+/**
+ * @brief      get the expected burst conversion time
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *ms pointer to a conversion time buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 get conversion time failed
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the time is modeled from the current adc resolution and burst mode sample
+ */
+uint8_t mcp9600_get_conversion_time(mcp9600_handle_t *handle, uint32_t *ms);
+
+/**
+ * @brief      get the status poll count of the last single read
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *count pointer to a poll count buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t mcp9600_get_single_read_poll_count(mcp9600_handle_t *handle, uint32_t *count);
+
+/**
+ * @brief     enable or disable the register cache
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 1 set register cache failed
+ *            - 2 handle is NULL
+ * @note      it can be called before mcp9600_init, the cache is loaded in mcp9600_init or
+ *            immediately when the handle is already initialized
+ */
+uint8_t mcp9600_set_register_cache(mcp9600_handle_t *handle, mcp9600_bool_t enable);
+
+/**
+ * @brief      get the register cache status
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *enable pointer to a bool value buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t mcp9600_get_register_cache(mcp9600_handle_t *handle, mcp9600_bool_t *enable);
+
+/**
+ * @brief     reload the register cache from the chip
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 refresh register cache failed
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ *            - 4 register cache is disabled
+ * @note      call it after the registers are changed by another master or a chip reset
+ */
+uint8_t mcp9600_refresh_register_cache(mcp9600_handle_t *handle);
+
+#if (MCP9600_STATS != 0)
+/**
+ * @brief      record the latency from an event to the completion of a reading
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[in]  timestamp event timestamp in ns
+ * @param[out] *us pointer to a latency buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ *             - 4 timestamp is null
+ * @note       call it right after the reading, the completion time is taken from the linked timestamp
+ *             function which must share its clock with the event timestamp
+ */
+uint8_t mcp9600_latency_record(mcp9600_handle_t *handle, uint64_t timestamp, uint32_t *us);
+
+/**
+ * @brief      get the latency statistics
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *latency pointer to an mcp9600 latency structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ *             - 3 handle is not initialized
+ * @note       the percentiles are the upper bounds of the histogram buckets capped by the max latency
+ */
+uint8_t mcp9600_latency_get(mcp9600_handle_t *handle, mcp9600_latency_t *latency);
+
+/**
+ * @brief     clear the latency statistics
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ *            - 3 handle is not initialized
+ * @note      none
+ */
+uint8_t mcp9600_latency_reset(mcp9600_handle_t *handle);
+
+/**
+ * @brief     enable or disable the transport statistics
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @param[in] enable bool value
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      it can be called before mcp9600_init, the latency is only recorded with timestamp linked
+ */
+uint8_t mcp9600_set_stats(mcp9600_handle_t *handle, mcp9600_bool_t enable);
+
+/**
+ * @brief      get the transport statistics
+ * @param[in]  *handle pointer to an mcp9600 handle structure
+ * @param[out] *stats pointer to an mcp9600 stats structure
+ * @return     status code
+ *             - 0 success
+ *             - 2 handle is NULL
+ * @note       none
+ */
+uint8_t mcp9600_get_stats(mcp9600_handle_t *handle, mcp9600_stats_t *stats);
+
+/**
+ * @brief     clear the transport statistics
+ * @param[in] *handle pointer to an mcp9600 handle structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 handle is NULL
+ * @note      none
+ */
+uint8_t mcp9600_reset_stats(mcp9600_handle_t *handle);
+#endif
+
 /**
  * @}
  */
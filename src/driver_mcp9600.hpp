@@ -0,0 +1,531 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9600.hpp
+ * @brief     driver mcp9600 c++ wrapper header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#ifndef DRIVER_MCP9600_HPP
+#define DRIVER_MCP9600_HPP
+
+#include "driver_mcp9600.h"
+
+#include <cstdarg>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+#if (__cplusplus < 201703L)
+#error "driver_mcp9600.hpp needs c++17 or newer"
+#endif
+
+/**
+ * @defgroup mcp9600_cpp_driver mcp9600 c++ driver function
+ * @brief    mcp9600 c++ driver modules
+ * @ingroup  mcp9600_driver
+ * @{
+ */
+
+namespace libdriver
+{
+
+/**
+ * @brief mcp9600 c++ detail namespace
+ */
+namespace mcp9600_detail
+{
+    /**
+     * @brief bus member detection of the optional register read
+     */
+    template <class T, class = void>
+    struct has_read : std::false_type {};
+    template <class T>
+    struct has_read<T, std::void_t<decltype(std::declval<T &>().read(uint8_t(), uint8_t(),
+                                                                       static_cast<uint8_t *>(nullptr), uint16_t()))>>
+        : std::true_type {};
+
+    /**
+     * @brief bus member detection of the optional batch read
+     */
+    template <class T, class = void>
+    struct has_read_batch : std::false_type {};
+    template <class T>
+    struct has_read_batch<T, std::void_t<decltype(std::declval<T &>().read_batch(uint8_t(), static_cast<uint8_t *>(nullptr),
+                                                                                 static_cast<uint16_t *>(nullptr), uint8_t(),
+                                                                                 static_cast<uint8_t *>(nullptr)))>>
+        : std::true_type {};
+
+    /**
+     * @brief bus member detection of the optional lock and unlock
+     */
+    template <class T, class = void>
+    struct has_lock : std::false_type {};
+    template <class T>
+    struct has_lock<T, std::void_t<decltype(std::declval<T &>().lock()), decltype(std::declval<T &>().unlock())>>
+        : std::true_type {};
+    
+    /**
+     * @brief bus static member detection of the debug print
+     */
+    template <class T, class = void>
+    struct has_debug_print : std::false_type {};
+    template <class T>
+    struct has_debug_print<T, std::void_t<decltype(&T::debug_print)>> : std::true_type {};
+
+    /**
+     * @brief     silent debug print used when the bus has none
+     * @param[in] fmt format data
+     * @note      none
+     */
+    inline void debug_print_none(const char *const fmt, ...)
+    {
+        (void)fmt;
+    }
+}
+
+/**
+ * @brief mcp9600 fixed point sample structure definition
+ */
+struct Mcp9600Sample
+{
+    int16_t hot_raw;          /**< raw hot junction temperature */
+    int32_t hot_mc;           /**< hot junction temperature in mC */
+    int16_t delta_raw;        /**< raw junction delta temperature */
+    int32_t delta_mc;         /**< junction delta temperature in mC */
+    int16_t cold_raw;         /**< raw cold junction temperature */
+    int32_t cold_mc;          /**< cold junction temperature in mC */
+};
+
+/**
+ * @brief mcp9600 c++ wrapper class definition
+ * @note  Bus is a transport object with the member functions
+ *        uint8_t init(), uint8_t deinit(), uint8_t write_cmd(uint8_t addr, uint8_t *buf, uint16_t len),
+ *        uint8_t read_cmd(uint8_t addr, uint8_t *buf, uint16_t len) and void delay_ms(uint32_t ms),
+ *        the members read(addr, reg, buf, len), read_batch(addr, reg, len, num, buf), lock(), unlock() and
+ *        the static debug_print(fmt, ...) are linked when present, the bus must outlive the sensor object
+ */
+template <class Bus,
+          mcp9600_address_t Address,
+          mcp9600_thermocouple_type_t ThermocoupleType,
+          mcp9600_adc_resolution_t AdcResolution = MCP9600_ADC_RESOLUTION_18_BIT,
+          mcp9600_burst_mode_sample_t BurstSample = MCP9600_BURST_MODE_SAMPLE_1,
+          mcp9600_cold_junction_resolution_t ColdResolution = MCP9600_COLD_JUNCTION_RESOLUTION_0P0625>
+class Mcp9600
+{
+    static_assert((static_cast<uint32_t>(AdcResolution) & ~0x3U) == 0, "invalid adc resolution");
+    static_assert((static_cast<uint32_t>(BurstSample) & ~0x7U) == 0, "invalid burst sample");
+    static_assert((static_cast<uint32_t>(ThermocoupleType) & ~0x7U) == 0, "invalid thermocouple type");
+    
+  public:
+    static constexpr mcp9600_address_t address = Address;                                          /**< addr pin */
+    static constexpr mcp9600_thermocouple_type_t thermocouple_type = ThermocoupleType;             /**< thermocouple type */
+    static constexpr mcp9600_adc_resolution_t adc_resolution = AdcResolution;                      /**< adc resolution */
+    static constexpr mcp9600_burst_mode_sample_t burst_sample = BurstSample;                       /**< burst samples */
+    static constexpr mcp9600_cold_junction_resolution_t cold_resolution = ColdResolution;          /**< cold junction resolution */
+    static constexpr uint32_t burst_count = 1U << static_cast<uint32_t>(BurstSample);              /**< samples per burst */
+    static constexpr uint32_t sample_time_ms = 320U >> (2U * static_cast<uint32_t>(AdcResolution));/**< time of one sample in ms */
+    static constexpr uint32_t conversion_time_ms = sample_time_ms * burst_count;                   /**< time of one burst in ms */
+    static constexpr int32_t adc_nv_per_lsb = 2000 << (2 * static_cast<int32_t>(AdcResolution));   /**< adc lsb in nV */
+    static constexpr int32_t cold_lsb_shift = (ColdResolution == MCP9600_COLD_JUNCTION_RESOLUTION_0P25) ? 2 : 4;    /**< cold junction lsb shift */
+    
+    /**
+     * @brief     link the bus, init the chip and apply the compile time configuration
+     * @param[in] &bus reference to the transport object
+     * @note      check ok() or status() for the result, the destructor releases the chip
+     */
+    explicit Mcp9600(Bus &bus) : m_bus(&bus), m_status(0)
+    {
+        DRIVER_MCP9600_LINK_INIT(&m_handle, mcp9600_handle_t);
+        DRIVER_MCP9600_LINK_IIC_INIT_CTX(&m_handle, a_iic_init);
+        DRIVER_MCP9600_LINK_IIC_DEINIT_CTX(&m_handle, a_iic_deinit);
+        DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND_CTX(&m_handle, a_iic_write_cmd);
+        DRIVER_MCP9600_LINK_IIC_READ_COMMAND_CTX(&m_handle, a_iic_read_cmd);
+        if constexpr (mcp9600_detail::has_read<Bus>::value)
+        {
+            DRIVER_MCP9600_LINK_IIC_READ_CTX(&m_handle, a_iic_read);
+        }
+        if constexpr (mcp9600_detail::has_read_batch<Bus>::value)
+        {
+            DRIVER_MCP9600_LINK_IIC_READ_BATCH_CTX(&m_handle, a_iic_read_batch);
+        }
+        DRIVER_MCP9600_LINK_IIC_DELAY_MS_CTX(&m_handle, a_delay_ms);
+        if constexpr (mcp9600_detail::has_lock<Bus>::value)
+        {
+            DRIVER_MCP9600_LINK_BUS_LOCK(&m_handle, a_bus_lock);
+            DRIVER_MCP9600_LINK_BUS_UNLOCK(&m_handle, a_bus_unlock);
+        }
+        if constexpr (mcp9600_detail::has_debug_print<Bus>::value)
+        {
+            DRIVER_MCP9600_LINK_DEBUG_PRINT(&m_handle, Bus::debug_print);
+        }
+        else
+        {
+            DRIVER_MCP9600_LINK_DEBUG_PRINT(&m_handle, mcp9600_detail::debug_print_none);
+        }
+        DRIVER_MCP9600_LINK_USER(&m_handle, m_bus);
+        
+        m_status = mcp9600_set_addr_pin(&m_handle, Address);
+        if (m_status != 0)
+        {
+            return;
+        }
+        m_status = mcp9600_init(&m_handle);
+        if (m_status != 0)
+        {
+            return;
+        }
+        if ((mcp9600_set_thermocouple_type(&m_handle, ThermocoupleType) != 0) ||
+            (mcp9600_set_adc_resolution(&m_handle, AdcResolution) != 0) ||
+            (mcp9600_set_burst_mode_sample(&m_handle, BurstSample) != 0) ||
+            (mcp9600_set_cold_junction_resolution(&m_handle, ColdResolution) != 0))
+        {
+            (void)mcp9600_deinit(&m_handle);
+            m_status = 1;
+        }
+    }
+    
+    /**
+     * @brief  deinit the chip and close the bus
+     * @note   none
+     */
+    ~Mcp9600()
+    {
+        if (m_handle.inited != 0)
+        {
+            (void)mcp9600_deinit(&m_handle);
+        }
+    }
+    
+    Mcp9600(const Mcp9600 &) = delete;
+    Mcp9600 &operator=(const Mcp9600 &) = delete;
+    
+    /**
+     * @brief     take over the chip from another object
+     * @param[in] &&other moved object
+     * @note      the moved object is left uninitialized
+     */
+    Mcp9600(Mcp9600 &&other) noexcept : m_bus(other.m_bus), m_handle(other.m_handle), m_status(other.m_status)
+    {
+        other.m_handle.inited = 0;
+        other.m_status = 3;
+    }
+    
+    Mcp9600 &operator=(Mcp9600 &&) = delete;
+    
+    /**
+     * @brief  get the init status
+     * @return status code
+     *         - 0 success
+     *         - 1 init or configuration failed
+     *         - 3 moved from
+     *         - others mcp9600_set_addr_pin or mcp9600_init code
+     * @note   none
+     */
+    uint8_t status() const noexcept
+    {
+        return m_status;
+    }
+    
+    /**
+     * @brief  check the init status
+     * @return true if the chip is ready
+     * @note   none
+     */
+    bool ok() const noexcept
+    {
+        return (m_status == 0) && (m_handle.inited != 0);
+    }
+    
+    /**
+     * @brief  get the underlying handle for the full c api
+     * @return pointer to the mcp9600 handle structure
+     * @note   none
+     */
+    mcp9600_handle_t *handle() noexcept
+    {
+        return &m_handle;
+    }
+    
+    /**
+     * @brief  get the bound bus
+     * @return reference to the transport object
+     * @note   none
+     */
+    Bus &bus() noexcept
+    {
+        return *m_bus;
+    }
+    
+    /**
+     * @brief     convert a raw hot or delta temperature to mC
+     * @param[in] raw raw temperature
+     * @return    temperature in mC
+     * @note      rounds half away from zero like the c fixed point api
+     */
+    static constexpr int32_t junction_to_mc(int16_t raw) noexcept
+    {
+        return a_round_half(static_cast<int32_t>(raw) * 125);
+    }
+    
+    /**
+     * @brief     convert a raw cold junction temperature to mC
+     * @param[in] raw raw temperature
+     * @return    temperature in mC
+     * @note      none
+     */
+    static constexpr int32_t cold_to_mc(int16_t raw) noexcept
+    {
+        return (cold_lsb_shift == 2) ? (static_cast<int32_t>(raw) * 250) : junction_to_mc(raw);
+    }
+    
+    /**
+     * @brief     convert a raw adc value to nV
+     * @param[in] raw raw adc
+     * @return    emf in nV
+     * @note      none
+     */
+    static constexpr int32_t adc_to_nv(int32_t raw) noexcept
+    {
+        return raw * adc_nv_per_lsb;
+    }
+    
+#if (MCP9600_FLOAT_API != 0)
+    /**
+     * @brief     convert a raw hot or delta temperature to C
+     * @param[in] raw raw temperature
+     * @return    temperature in C
+     * @note      none
+     */
+    static constexpr float junction_to_celsius(int16_t raw) noexcept
+    {
+        return static_cast<float>(raw) / 16.0f;
+    }
+    
+    /**
+     * @brief     convert a raw cold junction temperature to C
+     * @param[in] raw raw temperature
+     * @return    temperature in C
+     * @note      none
+     */
+    static constexpr float cold_to_celsius(int16_t raw) noexcept
+    {
+        return static_cast<float>(raw) / static_cast<float>(1 << cold_lsb_shift);
+    }
+    
+    /**
+     * @brief     convert a raw adc value to uV
+     * @param[in] raw raw adc
+     * @return    emf in uV
+     * @note      none
+     */
+    static constexpr double adc_to_uv(int32_t raw) noexcept
+    {
+        return static_cast<double>(raw) * (static_cast<double>(adc_nv_per_lsb) / 1000.0);
+    }
+#endif
+    
+    /**
+     * @brief  start the continuous conversion
+     * @return status code of mcp9600_start_continuous_read
+     * @note   none
+     */
+    uint8_t start_continuous() noexcept
+    {
+        return mcp9600_start_continuous_read(&m_handle);
+    }
+    
+    /**
+     * @brief  stop the continuous conversion
+     * @return status code of mcp9600_stop_continuous_read
+     * @note   none
+     */
+    uint8_t stop_continuous() noexcept
+    {
+        return mcp9600_stop_continuous_read(&m_handle);
+    }
+    
+    /**
+     * @brief      read the latest continuous sample
+     * @param[out] &sample reference to a sample structure
+     * @return     status code of mcp9600_continuous_read_fixed
+     * @note       none
+     */
+    uint8_t continuous_read(Mcp9600Sample &sample) noexcept
+    {
+        return mcp9600_continuous_read_fixed(&m_handle, &sample.hot_raw, &sample.hot_mc,
+                                             &sample.delta_raw, &sample.delta_mc,
+                                             &sample.cold_raw, &sample.cold_mc);
+    }
+    
+    /**
+     * @brief      read the sample and the status in one transfer
+     * @param[out] &sample reference to a sample structure
+     * @param[out] &status reference to a status register buffer
+     * @return     status code of mcp9600_fast_read_fixed
+     * @note       none
+     */
+    uint8_t fast_read(Mcp9600Sample &sample, uint8_t &status) noexcept
+    {
+        return mcp9600_fast_read_fixed(&m_handle, &sample.hot_raw, &sample.hot_mc,
+                                       &sample.delta_raw, &sample.delta_mc,
+                                       &sample.cold_raw, &sample.cold_mc, &status);
+    }
+    
+    /**
+     * @brief      run one burst and read the sample
+     * @param[out] &sample reference to a sample structure
+     * @return     status code of mcp9600_single_read_fixed
+     * @note       blocks for about conversion_time_ms
+     */
+    uint8_t single_read(Mcp9600Sample &sample) noexcept
+    {
+        return mcp9600_single_read_fixed(&m_handle, &sample.hot_raw, &sample.hot_mc,
+                                         &sample.delta_raw, &sample.delta_mc,
+                                         &sample.cold_raw, &sample.cold_mc);
+    }
+    
+    /**
+     * @brief      start one burst without waiting
+     * @param[out] &ms reference to the wait time buffer
+     * @return     status code of mcp9600_single_read_start
+     * @note       none
+     */
+    uint8_t single_read_start(uint32_t &ms) noexcept
+    {
+        return mcp9600_single_read_start(&m_handle, &ms);
+    }
+    
+    /**
+     * @brief      poll the started burst
+     * @param[out] &ready reference to the ready flag
+     * @return     status code of mcp9600_single_read_poll
+     * @note       none
+     */
+    uint8_t single_read_poll(bool &ready) noexcept
+    {
+        mcp9600_bool_t flag = MCP9600_BOOL_FALSE;
+        const uint8_t res = mcp9600_single_read_poll(&m_handle, &flag);
+        
+        ready = (flag == MCP9600_BOOL_TRUE);
+        
+        return res;
+    }
+    
+    /**
+     * @brief      collect the finished burst
+     * @param[out] &sample reference to a sample structure
+     * @return     status code of mcp9600_single_read_collect_fixed
+     * @note       none
+     */
+    uint8_t single_read_collect(Mcp9600Sample &sample) noexcept
+    {
+        return mcp9600_single_read_collect_fixed(&m_handle, &sample.hot_raw, &sample.hot_mc,
+                                                 &sample.delta_raw, &sample.delta_mc,
+                                                 &sample.cold_raw, &sample.cold_mc);
+    }
+    
+    /**
+     * @brief      read the raw adc
+     * @param[out] &raw reference to a raw adc buffer
+     * @param[out] &nv reference to an emf buffer in nV
+     * @return     status code of mcp9600_get_raw_adc_fixed
+     * @note       none
+     */
+    uint8_t raw_adc(int32_t &raw, int32_t &nv) noexcept
+    {
+        return mcp9600_get_raw_adc_fixed(&m_handle, &raw, &nv);
+    }
+    
+  private:
+    static constexpr int32_t a_round_half(int32_t m) noexcept
+    {
+        return (m >= 0) ? ((m + 1) / 2) : ((m - 1) / 2);
+    }
+    
+    static uint8_t a_iic_init(void *user)
+    {
+        return static_cast<Bus *>(user)->init();
+    }
+    
+    static uint8_t a_iic_deinit(void *user)
+    {
+        return static_cast<Bus *>(user)->deinit();
+    }
+    
+    static uint8_t a_iic_write_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+    {
+        return static_cast<Bus *>(user)->write_cmd(addr, buf, len);
+    }
+    
+    static uint8_t a_iic_read_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+    {
+        return static_cast<Bus *>(user)->read_cmd(addr, buf, len);
+    }
+    
+    static uint8_t a_iic_read(void *user, uint8_t addr, uint8_t reg, uint8_t *buf, uint16_t len)
+    {
+        return static_cast<Bus *>(user)->read(addr, reg, buf, len);
+    }
+    
+    static uint8_t a_iic_read_batch(void *user, uint8_t addr, uint8_t *reg, uint16_t *len, uint8_t num, uint8_t *buf)
+    {
+        return static_cast<Bus *>(user)->read_batch(addr, reg, len, num, buf);
+    }
+    
+    static void a_delay_ms(void *user, uint32_t ms)
+    {
+        static_cast<Bus *>(user)->delay_ms(ms);
+    }
+    
+    static void a_bus_lock(void *user)
+    {
+        static_cast<Bus *>(user)->lock();
+    }
+    
+    static void a_bus_unlock(void *user)
+    {
+        static_cast<Bus *>(user)->unlock();
+    }
+    
+    Bus *m_bus;                      /**< bound transport */
+    mcp9600_handle_t m_handle;       /**< mcp9600 handle */
+    uint8_t m_status;                /**< init status */
+};
+
+}
+
+/**
+ * @}
+ */
+
+#endif
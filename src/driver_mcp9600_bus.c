@@ -0,0 +1,609 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9600_bus.c
+ * @brief     driver mcp9600 bus source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9600_bus.h"
+
+/**
+ * @brief temperature register definition
+ */
+#define MCP9600_BUS_REG_THERMOCOUPLE_HOT_JUNCTION        0x00        /**< thermocouple hot junction register */
+#define MCP9600_BUS_REG_JUNCTIONS_TEMPERATURE_DELTA      0x01        /**< junctions temperature delta register */
+#define MCP9600_BUS_REG_COLD_JUNCTION_TEMPERATURE        0x02        /**< cold junction temperature register */
+#define MCP9600_BUS_REG_DEVICE_CONFIGURATION             0x06        /**< device configuration register */
+
+/**
+ * @brief     save one device sample
+ * @param[in] *bus pointer to an mcp9600 bus structure
+ * @param[in] index device index
+ * @param[in] *sample pointer to a sample list
+ * @param[in] *num pointer to a sample number buffer
+ * @param[in] status sample status
+ * @return    status code
+ *            - 0 success
+ *            - 1 collect failed
+ * @note      the data is read from the chip only when the status is ok
+ */
+static uint8_t a_mcp9600_bus_save(mcp9600_bus_t *bus, uint8_t index, mcp9600_bus_sample_t *sample,
+                                  uint8_t *num, mcp9600_bus_sample_status_t status)
+{
+    mcp9600_bus_sample_t *s;
+#if (MCP9600_FLOAT_API == 0)
+    int32_t hot_mc;
+    int32_t delta_mc;
+    int32_t cold_mc;
+#endif
+    
+    s = &sample[*num];                                                                         /* get the next sample */
+    memset(s, 0, sizeof(mcp9600_bus_sample_t));                                               /* clear the sample */
+    s->index = index;                                                                          /* set index */
+    s->status = (uint8_t)status;                                                               /* set status */
+    bus->pending &= ~(1UL << index);                                                           /* clear pending */
+    (*num)++;                                                                                  /* num++ */
+    if (status != MCP9600_BUS_SAMPLE_OK)                                                       /* check status */
+    {
+        return 1;                                                                              /* return error */
+    }
+#if (MCP9600_FLOAT_API != 0)
+    if (mcp9600_single_read_collect(bus->handle[index], &s->hot_raw, &s->hot_s,
+                                    &s->delta_raw, &s->delta_s, &s->cold_raw, &s->cold_s) != 0)       /* collect data */
+#else
+    if (mcp9600_single_read_collect_fixed(bus->handle[index], &s->hot_raw, &hot_mc,
+                                          &s->delta_raw, &delta_mc, &s->cold_raw, &cold_mc) != 0)     /* collect data */
+#endif
+    {
+        s->status = (uint8_t)MCP9600_BUS_SAMPLE_FAILED;                                        /* set failed */
+        
+        return 1;                                                                              /* return error */
+    }
+    
+    return 0;                                                                                  /* success return 0 */
+}
+
+/**
+ * @brief     attach the initialized devices to a bus
+ * @param[in] *bus pointer to an mcp9600 bus structure
+ * @param[in] **handle pointer to an initialized mcp9600 handle list
+ * @param[in] num device number
+ * @return    status code
+ *            - 0 success
+ *            - 2 bus is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 num is invalid
+ *            - 5 handle is not initialized
+ * @note      the handle list must be kept valid until mcp9600_bus_deinit
+ */
+uint8_t mcp9600_bus_init(mcp9600_bus_t *bus, mcp9600_handle_t **handle, uint8_t num)
+{
+    uint8_t i;
+    
+    if (bus == NULL)                                                                   /* check bus */
+    {
+        return 2;                                                                      /* return error */
+    }
+    if (bus->debug_print == NULL)                                                      /* check debug_print */
+    {
+        return 3;                                                                      /* return error */
+    }
+    if (bus->delay_ms == NULL)                                                         /* check delay_ms */
+    {
+        bus->debug_print("mcp9600: delay_ms is null.\n");                              /* delay_ms is null */
+        
+        return 3;                                                                      /* return error */
+    }
+    if ((handle == NULL) || (num == 0) || (num > MCP9600_BUS_MAX_DEVICE))              /* check num */
+    {
+        bus->debug_print("mcp9600: num is invalid.\n");                                /* num is invalid */
+        
+        return 4;                                                                      /* return error */
+    }
+    for (i = 0; i < num; i++)                                                          /* check all handles */
+    {
+        if ((handle[i] == NULL) || (handle[i]->inited != 1))                           /* check handle initialization */
+        {
+            bus->debug_print("mcp9600: handle %d is not initialized.\n", i);           /* handle is not initialized */
+            
+            return 5;                                                                  /* return error */
+        }
+    }
+    
+    bus->handle = handle;                                                              /* set handle list */
+    bus->num = num;                                                                    /* set num */
+    bus->pending = 0;                                                                  /* clear pending */
+    bus->guard = 0;                                                                    /* set default guard */
+    bus->timeout = 10000;                                                              /* set default timeout */
+    bus->inited = 1;                                                                   /* set inited */
+    
+    return 0;                                                                          /* success return 0 */
+}
+
+/**
+ * @brief     detach the devices from a bus
+ * @param[in] *bus pointer to an mcp9600 bus structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 bus is NULL
+ *            - 3 bus is not initialized
+ * @note      the device handles are not closed
+ */
+uint8_t mcp9600_bus_deinit(mcp9600_bus_t *bus)
+{
+    if (bus == NULL)                    /* check bus */
+    {
+        return 2;                       /* return error */
+    }
+    if (bus->inited != 1)               /* check bus initialization */
+    {
+        return 3;                       /* return error */
+    }
+    
+    bus->handle = NULL;                 /* clear handle list */
+    bus->num = 0;                       /* clear num */
+    bus->pending = 0;                   /* clear pending */
+    bus->inited = 0;                    /* clear flag */
+    
+    return 0;                           /* success return 0 */
+}
+
+/**
+ * @brief     set the conversion guard band and the collect timeout
+ * @param[in] *bus pointer to an mcp9600 bus structure
+ * @param[in] guard guard band in ms
+ * @param[in] timeout timeout after the longest expected conversion in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 bus is NULL
+ *            - 3 bus is not initialized
+ * @note      the default guard band is 0 ms and the default timeout is 10000 ms
+ */
+uint8_t mcp9600_bus_set_timing(mcp9600_bus_t *bus, uint32_t guard, uint32_t timeout)
+{
+    if (bus == NULL)                    /* check bus */
+    {
+        return 2;                       /* return error */
+    }
+    if (bus->inited != 1)               /* check bus initialization */
+    {
+        return 3;                       /* return error */
+    }
+    
+    bus->guard = guard;                 /* set guard */
+    bus->timeout = timeout;             /* set timeout */
+    
+    return 0;                           /* success return 0 */
+}
+
+/**
+ * @brief     start the burst conversion of all the devices back to back
+ * @param[in] *bus pointer to an mcp9600 bus structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ *            - 2 bus is NULL
+ *            - 3 bus is not initialized
+ * @note      a device which fails to start is left out of the next collect
+ */
+uint8_t mcp9600_bus_start(mcp9600_bus_t *bus)
+{
+    uint8_t i;
+    uint8_t res;
+    
+    if (bus == NULL)                                                                  /* check bus */
+    {
+        return 2;                                                                     /* return error */
+    }
+    if (bus->inited != 1)                                                             /* check bus initialization */
+    {
+        return 3;                                                                     /* return error */
+    }
+    
+    res = 0;                                                                          /* init result */
+    bus->pending = 0;                                                                 /* clear pending */
+    for (i = 0; i < bus->num; i++)                                                    /* start all devices */
+    {
+        if (mcp9600_single_read_start(bus->handle[i], &bus->ms[i]) != 0)              /* start burst */
+        {
+            bus->debug_print("mcp9600: start device %d failed.\n", i);                /* start device failed */
+            res = 1;                                                                  /* set failed */
+            
+            continue;                                                                 /* next device */
+        }
+        bus->pending |= 1UL << i;                                                     /* set pending */
+    }
+    
+    return res;                                                                       /* return the result */
+}
+
+/**
+ * @brief      collect the results in completion order
+ * @param[in]  *bus pointer to an mcp9600 bus structure
+ * @param[out] *sample pointer to a sample list with at least the device number members
+ * @param[out] *num pointer to a sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 collect failed
+ *             - 2 bus is NULL
+ *             - 3 bus is not initialized
+ *             - 4 no conversion is started
+ * @note       it sleeps until the first expected deadline, then polls the pending devices round
+ *             robin and reads each one as soon as its burst is complete, a device which fails or
+ *             times out is reported with its sample status and 1 is returned
+ */
+uint8_t mcp9600_bus_collect(mcp9600_bus_t *bus, mcp9600_bus_sample_t *sample, uint8_t *num)
+{
+    uint8_t i;
+    uint8_t res;
+    uint8_t due;
+    uint8_t done;
+    uint32_t elapsed;
+    uint32_t next;
+    uint32_t limit;
+    mcp9600_bool_t ready;
+    
+    if (bus == NULL)                                                                              /* check bus */
+    {
+        return 2;                                                                                 /* return error */
+    }
+    if (bus->inited != 1)                                                                         /* check bus initialization */
+    {
+        return 3;                                                                                 /* return error */
+    }
+    if (bus->pending == 0)                                                                        /* check pending */
+    {
+        bus->debug_print("mcp9600: no conversion is started.\n");                                 /* no conversion is started */
+        
+        return 4;                                                                                 /* return error */
+    }
+    
+    res = 0;                                                                                      /* init result */
+    *num = 0;                                                                                     /* init num */
+    limit = 0;                                                                                    /* init limit */
+    for (i = 0; i < bus->num; i++)                                                                /* find the last deadline */
+    {
+        if (((bus->pending >> i) & 0x01) && (bus->ms[i] > limit))                                 /* check pending */
+        {
+            limit = bus->ms[i];                                                                   /* set limit */
+        }
+    }
+    limit += bus->timeout;                                                                        /* add timeout */
+    elapsed = 0;                                                                                  /* init elapsed */
+    while (bus->pending != 0)                                                                     /* until all done */
+    {
+        due = 0;                                                                                  /* init due */
+        done = 0;                                                                                 /* init done */
+        next = limit;                                                                             /* init next deadline */
+        for (i = 0; i < bus->num; i++)                                                            /* round robin */
+        {
+            if (((bus->pending >> i) & 0x01) == 0)                                                /* check pending */
+            {
+                continue;                                                                         /* next device */
+            }
+            if (bus->ms[i] > elapsed + bus->guard)                                                /* not due yet */
+            {
+                if (bus->ms[i] - bus->guard < next)                                               /* check deadline */
+                {
+                    next = bus->ms[i] - bus->guard;                                               /* set next deadline */
+                }
+                
+                continue;                                                                         /* next device */
+            }
+            due++;                                                                                /* due++ */
+            if (mcp9600_single_read_poll(bus->handle[i], &ready) != 0)                            /* poll status */
+            {
+                res |= a_mcp9600_bus_save(bus, i, sample, num, MCP9600_BUS_SAMPLE_FAILED);        /* save failed */
+                
+                continue;                                                                         /* next device */
+            }
+            if (ready == MCP9600_BOOL_TRUE)                                                       /* check ready */
+            {
+                res |= a_mcp9600_bus_save(bus, i, sample, num, MCP9600_BUS_SAMPLE_OK);            /* save data */
+                done++;                                                                           /* done++ */
+            }
+        }
+        if (bus->pending == 0)                                                                    /* check pending */
+        {
+            break;                                                                                /* break */
+        }
+        if (elapsed >= limit)                                                                     /* check timeout */
+        {
+            for (i = 0; i < bus->num; i++)                                                        /* all the left devices */
+            {
+                if (((bus->pending >> i) & 0x01) != 0)                                            /* check pending */
+                {
+                    bus->debug_print("mcp9600: device %d read timeout.\n", i);                    /* read timeout */
+                    res |= a_mcp9600_bus_save(bus, i, sample, num, MCP9600_BUS_SAMPLE_TIMEOUT);   /* save timeout */
+                }
+            }
+            
+            break;                                                                                /* break */
+        }
+        if (due == 0)                                                                             /* nothing is due */
+        {
+            bus->delay_ms(next - elapsed);                                                        /* sleep until the next deadline */
+            elapsed = next;                                                                       /* update elapsed */
+        }
+        else if (done == 0)                                                                       /* nothing is ready */
+        {
+            bus->delay_ms(1);                                                                     /* delay 1 ms */
+            elapsed++;                                                                            /* elapsed++ */
+        }
+        else
+        {
+            continue;                                                                             /* poll again at once */
+        }
+    }
+    
+    return res;                                                                                   /* return the result */
+}
+
+/**
+ * @brief      start and collect one sample of all the devices
+ * @param[in]  *bus pointer to an mcp9600 bus structure
+ * @param[out] *sample pointer to a sample list with at least the device number members
+ * @param[out] *num pointer to a sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 bus is NULL
+ *             - 3 bus is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_bus_read(mcp9600_bus_t *bus, mcp9600_bus_sample_t *sample, uint8_t *num)
+{
+    uint8_t res;
+    
+    if (bus == NULL)                                              /* check bus */
+    {
+        return 2;                                                 /* return error */
+    }
+    if (bus->inited != 1)                                         /* check bus initialization */
+    {
+        return 3;                                                 /* return error */
+    }
+    
+    res = mcp9600_bus_start(bus);                                 /* start all devices */
+    if ((res != 0) && (bus->pending == 0))                        /* check result */
+    {
+        *num = 0;                                                 /* no sample */
+        
+        return 1;                                                 /* return error */
+    }
+    if (mcp9600_bus_collect(bus, sample, num) != 0)               /* collect all devices */
+    {
+        return 1;                                                 /* return error */
+    }
+    
+    return res;                                                   /* return the result */
+}
+
+/**
+ * @brief      read the latest temperature of the devices one by one
+ * @param[in]  *bus pointer to an mcp9600 bus structure
+ * @param[in]  first first device index
+ * @param[in]  cnt device number
+ * @param[in]  type fast read type
+ * @param[out] *data pointer to a bus data structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 fast read failed
+ * @note       none
+ */
+static uint8_t a_mcp9600_bus_fast_read_single(mcp9600_bus_t *bus, uint8_t first, uint8_t cnt, 
+                                              mcp9600_bus_fast_read_t type, mcp9600_bus_data_t *data)
+{
+    uint8_t i;
+    uint8_t res;
+    uint8_t status;
+    uint8_t reg;
+#if (MCP9600_FLOAT_API == 0)
+    int32_t hot_mc;
+#endif
+    
+    res = 0;                                                                                           /* init result */
+    for (i = first; i < first + cnt; i++)                                                              /* read all devices */
+    {
+#if (MCP9600_FLOAT_API != 0)
+        if (type == MCP9600_BUS_FAST_READ_HOT)                                                         /* hot only */
+        {
+            status = mcp9600_get_hot_junction_temperature(bus->handle[i], 
+                                                          &data->hot_raw[i], &data->hot_s[i]);         /* read hot */
+        }
+        else
+        {
+            status = mcp9600_fast_read(bus->handle[i], &data->hot_raw[i], &data->hot_s[i],
+                                       &data->delta_raw[i], &data->delta_s[i],
+                                       &data->cold_raw[i], &data->cold_s[i], &reg);                   /* read all */
+        }
+#else
+        if (type == MCP9600_BUS_FAST_READ_HOT)                                                         /* hot only */
+        {
+            status = mcp9600_get_hot_junction_temperature_fixed(bus->handle[i], 
+                                                                &data->hot_raw[i], &hot_mc);           /* read hot */
+        }
+        else
+        {
+            status = mcp9600_fast_read_raw(bus->handle[i], &data->hot_raw[i], &data->delta_raw[i],
+                                           &data->cold_raw[i], &reg);                                  /* read all */
+        }
+#endif
+        if (status != 0)                                                                               /* check result */
+        {
+            bus->debug_print("mcp9600: device %d fast read failed.\n", i);                             /* fast read failed */
+            data->status[i] = (uint8_t)MCP9600_BUS_SAMPLE_FAILED;                                      /* set failed */
+            res = 1;                                                                                   /* set error */
+            
+            continue;                                                                                  /* next device */
+        }
+        data->status[i] = (uint8_t)MCP9600_BUS_SAMPLE_OK;                                              /* set ok */
+    }
+    
+    return res;                                                                                        /* return the result */
+}
+
+/**
+ * @brief      read registers of several devices in one bus transfer
+ * @param[in]  *bus pointer to an mcp9600 bus structure
+ * @param[in]  *addr pointer to an iic device write address list
+ * @param[in]  *reg pointer to a register address list
+ * @param[in]  *len pointer to a data length list
+ * @param[in]  num register number
+ * @param[out] *buf pointer to a data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       iic_read_multi_ctx is used when it is linked
+ */
+static uint8_t a_mcp9600_bus_read_multi(mcp9600_bus_t *bus, uint8_t *addr, uint8_t *reg, 
+                                        uint16_t *len, uint8_t num, uint8_t *buf)
+{
+    if (bus->iic_read_multi_ctx != NULL)                                             /* check iic_read_multi_ctx */
+    {
+        return bus->iic_read_multi_ctx(bus->user, addr, reg, len, num, buf);         /* read in one transfer */
+    }
+    
+    return bus->iic_read_multi(addr, reg, len, num, buf);                            /* read in one transfer */
+}
+
+/**
+ * @brief      read the latest temperature of all the devices
+ * @param[in]  *bus pointer to an mcp9600 bus structure
+ * @param[in]  type fast read type
+ * @param[out] *data pointer to a bus data structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 fast read failed
+ *             - 2 bus is NULL
+ *             - 3 bus is not initialized
+ * @note       with iic_read_multi or iic_read_multi_ctx linked, the registers of as many devices
+ *             as fit in MCP9600_BUS_READ_MULTI_MAX are read in one bus transfer together with the
+ *             device configuration for the cold junction resolution, the devices of a failed transfer
+ *             are read one by one, the result of device i is stored at index i and a failed device is
+ *             marked in status
+ */
+uint8_t mcp9600_bus_fast_read(mcp9600_bus_t *bus, mcp9600_bus_fast_read_t type, mcp9600_bus_data_t *data)
+{
+    uint8_t res;
+    uint8_t i;
+    uint8_t j;
+    uint8_t k;
+    uint8_t step;
+    uint8_t size;
+    uint8_t first;
+    uint8_t cnt;
+    uint8_t *p;
+    uint8_t addr[MCP9600_BUS_READ_MULTI_MAX];
+    uint8_t reg[MCP9600_BUS_READ_MULTI_MAX];
+    uint16_t len[MCP9600_BUS_READ_MULTI_MAX];
+    uint8_t buf[MCP9600_BUS_READ_MULTI_MAX * 2];
+    
+    if (bus == NULL)                                                                                   /* check bus */
+    {
+        return 2;                                                                                      /* return error */
+    }
+    if (bus->inited != 1)                                                                              /* check bus initialization */
+    {
+        return 3;                                                                                      /* return error */
+    }
+    if ((bus->iic_read_multi == NULL) && (bus->iic_read_multi_ctx == NULL))                            /* check iic_read_multi */
+    {
+        return a_mcp9600_bus_fast_read_single(bus, 0, bus->num, type, data);                           /* read one by one */
+    }
+    
+    res = 0;                                                                                           /* init result */
+    step = (type == MCP9600_BUS_FAST_READ_HOT) ? 1 : 4;                                                /* registers of one device */
+    size = (type == MCP9600_BUS_FAST_READ_HOT) ? 2 : 7;                                                /* bytes of one device */
+    for (first = 0; first < bus->num; first += cnt)                                                    /* all transfers */
+    {
+        cnt = (uint8_t)(MCP9600_BUS_READ_MULTI_MAX / step);                                            /* devices of one transfer */
+        if (cnt > bus->num - first)                                                                    /* check the left devices */
+        {
+            cnt = bus->num - first;                                                                    /* set the left devices */
+        }
+        for (j = 0; j < cnt; j++)                                                                      /* build the transfer */
+        {
+            for (k = 0; k < step; k++)                                                                 /* all registers */
+            {
+                addr[j * step + k] = bus->handle[first + j]->iic_addr;                                 /* set device address */
+                reg[j * step + k] = MCP9600_BUS_REG_THERMOCOUPLE_HOT_JUNCTION + k;                     /* hot, delta, cold */
+                len[j * step + k] = 2;                                                                 /* 2 bytes */
+            }
+            if (step == 4)                                                                             /* with the cold junction */
+            {
+                reg[j * step + 3] = MCP9600_BUS_REG_DEVICE_CONFIGURATION;                              /* config */
+                len[j * step + 3] = 1;                                                                 /* 1 byte */
+            }
+        }
+        if (a_mcp9600_bus_read_multi(bus, (uint8_t *)addr, (uint8_t *)reg, (uint16_t *)len, 
+                                     (uint8_t)(cnt * step), (uint8_t *)buf) != 0)                      /* read all */
+        {
+            bus->debug_print("mcp9600: read multi failed.\n");                                         /* read multi failed */
+            if (a_mcp9600_bus_fast_read_single(bus, first, cnt, type, data) != 0)                      /* read the transfer one by one */
+            {
+                res = 1;                                                                               /* set error */
+            }
+            
+            continue;                                                                                  /* next transfer */
+        }
+        for (j = 0; j < cnt; j++)                                                                      /* unpack all devices */
+        {
+            i = first + j;                                                                             /* device index */
+            p = &buf[j * size];                                                                        /* device data */
+            data->status[i] = (uint8_t)MCP9600_BUS_SAMPLE_OK;                                          /* set ok */
+            data->hot_raw[i] = (int16_t)(((uint16_t)p[0] << 8) | p[1]);                                /* get raw data */
+#if (MCP9600_FLOAT_API != 0)
+            data->hot_s[i] = (float)(data->hot_raw[i]) / 16.0f;                                        /* convert the data */
+#endif
+            if (step == 1)                                                                             /* hot only */
+            {
+                continue;                                                                              /* next device */
+            }
+            data->delta_raw[i] = (int16_t)(((uint16_t)p[2] << 8) | p[3]);                              /* get raw data */
+            data->cold_raw[i] = (int16_t)(((uint16_t)p[4] << 8) | p[5]);                               /* get raw data */
+#if (MCP9600_FLOAT_API != 0)
+            data->delta_s[i] = (float)(data->delta_raw[i]) / 16.0f;                                    /* convert the data */
+            if (((p[6] >> 7) & 0x01) == 0)                                                             /* check the config */
+            {
+                data->cold_s[i] = (float)(data->cold_raw[i]) / 16.0f;                                  /* convert the data */
+            }
+            else
+            {
+                data->cold_s[i] = (float)(data->cold_raw[i]) / 4.0f;                                   /* convert the data */
+            }
+#endif
+        }
+    }
+    
+    return res;                                                                                        /* return the result */
+}
@@ -0,0 +1,322 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9600_bus.h
+ * @brief     driver mcp9600 bus header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MCP9600_BUS_H
+#define DRIVER_MCP9600_BUS_H
+
+#include "driver_mcp9600.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mcp9600_bus_driver mcp9600 bus driver function
+ * @brief    mcp9600 bus driver modules
+ * @ingroup  mcp9600_driver
+ * @{
+ */
+
+/**
+ * @brief mcp9600 bus max device number definition
+ */
+#ifndef MCP9600_BUS_MAX_DEVICE
+    #define MCP9600_BUS_MAX_DEVICE        32        /**< max 32 devices */
+#endif
+#if (MCP9600_BUS_MAX_DEVICE > 32)
+    #error "MCP9600_BUS_MAX_DEVICE can't be over 32, the pending device mask is 32 bits"
+#endif
+
+/**
+ * @brief mcp9600 bus max register number of one multi read definition
+ * @note  the linux kernel accepts 42 messages in one I2C_RDWR transfer
+ */
+#ifndef MCP9600_BUS_READ_MULTI_MAX
+    #define MCP9600_BUS_READ_MULTI_MAX        21        /**< max 21 registers */
+#endif
+
+/**
+ * @brief mcp9600 bus sample status enumeration definition
+ */
+typedef enum
+{
+    MCP9600_BUS_SAMPLE_OK      = 0x00,        /**< sample ok */
+    MCP9600_BUS_SAMPLE_FAILED  = 0x01,        /**< bus error */
+    MCP9600_BUS_SAMPLE_TIMEOUT = 0x02,        /**< conversion timeout */
+} mcp9600_bus_sample_status_t;
+
+/**
+ * @brief mcp9600 bus sample structure definition
+ */
+typedef struct mcp9600_bus_sample_s
+{
+    uint8_t index;                 /**< device index in the bus */
+    uint8_t status;                /**< sample status */
+    int16_t hot_raw;               /**< raw hot temperature */
+    int16_t delta_raw;             /**< raw delta temperature */
+    int16_t cold_raw;              /**< raw cold temperature */
+#if (MCP9600_FLOAT_API != 0)
+    float hot_s;                   /**< converted hot temperature */
+    float delta_s;                 /**< converted delta temperature */
+    float cold_s;                  /**< converted cold temperature */
+#endif
+} mcp9600_bus_sample_t;
+
+/**
+ * @brief mcp9600 bus fast read type enumeration definition
+ */
+typedef enum
+{
+    MCP9600_BUS_FAST_READ_HOT = 0x00,        /**< hot junction temperature only */
+    MCP9600_BUS_FAST_READ_ALL = 0x01,        /**< hot, delta and cold junction temperature */
+} mcp9600_bus_fast_read_t;
+
+/**
+ * @brief mcp9600 bus data structure definition
+ */
+typedef struct mcp9600_bus_data_s
+{
+    uint8_t status[MCP9600_BUS_MAX_DEVICE];          /**< sample status list */
+    int16_t hot_raw[MCP9600_BUS_MAX_DEVICE];         /**< raw hot temperature list */
+    int16_t delta_raw[MCP9600_BUS_MAX_DEVICE];       /**< raw delta temperature list */
+    int16_t cold_raw[MCP9600_BUS_MAX_DEVICE];        /**< raw cold temperature list */
+#if (MCP9600_FLOAT_API != 0)
+    float hot_s[MCP9600_BUS_MAX_DEVICE];             /**< converted hot temperature list */
+    float delta_s[MCP9600_BUS_MAX_DEVICE];           /**< converted delta temperature list */
+    float cold_s[MCP9600_BUS_MAX_DEVICE];            /**< converted cold temperature list */
+#endif
+} mcp9600_bus_data_t;
+
+/**
+ * @brief mcp9600 bus structure definition
+ */
+typedef struct mcp9600_bus_s
+{
+    uint8_t (*iic_read_multi)(uint8_t *addr, uint8_t *reg, uint16_t *len, 
+                              uint8_t num, uint8_t *buf);      /**< point to an iic_read_multi function address */
+    uint8_t (*iic_read_multi_ctx)(void *user, uint8_t *addr, uint8_t *reg, uint16_t *len, 
+                                  uint8_t num, uint8_t *buf);  /**< point to an iic_read_multi_ctx function address */
+    void (*delay_ms)(uint32_t ms);                             /**< point to a delay_ms function address */
+    void (*debug_print)(const char *const fmt, ...);           /**< point to a debug_print function address */
+    void *user;                                                /**< user context passed to the ctx functions */
+    mcp9600_handle_t **handle;                                 /**< initialized device handle list */
+    uint32_t ms[MCP9600_BUS_MAX_DEVICE];                       /**< expected conversion time list */
+    uint32_t pending;                                          /**< pending device mask */
+    uint32_t guard;                                            /**< conversion guard band in ms */
+    uint32_t timeout;                                          /**< collect timeout in ms */
+    uint8_t num;                                               /**< device number */
+    uint8_t inited;                                            /**< inited flag */
+} mcp9600_bus_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup mcp9600_bus_link_driver mcp9600 bus link driver function
+ * @brief    mcp9600 bus link driver modules
+ * @ingroup  mcp9600_bus_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize mcp9600_bus_t structure
+ * @param[in] BUS pointer to an mcp9600 bus structure
+ * @param[in] STRUCTURE mcp9600_bus_t
+ * @note      none
+ */
+#define DRIVER_MCP9600_BUS_LINK_INIT(BUS, STRUCTURE)           memset(BUS, 0, sizeof(STRUCTURE))
+
+/**
+ * @brief     link iic_read_multi function
+ * @param[in] BUS pointer to an mcp9600 bus structure
+ * @param[in] FUC pointer to an iic_read_multi function address
+ * @note      it is optional, mcp9600_bus_fast_read reads the devices one by one without it
+ */
+#define DRIVER_MCP9600_BUS_LINK_IIC_READ_MULTI(BUS, FUC)       (BUS)->iic_read_multi = FUC
+
+/**
+ * @brief     link iic_read_multi_ctx function
+ * @param[in] BUS pointer to an mcp9600 bus structure
+ * @param[in] FUC pointer to an iic_read_multi_ctx function address
+ * @note      it is optional and is used instead of iic_read_multi when it is linked
+ */
+#define DRIVER_MCP9600_BUS_LINK_IIC_READ_MULTI_CTX(BUS, FUC)   (BUS)->iic_read_multi_ctx = FUC
+
+/**
+ * @brief     link the user context
+ * @param[in] BUS pointer to an mcp9600 bus structure
+ * @param[in] USER pointer to a user context
+ * @note      it is passed to iic_read_multi_ctx, for example the adapter of the devices
+ */
+#define DRIVER_MCP9600_BUS_LINK_USER(BUS, USER)                (BUS)->user = USER
+
+/**
+ * @brief     link delay_ms function
+ * @param[in] BUS pointer to an mcp9600 bus structure
+ * @param[in] FUC pointer to a delay_ms function address
+ * @note      none
+ */
+#define DRIVER_MCP9600_BUS_LINK_DELAY_MS(BUS, FUC)             (BUS)->delay_ms = FUC
+
+/**
+ * @brief     link debug_print function
+ * @param[in] BUS pointer to an mcp9600 bus structure
+ * @param[in] FUC pointer to a debug_print function address
+ * @note      none
+ */
+#define DRIVER_MCP9600_BUS_LINK_DEBUG_PRINT(BUS, FUC)          (BUS)->debug_print = FUC
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup mcp9600_bus_base_driver mcp9600 bus base driver function
+ * @brief    mcp9600 bus base driver modules
+ * @ingroup  mcp9600_bus_driver
+ * @{
+ */
+
+/**
+ * @brief     attach the initialized devices to a bus
+ * @param[in] *bus pointer to an mcp9600 bus structure
+ * @param[in] **handle pointer to an initialized mcp9600 handle list
+ * @param[in] num device number
+ * @return    status code
+ *            - 0 success
+ *            - 2 bus is NULL
+ *            - 3 linked functions is NULL
+ *            - 4 num is invalid
+ *            - 5 handle is not initialized
+ * @note      the handle list must be kept valid until mcp9600_bus_deinit
+ */
+uint8_t mcp9600_bus_init(mcp9600_bus_t *bus, mcp9600_handle_t **handle, uint8_t num);
+
+/**
+ * @brief     detach the devices from a bus
+ * @param[in] *bus pointer to an mcp9600 bus structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 bus is NULL
+ *            - 3 bus is not initialized
+ * @note      the device handles are not closed
+ */
+uint8_t mcp9600_bus_deinit(mcp9600_bus_t *bus);
+
+/**
+ * @brief     set the conversion guard band and the collect timeout
+ * @param[in] *bus pointer to an mcp9600 bus structure
+ * @param[in] guard guard band in ms
+ * @param[in] timeout timeout after the longest expected conversion in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 bus is NULL
+ *            - 3 bus is not initialized
+ * @note      the default guard band is 0 ms and the default timeout is 10000 ms
+ */
+uint8_t mcp9600_bus_set_timing(mcp9600_bus_t *bus, uint32_t guard, uint32_t timeout);
+
+/**
+ * @brief     start the burst conversion of all the devices back to back
+ * @param[in] *bus pointer to an mcp9600 bus structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 start failed
+ *            - 2 bus is NULL
+ *            - 3 bus is not initialized
+ * @note      a device which fails to start is left out of the next collect
+ */
+uint8_t mcp9600_bus_start(mcp9600_bus_t *bus);
+
+/**
+ * @brief      collect the results in completion order
+ * @param[in]  *bus pointer to an mcp9600 bus structure
+ * @param[out] *sample pointer to a sample list with at least the device number members
+ * @param[out] *num pointer to a sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 collect failed
+ *             - 2 bus is NULL
+ *             - 3 bus is not initialized
+ *             - 4 no conversion is started
+ * @note       it sleeps until the first expected deadline, then polls the pending devices round
+ *             robin and reads each one as soon as its burst is complete, a device which fails or
+ *             times out is reported with its sample status and 1 is returned
+ */
+uint8_t mcp9600_bus_collect(mcp9600_bus_t *bus, mcp9600_bus_sample_t *sample, uint8_t *num);
+
+/**
+ * @brief      start and collect one sample of all the devices
+ * @param[in]  *bus pointer to an mcp9600 bus structure
+ * @param[out] *sample pointer to a sample list with at least the device number members
+ * @param[out] *num pointer to a sample number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 bus is NULL
+ *             - 3 bus is not initialized
+ * @note       none
+ */
+uint8_t mcp9600_bus_read(mcp9600_bus_t *bus, mcp9600_bus_sample_t *sample, uint8_t *num);
+
+/**
+ * @brief      read the latest temperature of all the devices
+ * @param[in]  *bus pointer to an mcp9600 bus structure
+ * @param[in]  type fast read type
+ * @param[out] *data pointer to a bus data structure
+ * @return     status code
+ *             - 0 success
+ *             - 1 fast read failed
+ *             - 2 bus is NULL
+ *             - 3 bus is not initialized
+ * @note       with iic_read_multi or iic_read_multi_ctx linked, the registers of as many devices
+ *             as fit in MCP9600_BUS_READ_MULTI_MAX are read in one bus transfer together with the
+ *             device configuration for the cold junction resolution, the devices of a failed transfer
+ *             are read one by one, the result of device i is stored at index i and a failed device is
+ *             marked in status
+ */
+uint8_t mcp9600_bus_fast_read(mcp9600_bus_t *bus, mcp9600_bus_fast_read_t type, mcp9600_bus_data_t *data);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,767 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9600_convert.c
+ * @brief     driver mcp9600 convert source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9600_convert.h"
+
+#if !defined(MCP9600_CONVERT_NO_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define MCP9600_CONVERT_SSE2                   /**< sse2 is the x86 64 bit baseline */
+#include <emmintrin.h>
+#endif
+#if defined(MCP9600_CONVERT_SSE2) && defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define MCP9600_CONVERT_AVX2                   /**< avx2 is built per function and checked at run time */
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define MCP9600_CONVERT_NEON                   /**< neon is checked at compile time */
+#include <arm_neon.h>
+#endif
+#endif
+
+/**
+ * @brief convert kernel structure definition
+ * @note  lsb is a power of two, so raw * lsb is exact and equals the raw / 16.0f, raw / 4.0f 
+ *        and raw * resolution of the getters bit by bit
+ */
+typedef struct mcp9600_convert_kernel_s
+{
+    void (*i16_f32)(const int16_t *raw, uint32_t num, float lsb, float *out);          /**< int16 to float */
+    void (*i16_f64)(const int16_t *raw, uint32_t num, double lsb, double *out);        /**< int16 to double */
+    void (*i32_f32)(const int32_t *raw, uint32_t num, float lsb, float *out);          /**< int32 to float */
+    void (*i32_f64)(const int32_t *raw, uint32_t num, double lsb, double *out);        /**< int32 to double */
+} mcp9600_convert_kernel_t;
+
+/**
+ * @brief      scalar int16 to float kernel
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[in]  lsb lsb weight
+ * @param[out] *out pointer to a converted data buffer
+ * @note       none
+ */
+static void a_mcp9600_convert_scalar_i16_f32(const int16_t *raw, uint32_t num, float lsb, float *out)
+{
+    uint32_t i;
+    
+    for (i = 0; i < num; i++)                        /* convert all */
+    {
+        out[i] = (float)raw[i] * lsb;                /* convert the data */
+    }
+}
+
+/**
+ * @brief      scalar int16 to double kernel
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[in]  lsb lsb weight
+ * @param[out] *out pointer to a converted data buffer
+ * @note       none
+ */
+static void a_mcp9600_convert_scalar_i16_f64(const int16_t *raw, uint32_t num, double lsb, double *out)
+{
+    uint32_t i;
+    
+    for (i = 0; i < num; i++)                        /* convert all */
+    {
+        out[i] = (double)raw[i] * lsb;               /* convert the data */
+    }
+}
+
+/**
+ * @brief      scalar int32 to float kernel
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[in]  lsb lsb weight
+ * @param[out] *out pointer to a converted data buffer
+ * @note       none
+ */
+static void a_mcp9600_convert_scalar_i32_f32(const int32_t *raw, uint32_t num, float lsb, float *out)
+{
+    uint32_t i;
+    
+    for (i = 0; i < num; i++)                        /* convert all */
+    {
+        out[i] = (float)raw[i] * lsb;                /* convert the data */
+    }
+}
+
+/**
+ * @brief      scalar int32 to double kernel
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[in]  lsb lsb weight
+ * @param[out] *out pointer to a converted data buffer
+ * @note       none
+ */
+static void a_mcp9600_convert_scalar_i32_f64(const int32_t *raw, uint32_t num, double lsb, double *out)
+{
+    uint32_t i;
+    
+    for (i = 0; i < num; i++)                        /* convert all */
+    {
+        out[i] = (double)raw[i] * lsb;               /* convert the data */
+    }
+}
+
+/**
+ * @brief scalar kernel definition
+ */
+static const mcp9600_convert_kernel_t gsc_mcp9600_convert_scalar =
+{
+    a_mcp9600_convert_scalar_i16_f32,
+    a_mcp9600_convert_scalar_i16_f64,
+    a_mcp9600_convert_scalar_i32_f32,
+    a_mcp9600_convert_scalar_i32_f64,
+};
+
+#if defined(MCP9600_CONVERT_SSE2)
+/**
+ * @brief      sse2 int16 to float kernel
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[in]  lsb lsb weight
+ * @param[out] *out pointer to a converted data buffer
+ * @note       none
+ */
+static void a_mcp9600_convert_sse2_i16_f32(const int16_t *raw, uint32_t num, float lsb, float *out)
+{
+    uint32_t i;
+    __m128i x;
+    __m128 w;
+    
+    w = _mm_set1_ps(lsb);                                                                       /* set the weight */
+    for (i = 0; i + 8 <= num; i += 8)                                                           /* 8 data per loop */
+    {
+        x = _mm_loadu_si128((const __m128i *)(raw + i));                                        /* load 8 int16 */
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16)), w));
+        _mm_storeu_ps(out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16)), w));
+    }
+    a_mcp9600_convert_scalar_i16_f32(raw + i, num - i, lsb, out + i);                           /* convert the tail */
+}
+
+/**
+ * @brief      sse2 int16 to double kernel
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[in]  lsb lsb weight
+ * @param[out] *out pointer to a converted data buffer
+ * @note       none
+ */
+static void a_mcp9600_convert_sse2_i16_f64(const int16_t *raw, uint32_t num, double lsb, double *out)
+{
+    uint32_t i;
+    __m128i x;
+    __m128i lo;
+    __m128i hi;
+    __m128d w;
+    
+    w = _mm_set1_pd(lsb);                                                                       /* set the weight */
+    for (i = 0; i + 8 <= num; i += 8)                                                           /* 8 data per loop */
+    {
+        x = _mm_loadu_si128((const __m128i *)(raw + i));                                        /* load 8 int16 */
+        lo = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);                                      /* sign extend 0 - 3 */
+        hi = _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);                                      /* sign extend 4 - 7 */
+        _mm_storeu_pd(out + i, _mm_mul_pd(_mm_cvtepi32_pd(lo), w));
+        _mm_storeu_pd(out + i + 2, _mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(lo, 8)), w));
+        _mm_storeu_pd(out + i + 4, _mm_mul_pd(_mm_cvtepi32_pd(hi), w));
+        _mm_storeu_pd(out + i + 6, _mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(hi, 8)), w));
+    }
+    a_mcp9600_convert_scalar_i16_f64(raw + i, num - i, lsb, out + i);                           /* convert the tail */
+}
+
+/**
+ * @brief      sse2 int32 to float kernel
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[in]  lsb lsb weight
+ * @param[out] *out pointer to a converted data buffer
+ * @note       none
+ */
+static void a_mcp9600_convert_sse2_i32_f32(const int32_t *raw, uint32_t num, float lsb, float *out)
+{
+    uint32_t i;
+    __m128 w;
+    
+    w = _mm_set1_ps(lsb);                                                                       /* set the weight */
+    for (i = 0; i + 4 <= num; i += 4)                                                           /* 4 data per loop */
+    {
+        _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_loadu_si128((const __m128i *)(raw + i))), w));
+    }
+    a_mcp9600_convert_scalar_i32_f32(raw + i, num - i, lsb, out + i);                           /* convert the tail */
+}
+
+/**
+ * @brief      sse2 int32 to double kernel
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[in]  lsb lsb weight
+ * @param[out] *out pointer to a converted data buffer
+ * @note       none
+ */
+static void a_mcp9600_convert_sse2_i32_f64(const int32_t *raw, uint32_t num, double lsb, double *out)
+{
+    uint32_t i;
+    __m128i x;
+    __m128d w;
+    
+    w = _mm_set1_pd(lsb);                                                                       /* set the weight */
+    for (i = 0; i + 4 <= num; i += 4)                                                           /* 4 data per loop */
+    {
+        x = _mm_loadu_si128((const __m128i *)(raw + i));                                        /* load 4 int32 */
+        _mm_storeu_pd(out + i, _mm_mul_pd(_mm_cvtepi32_pd(x), w));
+        _mm_storeu_pd(out + i + 2, _mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(x, 8)), w));
+    }
+    a_mcp9600_convert_scalar_i32_f64(raw + i, num - i, lsb, out + i);                           /* convert the tail */
+}
+
+/**
+ * @brief sse2 kernel definition
+ */
+static const mcp9600_convert_kernel_t gsc_mcp9600_convert_sse2 =
+{
+    a_mcp9600_convert_sse2_i16_f32,
+    a_mcp9600_convert_sse2_i16_f64,
+    a_mcp9600_convert_sse2_i32_f32,
+    a_mcp9600_convert_sse2_i32_f64,
+};
+#endif
+
+#if defined(MCP9600_CONVERT_AVX2)
+/**
+ * @brief      avx2 int16 to float kernel
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[in]  lsb lsb weight
+ * @param[out] *out pointer to a converted data buffer
+ * @note       none
+ */
+__attribute__((target("avx2")))
+static void a_mcp9600_convert_avx2_i16_f32(const int16_t *raw, uint32_t num, float lsb, float *out)
+{
+    uint32_t i;
+    __m256i x;
+    __m256 w;
+    
+    w = _mm256_set1_ps(lsb);                                                                    /* set the weight */
+    for (i = 0; i + 8 <= num; i += 8)                                                           /* 8 data per loop */
+    {
+        x = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(raw + i)));                 /* load and sign extend */
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(x), w));
+    }
+    a_mcp9600_convert_scalar_i16_f32(raw + i, num - i, lsb, out + i);                           /* convert the tail */
+}
+
+/**
+ * @brief      avx2 int16 to double kernel
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[in]  lsb lsb weight
+ * @param[out] *out pointer to a converted data buffer
+ * @note       none
+ */
+__attribute__((target("avx2")))
+static void a_mcp9600_convert_avx2_i16_f64(const int16_t *raw, uint32_t num, double lsb, double *out)
+{
+    uint32_t i;
+    __m128i x;
+    __m256d w;
+    
+    w = _mm256_set1_pd(lsb);                                                                    /* set the weight */
+    for (i = 0; i + 4 <= num; i += 4)                                                           /* 4 data per loop */
+    {
+        x = _mm_cvtepi16_epi32(_mm_loadl_epi64((const __m128i *)(raw + i)));                    /* load and sign extend */
+        _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_cvtepi32_pd(x), w));
+    }
+    a_mcp9600_convert_scalar_i16_f64(raw + i, num - i, lsb, out + i);                           /* convert the tail */
+}
+
+/**
+ * @brief      avx2 int32 to float kernel
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[in]  lsb lsb weight
+ * @param[out] *out pointer to a converted data buffer
+ * @note       none
+ */
+__attribute__((target("avx2")))
+static void a_mcp9600_convert_avx2_i32_f32(const int32_t *raw, uint32_t num, float lsb, float *out)
+{
+    uint32_t i;
+    __m256 w;
+    
+    w = _mm256_set1_ps(lsb);                                                                    /* set the weight */
+    for (i = 0; i + 8 <= num; i += 8)                                                           /* 8 data per loop */
+    {
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_loadu_si256((const __m256i *)(raw + i))), w));
+    }
+    a_mcp9600_convert_scalar_i32_f32(raw + i, num - i, lsb, out + i);                           /* convert the tail */
+}
+
+/**
+ * @brief      avx2 int32 to double kernel
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[in]  lsb lsb weight
+ * @param[out] *out pointer to a converted data buffer
+ * @note       none
+ */
+__attribute__((target("avx2")))
+static void a_mcp9600_convert_avx2_i32_f64(const int32_t *raw, uint32_t num, double lsb, double *out)
+{
+    uint32_t i;
+    __m256d w;
+    
+    w = _mm256_set1_pd(lsb);                                                                    /* set the weight */
+    for (i = 0; i + 4 <= num; i += 4)                                                           /* 4 data per loop */
+    {
+        _mm256_storeu_pd(out + i, _mm256_mul_pd(_mm256_cvtepi32_pd(_mm_loadu_si128((const __m128i *)(raw + i))), w));
+    }
+    a_mcp9600_convert_scalar_i32_f64(raw + i, num - i, lsb, out + i);                           /* convert the tail */
+}
+
+/**
+ * @brief avx2 kernel definition
+ */
+static const mcp9600_convert_kernel_t gsc_mcp9600_convert_avx2 =
+{
+    a_mcp9600_convert_avx2_i16_f32,
+    a_mcp9600_convert_avx2_i16_f64,
+    a_mcp9600_convert_avx2_i32_f32,
+    a_mcp9600_convert_avx2_i32_f64,
+};
+#endif
+
+#if defined(MCP9600_CONVERT_NEON)
+/**
+ * @brief      neon int16 to float kernel
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[in]  lsb lsb weight
+ * @param[out] *out pointer to a converted data buffer
+ * @note       none
+ */
+static void a_mcp9600_convert_neon_i16_f32(const int16_t *raw, uint32_t num, float lsb, float *out)
+{
+    uint32_t i;
+    int16x8_t x;
+    
+    for (i = 0; i + 8 <= num; i += 8)                                                           /* 8 data per loop */
+    {
+        x = vld1q_s16(raw + i);                                                                 /* load 8 int16 */
+        vst1q_f32(out + i, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(x))), lsb));
+        vst1q_f32(out + i + 4, vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(x))), lsb));
+    }
+    a_mcp9600_convert_scalar_i16_f32(raw + i, num - i, lsb, out + i);                           /* convert the tail */
+}
+
+/**
+ * @brief      neon int32 to float kernel
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[in]  lsb lsb weight
+ * @param[out] *out pointer to a converted data buffer
+ * @note       none
+ */
+static void a_mcp9600_convert_neon_i32_f32(const int32_t *raw, uint32_t num, float lsb, float *out)
+{
+    uint32_t i;
+    
+    for (i = 0; i + 4 <= num; i += 4)                                                           /* 4 data per loop */
+    {
+        vst1q_f32(out + i, vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(raw + i)), lsb));
+    }
+    a_mcp9600_convert_scalar_i32_f32(raw + i, num - i, lsb, out + i);                           /* convert the tail */
+}
+
+#if defined(__aarch64__)
+/**
+ * @brief      neon int16 to double kernel
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[in]  lsb lsb weight
+ * @param[out] *out pointer to a converted data buffer
+ * @note       none
+ */
+static void a_mcp9600_convert_neon_i16_f64(const int16_t *raw, uint32_t num, double lsb, double *out)
+{
+    uint32_t i;
+    int32x4_t x;
+    
+    for (i = 0; i + 4 <= num; i += 4)                                                           /* 4 data per loop */
+    {
+        x = vmovl_s16(vld1_s16(raw + i));                                                       /* load and sign extend */
+        vst1q_f64(out + i, vmulq_n_f64(vcvtq_f64_s64(vmovl_s32(vget_low_s32(x))), lsb));
+        vst1q_f64(out + i + 2, vmulq_n_f64(vcvtq_f64_s64(vmovl_s32(vget_high_s32(x))), lsb));
+    }
+    a_mcp9600_convert_scalar_i16_f64(raw + i, num - i, lsb, out + i);                           /* convert the tail */
+}
+
+/**
+ * @brief      neon int32 to double kernel
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[in]  lsb lsb weight
+ * @param[out] *out pointer to a converted data buffer
+ * @note       none
+ */
+static void a_mcp9600_convert_neon_i32_f64(const int32_t *raw, uint32_t num, double lsb, double *out)
+{
+    uint32_t i;
+    int32x4_t x;
+    
+    for (i = 0; i + 4 <= num; i += 4)                                                           /* 4 data per loop */
+    {
+        x = vld1q_s32(raw + i);                                                                 /* load 4 int32 */
+        vst1q_f64(out + i, vmulq_n_f64(vcvtq_f64_s64(vmovl_s32(vget_low_s32(x))), lsb));
+        vst1q_f64(out + i + 2, vmulq_n_f64(vcvtq_f64_s64(vmovl_s32(vget_high_s32(x))), lsb));
+    }
+    a_mcp9600_convert_scalar_i32_f64(raw + i, num - i, lsb, out + i);                           /* convert the tail */
+}
+#endif
+
+/**
+ * @brief neon kernel definition
+ * @note  32 bit arm neon has no double lanes and uses the scalar double kernels
+ */
+static const mcp9600_convert_kernel_t gsc_mcp9600_convert_neon =
+{
+    a_mcp9600_convert_neon_i16_f32,
+#if defined(__aarch64__)
+    a_mcp9600_convert_neon_i16_f64,
+#else
+    a_mcp9600_convert_scalar_i16_f64,
+#endif
+    a_mcp9600_convert_neon_i32_f32,
+#if defined(__aarch64__)
+    a_mcp9600_convert_neon_i32_f64,
+#else
+    a_mcp9600_convert_scalar_i32_f64,
+#endif
+};
+#endif
+
+/**
+ * @brief convert state definition
+ * @note  the first call may race between threads, all of them store the same selection
+ */
+static const mcp9600_convert_kernel_t *gs_kernel = NULL;                 /**< selected kernel */
+static mcp9600_convert_path_t gs_path = MCP9600_CONVERT_PATH_SCALAR;     /**< selected path */
+
+/**
+ * @brief     check the convert path
+ * @param[in] path convert path
+ * @return    kernel pointer or NULL if the path is not available
+ * @note      none
+ */
+static const mcp9600_convert_kernel_t *a_mcp9600_convert_check(mcp9600_convert_path_t path)
+{
+    switch (path)
+    {
+        case MCP9600_CONVERT_PATH_SCALAR :
+        {
+            return &gsc_mcp9600_convert_scalar;                          /* always built */
+        }
+#if defined(MCP9600_CONVERT_SSE2)
+        case MCP9600_CONVERT_PATH_SSE2 :
+        {
+            return &gsc_mcp9600_convert_sse2;                            /* compile time baseline */
+        }
+#endif
+#if defined(MCP9600_CONVERT_AVX2)
+        case MCP9600_CONVERT_PATH_AVX2 :
+        {
+            __builtin_cpu_init();                                        /* init the cpu model */
+            if (__builtin_cpu_supports("avx2") != 0)                     /* check the running cpu */
+            {
+                return &gsc_mcp9600_convert_avx2;                        /* return avx2 */
+            }
+            
+            return NULL;                                                 /* not supported */
+        }
+#endif
+#if defined(MCP9600_CONVERT_NEON)
+        case MCP9600_CONVERT_PATH_NEON :
+        {
+            return &gsc_mcp9600_convert_neon;                            /* compile time baseline */
+        }
+#endif
+        default :
+        {
+            return NULL;                                                 /* not built */
+        }
+    }
+}
+
+/**
+ * @brief  get the convert kernel
+ * @return kernel pointer
+ * @note   the best available path is selected at the first call
+ */
+static const mcp9600_convert_kernel_t *a_mcp9600_convert_kernel(void)
+{
+    int8_t i;
+    const mcp9600_convert_kernel_t *kernel;
+    
+    if (gs_kernel != NULL)                                               /* check the selection */
+    {
+        return gs_kernel;                                                /* return the selection */
+    }
+    for (i = (int8_t)MCP9600_CONVERT_PATH_NEON; i >= 0; i--)             /* from the best path */
+    {
+        kernel = a_mcp9600_convert_check((mcp9600_convert_path_t)i);     /* check the path */
+        if (kernel != NULL)                                              /* found */
+        {
+            gs_path = (mcp9600_convert_path_t)i;                         /* save the path */
+            gs_kernel = kernel;                                          /* save the kernel */
+            
+            break;                                                       /* break */
+        }
+    }
+    
+    return gs_kernel;                                                    /* return the selection */
+}
+
+/**
+ * @brief      convert a block of hot junction or delta raw data to float
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[out] *s pointer to a converted data buffer in C
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       the result is bit identical to the raw / 16.0f of the getters
+ */
+uint8_t mcp9600_convert_temperature(const int16_t *raw, uint32_t num, float *s)
+{
+    if ((raw == NULL) || (s == NULL))                                    /* check buffer */
+    {
+        return 1;                                                        /* return error */
+    }
+    
+    a_mcp9600_convert_kernel()->i16_f32(raw, num, 1.0f / 16.0f, s);      /* convert the data */
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      convert a block of hot junction or delta raw data to double
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[out] *s pointer to a converted data buffer in C
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       the result is the getter float widened to double
+ */
+uint8_t mcp9600_convert_temperature_double(const int16_t *raw, uint32_t num, double *s)
+{
+    if ((raw == NULL) || (s == NULL))                                    /* check buffer */
+    {
+        return 1;                                                        /* return error */
+    }
+    
+    a_mcp9600_convert_kernel()->i16_f64(raw, num, 1.0 / 16.0, s);        /* convert the data */
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      convert a block of cold junction raw data to float
+ * @param[in]  resolution cold junction resolution of the raw data
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[out] *s pointer to a converted data buffer in C
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL or resolution is invalid
+ * @note       the result is bit identical to mcp9600_get_cold_junction_temperature
+ */
+uint8_t mcp9600_convert_cold_junction(mcp9600_cold_junction_resolution_t resolution, 
+                                      const int16_t *raw, uint32_t num, float *s)
+{
+    if ((raw == NULL) || (s == NULL))                                    /* check buffer */
+    {
+        return 1;                                                        /* return error */
+    }
+    if (resolution == MCP9600_COLD_JUNCTION_RESOLUTION_0P0625)           /* 0.0625C */
+    {
+        a_mcp9600_convert_kernel()->i16_f32(raw, num, 1.0f / 16.0f, s);  /* convert the data */
+    }
+    else if (resolution == MCP9600_COLD_JUNCTION_RESOLUTION_0P25)        /* 0.25C */
+    {
+        a_mcp9600_convert_kernel()->i16_f32(raw, num, 1.0f / 4.0f, s);   /* convert the data */
+    }
+    else
+    {
+        return 1;                                                        /* return error */
+    }
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      convert a block of cold junction raw data to double
+ * @param[in]  resolution cold junction resolution of the raw data
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[out] *s pointer to a converted data buffer in C
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL or resolution is invalid
+ * @note       the result is the getter float widened to double
+ */
+uint8_t mcp9600_convert_cold_junction_double(mcp9600_cold_junction_resolution_t resolution, 
+                                             const int16_t *raw, uint32_t num, double *s)
+{
+    if ((raw == NULL) || (s == NULL))                                    /* check buffer */
+    {
+        return 1;                                                        /* return error */
+    }
+    if (resolution == MCP9600_COLD_JUNCTION_RESOLUTION_0P0625)           /* 0.0625C */
+    {
+        a_mcp9600_convert_kernel()->i16_f64(raw, num, 1.0 / 16.0, s);    /* convert the data */
+    }
+    else if (resolution == MCP9600_COLD_JUNCTION_RESOLUTION_0P25)        /* 0.25C */
+    {
+        a_mcp9600_convert_kernel()->i16_f64(raw, num, 1.0 / 4.0, s);     /* convert the data */
+    }
+    else
+    {
+        return 1;                                                        /* return error */
+    }
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      convert a block of raw adc data to double
+ * @param[in]  resolution adc resolution of the raw data
+ * @param[in]  *raw pointer to a raw adc data buffer from mcp9600_get_raw_adc
+ * @param[in]  num data number
+ * @param[out] *uv pointer to a converted data buffer in uV
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL or resolution is invalid
+ * @note       the result is bit identical to mcp9600_get_raw_adc
+ */
+uint8_t mcp9600_convert_raw_adc(mcp9600_adc_resolution_t resolution, const int32_t *raw, uint32_t num, double *uv)
+{
+    if ((raw == NULL) || (uv == NULL))                                   /* check buffer */
+    {
+        return 1;                                                        /* return error */
+    }
+    if (resolution > MCP9600_ADC_RESOLUTION_12_BIT)                      /* check resolution */
+    {
+        return 1;                                                        /* return error */
+    }
+    
+    a_mcp9600_convert_kernel()->i32_f64(raw, num, 
+                                        2.0 * (double)(1 << ((uint32_t)resolution * 2)), uv);    /* 2, 8, 32 or 128 uV */
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      convert a block of raw adc data to float
+ * @param[in]  resolution adc resolution of the raw data
+ * @param[in]  *raw pointer to a raw adc data buffer from mcp9600_get_raw_adc
+ * @param[in]  num data number
+ * @param[out] *uv pointer to a converted data buffer in uV
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL or resolution is invalid
+ * @note       the result is the mcp9600_get_raw_adc double rounded to float
+ */
+uint8_t mcp9600_convert_raw_adc_float(mcp9600_adc_resolution_t resolution, const int32_t *raw, uint32_t num, float *uv)
+{
+    if ((raw == NULL) || (uv == NULL))                                   /* check buffer */
+    {
+        return 1;                                                        /* return error */
+    }
+    if (resolution > MCP9600_ADC_RESOLUTION_12_BIT)                      /* check resolution */
+    {
+        return 1;                                                        /* return error */
+    }
+    
+    a_mcp9600_convert_kernel()->i32_f32(raw, num, 
+                                        2.0f * (float)(1 << ((uint32_t)resolution * 2)), uv);    /* 2, 8, 32 or 128 uV */
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief      get the convert path
+ * @param[out] *path pointer to a convert path buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 path is NULL
+ * @note       the best path of the running cpu is selected at the first call
+ */
+uint8_t mcp9600_convert_get_path(mcp9600_convert_path_t *path)
+{
+    if (path == NULL)                                                    /* check path */
+    {
+        return 1;                                                        /* return error */
+    }
+    
+    (void)a_mcp9600_convert_kernel();                                    /* select the kernel */
+    *path = gs_path;                                                     /* get the path */
+    
+    return 0;                                                            /* success return 0 */
+}
+
+/**
+ * @brief     set the convert path
+ * @param[in] path convert path
+ * @return    status code
+ *            - 0 success
+ *            - 1 path is not built or not supported by the running cpu
+ * @note      it is used to compare the paths, all paths give the same result
+ */
+uint8_t mcp9600_convert_set_path(mcp9600_convert_path_t path)
+{
+    const mcp9600_convert_kernel_t *kernel;
+    
+    kernel = a_mcp9600_convert_check(path);                              /* check the path */
+    if (kernel == NULL)                                                  /* check result */
+    {
+        return 1;                                                        /* return error */
+    }
+    gs_path = path;                                                      /* save the path */
+    gs_kernel = kernel;                                                  /* save the kernel */
+    
+    return 0;                                                            /* success return 0 */
+}
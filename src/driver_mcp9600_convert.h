@@ -0,0 +1,170 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9600_convert.h
+ * @brief     driver mcp9600 convert header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MCP9600_CONVERT_H
+#define DRIVER_MCP9600_CONVERT_H
+
+#include "driver_mcp9600.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mcp9600_convert_driver mcp9600 convert driver function
+ * @brief    mcp9600 convert driver modules
+ * @ingroup  mcp9600_driver
+ * @{
+ */
+
+/**
+ * @brief mcp9600 convert path enumeration definition
+ */
+typedef enum
+{
+    MCP9600_CONVERT_PATH_SCALAR = 0x00,        /**< portable c */
+    MCP9600_CONVERT_PATH_SSE2   = 0x01,        /**< x86 sse2 */
+    MCP9600_CONVERT_PATH_AVX2   = 0x02,        /**< x86 avx2 */
+    MCP9600_CONVERT_PATH_NEON   = 0x03,        /**< arm neon */
+} mcp9600_convert_path_t;
+
+/**
+ * @brief      convert a block of hot junction or delta raw data to float
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[out] *s pointer to a converted data buffer in C
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       the result is bit identical to the raw / 16.0f of the getters
+ */
+uint8_t mcp9600_convert_temperature(const int16_t *raw, uint32_t num, float *s);
+
+/**
+ * @brief      convert a block of hot junction or delta raw data to double
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[out] *s pointer to a converted data buffer in C
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL
+ * @note       the result is the getter float widened to double
+ */
+uint8_t mcp9600_convert_temperature_double(const int16_t *raw, uint32_t num, double *s);
+
+/**
+ * @brief      convert a block of cold junction raw data to float
+ * @param[in]  resolution cold junction resolution of the raw data
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[out] *s pointer to a converted data buffer in C
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL or resolution is invalid
+ * @note       the result is bit identical to mcp9600_get_cold_junction_temperature
+ */
+uint8_t mcp9600_convert_cold_junction(mcp9600_cold_junction_resolution_t resolution, 
+                                      const int16_t *raw, uint32_t num, float *s);
+
+/**
+ * @brief      convert a block of cold junction raw data to double
+ * @param[in]  resolution cold junction resolution of the raw data
+ * @param[in]  *raw pointer to a raw data buffer
+ * @param[in]  num data number
+ * @param[out] *s pointer to a converted data buffer in C
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL or resolution is invalid
+ * @note       the result is the getter float widened to double
+ */
+uint8_t mcp9600_convert_cold_junction_double(mcp9600_cold_junction_resolution_t resolution, 
+                                             const int16_t *raw, uint32_t num, double *s);
+
+/**
+ * @brief      convert a block of raw adc data to double
+ * @param[in]  resolution adc resolution of the raw data
+ * @param[in]  *raw pointer to a raw adc data buffer from mcp9600_get_raw_adc
+ * @param[in]  num data number
+ * @param[out] *uv pointer to a converted data buffer in uV
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL or resolution is invalid
+ * @note       the result is bit identical to mcp9600_get_raw_adc
+ */
+uint8_t mcp9600_convert_raw_adc(mcp9600_adc_resolution_t resolution, const int32_t *raw, uint32_t num, double *uv);
+
+/**
+ * @brief      convert a block of raw adc data to float
+ * @param[in]  resolution adc resolution of the raw data
+ * @param[in]  *raw pointer to a raw adc data buffer from mcp9600_get_raw_adc
+ * @param[in]  num data number
+ * @param[out] *uv pointer to a converted data buffer in uV
+ * @return     status code
+ *             - 0 success
+ *             - 1 buffer is NULL or resolution is invalid
+ * @note       the result is the mcp9600_get_raw_adc double rounded to float
+ */
+uint8_t mcp9600_convert_raw_adc_float(mcp9600_adc_resolution_t resolution, const int32_t *raw, uint32_t num, float *uv);
+
+/**
+ * @brief      get the convert path
+ * @param[out] *path pointer to a convert path buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 path is NULL
+ * @note       the best path of the running cpu is selected at the first call
+ */
+uint8_t mcp9600_convert_get_path(mcp9600_convert_path_t *path);
+
+/**
+ * @brief     set the convert path
+ * @param[in] path convert path
+ * @return    status code
+ *            - 0 success
+ *            - 1 path is not built or not supported by the running cpu
+ * @note      it is used to compare the paths, all paths give the same result
+ */
+uint8_t mcp9600_convert_set_path(mcp9600_convert_path_t path);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,683 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9600_coro.hpp
+ * @brief     driver mcp9600 c++ coroutine header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+
+#ifndef DRIVER_MCP9600_CORO_HPP
+#define DRIVER_MCP9600_CORO_HPP
+
+#include "driver_mcp9600.hpp"
+
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <queue>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#if (__cplusplus < 202002L)
+#error "driver_mcp9600_coro.hpp needs c++20 or newer"
+#endif
+
+/**
+ * @defgroup mcp9600_coro_driver mcp9600 coroutine driver function
+ * @brief    mcp9600 coroutine driver modules
+ * @ingroup  mcp9600_driver
+ * @{
+ */
+
+namespace libdriver
+{
+
+class Mcp9600Executor;
+class Mcp9600Alert;
+
+/**
+ * @brief mcp9600 lazy coroutine task class definition
+ * @note  the task starts when it is awaited or spawned on an executor
+ */
+template <class T = void>
+class Mcp9600Task;
+
+/**
+ * @brief mcp9600 coroutine detail namespace
+ */
+namespace mcp9600_coro_detail
+{
+    /**
+     * @brief promise base with the continuation and the detached owner
+     */
+    struct promise_base
+    {
+        std::coroutine_handle<> continuation;        /**< awaiting coroutine */
+        Mcp9600Executor *executor = nullptr;         /**< owner of a detached task */
+        
+        struct final_awaiter
+        {
+            bool await_ready() const noexcept
+            {
+                return false;
+            }
+            
+            template <class P>
+            std::coroutine_handle<> await_suspend(std::coroutine_handle<P> h) noexcept;
+            
+            void await_resume() const noexcept
+            {
+            }
+        };
+        
+        std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+        
+        final_awaiter final_suspend() const noexcept
+        {
+            return {};
+        }
+        
+        void unhandled_exception() const noexcept
+        {
+            std::terminate();
+        }
+    };
+    
+    /**
+     * @brief promise storing the return value
+     */
+    template <class T>
+    struct promise : promise_base
+    {
+        T value{};        /**< returned value */
+        
+        Mcp9600Task<T> get_return_object() noexcept;
+        
+        void return_value(T v) noexcept
+        {
+            value = std::move(v);
+        }
+    };
+    
+    /**
+     * @brief promise of a task without a value
+     */
+    template <>
+    struct promise<void> : promise_base
+    {
+        Mcp9600Task<void> get_return_object() noexcept;
+        
+        void return_void() const noexcept
+        {
+        }
+    };
+}
+
+template <class T>
+class Mcp9600Task
+{
+  public:
+    using promise_type = mcp9600_coro_detail::promise<T>;
+    
+    explicit Mcp9600Task(std::coroutine_handle<promise_type> h) noexcept : m_handle(h)
+    {
+    }
+    
+    Mcp9600Task(Mcp9600Task &&other) noexcept : m_handle(std::exchange(other.m_handle, {}))
+    {
+    }
+    
+    Mcp9600Task(const Mcp9600Task &) = delete;
+    Mcp9600Task &operator=(const Mcp9600Task &) = delete;
+    Mcp9600Task &operator=(Mcp9600Task &&) = delete;
+    
+    ~Mcp9600Task()
+    {
+        if (m_handle)
+        {
+            m_handle.destroy();
+        }
+    }
+    
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+    
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept
+    {
+        m_handle.promise().continuation = awaiting;
+        
+        return m_handle;
+    }
+    
+    T await_resume() noexcept
+    {
+        if constexpr (!std::is_void_v<T>)
+        {
+            return std::move(m_handle.promise().value);
+        }
+    }
+    
+    /**
+     * @brief  release the coroutine frame to a new owner
+     * @return coroutine handle
+     * @note   none
+     */
+    std::coroutine_handle<promise_type> release() noexcept
+    {
+        return std::exchange(m_handle, {});
+    }
+    
+  private:
+    std::coroutine_handle<promise_type> m_handle;        /**< coroutine frame */
+};
+
+/**
+ * @brief mcp9600 single threaded executor class definition
+ * @note  timers are kept in one heap and ready coroutines in one queue, so one thread can
+ *        drive hundreds of sensors, the clock and the sleep can be replaced for simulated time,
+ *        all members must be called from the executor thread
+ */
+class Mcp9600Executor
+{
+  public:
+    using now_fn = uint64_t (*)(void *user);                  /**< monotonic time in ms */
+    using sleep_fn = void (*)(void *user, uint32_t ms);       /**< idle sleep in ms */
+    
+    /**
+     * @brief executor using the steady clock and a thread sleep
+     * @note  none
+     */
+    Mcp9600Executor() noexcept : m_now(a_steady_now), m_sleep(a_thread_sleep), m_user(nullptr)
+    {
+    }
+    
+    /**
+     * @brief     executor with a user clock
+     * @param[in] now pointer to a time function
+     * @param[in] sleep pointer to an idle sleep function
+     * @param[in] *user pointer to the user context of both functions
+     * @note      none
+     */
+    Mcp9600Executor(now_fn now, sleep_fn sleep, void *user) noexcept : m_now(now), m_sleep(sleep), m_user(user)
+    {
+    }
+    
+    Mcp9600Executor(const Mcp9600Executor &) = delete;
+    Mcp9600Executor &operator=(const Mcp9600Executor &) = delete;
+    
+    /**
+     * @brief  destroy the tasks that never finished
+     * @note   none
+     */
+    ~Mcp9600Executor()
+    {
+        for (void *frame : m_owned)
+        {
+            std::coroutine_handle<>::from_address(frame).destroy();
+        }
+    }
+    
+    /**
+     * @brief     run a task detached on the executor
+     * @param[in] &&task started task
+     * @note      the frame is freed when the task returns
+     */
+    void spawn(Mcp9600Task<void> &&task)
+    {
+        std::coroutine_handle<Mcp9600Task<void>::promise_type> h = task.release();
+        
+        h.promise().executor = this;
+        m_owned.insert(h.address());
+        m_ready.push_back(h);
+    }
+    
+    /**
+     * @brief  get the number of unfinished spawned tasks
+     * @return task number
+     * @note   none
+     */
+    size_t tasks() const noexcept
+    {
+        return m_owned.size();
+    }
+    
+    /**
+     * @brief  get the executor time
+     * @return time in ms
+     * @note   none
+     */
+    uint64_t now() const
+    {
+        return m_now(m_user);
+    }
+    
+    /**
+     * @brief     run until all spawned tasks are finished
+     * @note      none
+     */
+    void run()
+    {
+        while (!m_owned.empty())
+        {
+            if (!run_once())
+            {
+                break;
+            }
+        }
+    }
+    
+    /**
+     * @brief  resume all ready coroutines and the expired timers once
+     * @return false if nothing can ever be resumed again
+     * @note   sleeps until the next deadline when nothing is ready
+     */
+    bool run_once()
+    {
+        if (m_ready.empty())
+        {
+            if (m_timer.empty())
+            {
+                return false;
+            }
+            uint64_t t = now();
+            const uint64_t deadline = m_timer.top().deadline;
+            
+            if (deadline > t)
+            {
+                m_sleep(m_user, static_cast<uint32_t>(deadline - t));
+            }
+        }
+        a_expire(now());
+        while (!m_ready.empty())
+        {
+            std::coroutine_handle<> h = m_ready.front();
+            
+            m_ready.pop_front();
+            h.resume();
+        }
+        
+        return true;
+    }
+    
+    /**
+     * @brief mcp9600 sleep awaitable definition
+     */
+    struct sleep_awaiter
+    {
+        Mcp9600Executor *executor;        /**< executor */
+        uint32_t ms;                      /**< sleep time */
+        
+        bool await_ready() const noexcept
+        {
+            return false;
+        }
+        
+        void await_suspend(std::coroutine_handle<> h)
+        {
+            (void)executor->a_add_timer(ms, h, nullptr);
+        }
+        
+        void await_resume() const noexcept
+        {
+        }
+    };
+    
+    /**
+     * @brief     suspend the coroutine for a while
+     * @param[in] ms sleep time in ms
+     * @return    awaitable object
+     * @note      a zero time yields to the other ready coroutines
+     */
+    sleep_awaiter sleep(uint32_t ms) noexcept
+    {
+        return sleep_awaiter{this, ms};
+    }
+    
+  private:
+    friend class Mcp9600Alert;
+    friend struct mcp9600_coro_detail::promise_base::final_awaiter;
+    
+    struct timer_t
+    {
+        uint64_t deadline;                 /**< expire time */
+        uint64_t ticket;                   /**< unique timer id */
+        std::coroutine_handle<> handle;    /**< coroutine to resume */
+        Mcp9600Alert *alert;               /**< alert waiting on the same coroutine */
+        
+        bool operator>(const timer_t &other) const noexcept
+        {
+            return (deadline != other.deadline) ? (deadline > other.deadline) : (ticket > other.ticket);
+        }
+    };
+    
+    static uint64_t a_steady_now(void *user)
+    {
+        (void)user;
+        
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                     std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+    
+    static void a_thread_sleep(void *user, uint32_t ms)
+    {
+        (void)user;
+        std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+    }
+    
+    uint64_t a_add_timer(uint32_t ms, std::coroutine_handle<> h, Mcp9600Alert *alert)
+    {
+        const uint64_t ticket = ++m_ticket;
+        
+        m_timer.push(timer_t{now() + ms, ticket, h, alert});
+        
+        return ticket;
+    }
+    
+    void a_cancel_timer(uint64_t ticket)
+    {
+        m_cancel.insert(ticket);
+    }
+    
+    void a_post(std::coroutine_handle<> h)
+    {
+        m_ready.push_back(h);
+    }
+    
+    void a_finish(std::coroutine_handle<> h)
+    {
+        m_owned.erase(h.address());
+    }
+    
+    inline void a_expire(uint64_t t);
+    
+    now_fn m_now;                                                                              /**< time function */
+    sleep_fn m_sleep;                                                                          /**< idle sleep function */
+    void *m_user;                                                                              /**< clock user context */
+    uint64_t m_ticket = 0;                                                                     /**< last timer id */
+    std::priority_queue<timer_t, std::vector<timer_t>, std::greater<timer_t>> m_timer;         /**< timer heap */
+    std::unordered_set<uint64_t> m_cancel;                                                     /**< cancelled timer ids */
+    std::deque<std::coroutine_handle<>> m_ready;                                               /**< ready coroutines */
+    std::unordered_set<void *> m_owned;                                                        /**< spawned frames */
+};
+
+/**
+ * @brief mcp9600 alert event class definition
+ * @note  one coroutine can wait on the event, set() is called from the executor thread,
+ *        for example by the task that services the gpio edge
+ */
+class Mcp9600Alert
+{
+  public:
+    explicit Mcp9600Alert(Mcp9600Executor &executor) noexcept : m_executor(&executor)
+    {
+    }
+    
+    Mcp9600Alert(const Mcp9600Alert &) = delete;
+    Mcp9600Alert &operator=(const Mcp9600Alert &) = delete;
+    
+    /**
+     * @brief  signal the event
+     * @note   wakes the waiting coroutine or latches the event for the next wait
+     */
+    void set()
+    {
+        if (m_waiter)
+        {
+            m_executor->a_cancel_timer(m_ticket);
+            m_executor->a_post(std::exchange(m_waiter, {}));
+        }
+        m_flag = true;
+    }
+    
+    /**
+     * @brief  clear a latched event
+     * @note   none
+     */
+    void reset() noexcept
+    {
+        m_flag = false;
+    }
+    
+    /**
+     * @brief mcp9600 alert awaitable definition
+     */
+    struct wait_awaiter
+    {
+        Mcp9600Alert *alert;        /**< alert event */
+        uint32_t ms;                /**< timeout */
+        
+        bool await_ready() const noexcept
+        {
+            return alert->m_flag;
+        }
+        
+        void await_suspend(std::coroutine_handle<> h)
+        {
+            alert->m_waiter = h;
+            alert->m_ticket = alert->m_executor->a_add_timer(ms, h, alert);
+        }
+        
+        bool await_resume() const noexcept
+        {
+            return std::exchange(alert->m_flag, false);
+        }
+    };
+    
+    /**
+     * @brief     wait for the event or the timeout
+     * @param[in] ms timeout in ms
+     * @return    awaitable object resuming with true on the event and false on the timeout
+     * @note      none
+     */
+    wait_awaiter wait(uint32_t ms) noexcept
+    {
+        return wait_awaiter{this, ms};
+    }
+    
+  private:
+    friend class Mcp9600Executor;
+    
+    Mcp9600Executor *m_executor;            /**< executor */
+    std::coroutine_handle<> m_waiter;       /**< waiting coroutine */
+    uint64_t m_ticket = 0;                  /**< timeout timer id */
+    bool m_flag = false;                    /**< latched event */
+};
+
+inline void Mcp9600Executor::a_expire(uint64_t t)
+{
+    while (!m_timer.empty() && (m_timer.top().deadline <= t))
+    {
+        timer_t e = m_timer.top();
+        
+        m_timer.pop();
+        if (m_cancel.erase(e.ticket) != 0)
+        {
+            continue;
+        }
+        if (e.alert != nullptr)
+        {
+            e.alert->m_waiter = {};
+        }
+        m_ready.push_back(e.handle);
+    }
+}
+
+template <class P>
+inline std::coroutine_handle<> mcp9600_coro_detail::promise_base::final_awaiter::await_suspend(std::coroutine_handle<P> h) noexcept
+{
+    promise_base &p = h.promise();
+    
+    if (p.continuation)
+    {
+        return p.continuation;
+    }
+    if (p.executor != nullptr)
+    {
+        p.executor->a_finish(h);
+        h.destroy();
+    }
+    
+    return std::noop_coroutine();
+}
+
+template <class T>
+inline Mcp9600Task<T> mcp9600_coro_detail::promise<T>::get_return_object() noexcept
+{
+    return Mcp9600Task<T>(std::coroutine_handle<promise<T>>::from_promise(*this));
+}
+
+inline Mcp9600Task<void> mcp9600_coro_detail::promise<void>::get_return_object() noexcept
+{
+    return Mcp9600Task<void>(std::coroutine_handle<promise<void>>::from_promise(*this));
+}
+
+/**
+ * @brief mcp9600 burst result structure definition
+ */
+struct Mcp9600Burst
+{
+    uint8_t status;                /**< single read status code */
+    Mcp9600Sample sample;          /**< read sample */
+};
+
+/**
+ * @brief mcp9600 asynchronous sensor class definition
+ * @note  Sensor is an Mcp9600 instantiation, the sensor, the executor and the alert must
+ *        outlive every pending read
+ */
+template <class Sensor>
+class Mcp9600Async
+{
+  public:
+    /**
+     * @brief     bind a sensor to an executor
+     * @param[in] &executor reference to the executor
+     * @param[in] &sensor reference to an initialized sensor
+     * @param[in] *alert pointer to the gpio alert event or nullptr to use the timer only
+     * @note      none
+     */
+    Mcp9600Async(Mcp9600Executor &executor, Sensor &sensor, Mcp9600Alert *alert = nullptr) noexcept
+        : m_executor(&executor), m_sensor(&sensor), m_alert(alert)
+    {
+    }
+    
+    /**
+     * @brief  get the bound sensor
+     * @return reference to the sensor
+     * @note   none
+     */
+    Sensor &sensor() noexcept
+    {
+        return *m_sensor;
+    }
+    
+    /**
+     * @brief  run one burst and read the sample without blocking the executor
+     * @return task resuming with the status and the sample
+     *         - 0 success
+     *         - 1 single read failed
+     *         - 2 handle is NULL
+     *         - 3 handle is not initialized
+     *         - 4 read timeout
+     * @note   suspends for the conversion time or until the alert event, then polls
+     *         the status register every 1 ms like mcp9600_single_read
+     */
+    Mcp9600Task<Mcp9600Burst> read_burst()
+    {
+        Mcp9600Burst burst{};
+        uint32_t ms = 0;
+        bool ready = false;
+        
+        burst.status = m_sensor->single_read_start(ms);
+        if (burst.status != 0)
+        {
+            co_return burst;
+        }
+        const uint32_t guard = m_sensor->handle()->conversion_guard;
+        const uint32_t wait = (ms > guard) ? (ms - guard) : 0;
+        
+        if (m_alert != nullptr)
+        {
+            m_alert->reset();
+            (void)co_await m_alert->wait(wait);
+        }
+        else
+        {
+            co_await m_executor->sleep(wait);
+        }
+        for (uint32_t timeout = 10000; timeout != 0; timeout--)
+        {
+            burst.status = m_sensor->single_read_poll(ready);
+            if (burst.status != 0)
+            {
+                co_return burst;
+            }
+            if (ready)
+            {
+                break;
+            }
+            co_await m_executor->sleep(1);
+        }
+        if (!ready)
+        {
+            m_sensor->handle()->debug_print("mcp9600: read timeout.\n");
+            burst.status = 4;
+            
+            co_return burst;
+        }
+        burst.status = m_sensor->single_read_collect(burst.sample);
+        
+        co_return burst;
+    }
+    
+  private:
+    Mcp9600Executor *m_executor;        /**< executor */
+    Sensor *m_sensor;                   /**< sensor */
+    Mcp9600Alert *m_alert;              /**< optional alert event */
+};
+
+}
+
+/**
+ * @}
+ */
+
+#endif
@@ -0,0 +1,603 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9600_fleet.c
+ * @brief     driver mcp9600 fleet source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9600_fleet.h"
+#include "driver_mcp9600_convert.h"
+
+/**
+ * @brief chip register definition
+ */
+#define MCP9600_FLEET_REG_DEVICE_CONFIGURATION        0x06        /**< device configuration register */
+#define MCP9600_FLEET_REG_DEVICE_ID_REVISON           0x20        /**< device id/revision register */
+
+/**
+ * @brief fleet flag definition
+ */
+#define MCP9600_FLEET_FLAG_CONFIG        (1 << 0)        /**< cached config is valid */
+#define MCP9600_FLEET_FLAG_FILTER        (1 << 1)        /**< filter is seeded */
+
+/**
+ * @brief     point the shared handle to one device
+ * @param[in] *fleet pointer to an mcp9600 fleet structure
+ * @param[in] index device index
+ * @note      none
+ */
+static void a_mcp9600_fleet_select(mcp9600_fleet_t *fleet, uint16_t index)
+{
+    fleet->handle.iic_addr = fleet->addr[index];        /* set the address */
+    fleet->handle.user = fleet->user[index];            /* set the bus context */
+    fleet->current = index;                             /* save the index */
+}
+
+/**
+ * @brief     convert a limit in mC to the raw data
+ * @param[in] mc limit in mC
+ * @param[in] up 1 to round up, 0 to round down
+ * @return    raw limit
+ * @note      one lsb is 62.5 mC and the result is clamped to the int16 range
+ */
+static int16_t a_mcp9600_fleet_limit(int32_t mc, uint8_t up)
+{
+    int64_t m;
+    int64_t q;
+    
+    m = (int64_t)mc * 2;                                  /* 2 times the limit */
+    q = m / 125;                                          /* rounded toward zero */
+    if ((up != 0) && (q * 125 < m))                       /* round up */
+    {
+        q++;                                              /* next step */
+    }
+    if ((up == 0) && (q * 125 > m))                       /* round down */
+    {
+        q--;                                              /* previous step */
+    }
+    if (q > INT16_MAX)                                    /* check the max */
+    {
+        q = INT16_MAX;                                    /* clamp */
+    }
+    if (q < INT16_MIN)                                    /* check the min */
+    {
+        q = INT16_MIN;                                    /* clamp */
+    }
+    
+    return (int16_t)q;                                    /* return the limit */
+}
+
+/**
+ * @brief     initialize an empty fleet
+ * @param[in] *fleet pointer to an mcp9600 fleet structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 fleet is NULL
+ *            - 3 linked functions is NULL
+ * @note      the register cache of the shared handle is disabled, the bus is opened by
+ *            the first mcp9600_fleet_add
+ */
+uint8_t mcp9600_fleet_init(mcp9600_fleet_t *fleet)
+{
+    if (fleet == NULL)                                                              /* check fleet */
+    {
+        return 2;                                                                   /* return error */
+    }
+    if (fleet->handle.debug_print == NULL)                                          /* check debug_print */
+    {
+        return 3;                                                                   /* return error */
+    }
+    
+    (void)mcp9600_set_register_cache(&fleet->handle, MCP9600_BOOL_FALSE);           /* the cache holds one device */
+    fleet->handle.inited = 0;                                                       /* bus is closed */
+    fleet->num = 0;                                                                 /* no device */
+    fleet->current = 0;                                                             /* clear the index */
+    fleet->inited = 1;                                                              /* set inited */
+    
+    return 0;                                                                       /* success return 0 */
+}
+
+/**
+ * @brief     shut down all the devices and close the bus
+ * @param[in] *fleet pointer to an mcp9600 fleet structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ *            - 2 fleet is NULL
+ *            - 3 fleet is not initialized
+ * @note      every device is shut down even if one of them fails
+ */
+uint8_t mcp9600_fleet_deinit(mcp9600_fleet_t *fleet)
+{
+    uint8_t err;
+    uint16_t i;
+    
+    if (fleet == NULL)                                                                       /* check fleet */
+    {
+        return 2;                                                                            /* return error */
+    }
+    if (fleet->inited != 1)                                                                  /* check fleet initialization */
+    {
+        return 3;                                                                            /* return error */
+    }
+    
+    err = 0;                                                                                 /* clear the error */
+    for (i = 0; i + 1 < fleet->num; i++)                                                     /* all but the last device */
+    {
+        a_mcp9600_fleet_select(fleet, i);                                                    /* select the device */
+        if (mcp9600_set_mode(&fleet->handle, MCP9600_MODE_SHUTDOWN) != 0)                    /* shut down */
+        {
+            fleet->handle.debug_print("mcp9600: device %d shut down failed.\n", i);          /* shut down failed */
+            err = 1;                                                                         /* set the error */
+        }
+    }
+    if (fleet->handle.inited == 1)                                                           /* check the bus */
+    {
+        if (fleet->num != 0)                                                                 /* check the device number */
+        {
+            a_mcp9600_fleet_select(fleet, (uint16_t)(fleet->num - 1));                       /* select the last device */
+        }
+        if (mcp9600_deinit(&fleet->handle) != 0)                                             /* shut down and close the bus */
+        {
+            err = 1;                                                                         /* set the error */
+        }
+    }
+    fleet->num = 0;                                                                          /* no device */
+    fleet->inited = 0;                                                                       /* flag close */
+    
+    return err;                                                                              /* return the result */
+}
+
+/**
+ * @brief      add one device to a fleet
+ * @param[in]  *fleet pointer to an mcp9600 fleet structure
+ * @param[in]  addr_pin iic address pin of the device
+ * @param[in]  *user device bus context passed to the transport functions
+ * @param[out] *index pointer to a device index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 add failed
+ *             - 2 fleet is NULL
+ *             - 3 fleet is not initialized
+ *             - 4 fleet is full
+ * @note       the bus is opened with the user of the first device, the later devices only
+ *             select their channel through user, for example a mux port
+ */
+uint8_t mcp9600_fleet_add(mcp9600_fleet_t *fleet, mcp9600_address_t addr_pin, void *user, uint16_t *index)
+{
+    uint8_t buf[2];
+    uint16_t n;
+    
+    if (fleet == NULL)                                                                        /* check fleet */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (fleet->inited != 1)                                                                   /* check fleet initialization */
+    {
+        return 3;                                                                             /* return error */
+    }
+    if (fleet->num >= MCP9600_FLEET_MAX_DEVICE)                                               /* check the device number */
+    {
+        fleet->handle.debug_print("mcp9600: fleet is full.\n");                               /* fleet is full */
+        
+        return 4;                                                                             /* return error */
+    }
+    
+    n = fleet->num;                                                                           /* new index */
+    fleet->addr[n] = (uint8_t)addr_pin;                                                       /* set the address */
+    fleet->user[n] = user;                                                                    /* set the bus context */
+    a_mcp9600_fleet_select(fleet, n);                                                         /* select the device */
+    if (fleet->handle.inited != 1)                                                            /* first device */
+    {
+        if (mcp9600_init(&fleet->handle) != 0)                                                /* open the bus and check id */
+        {
+            return 1;                                                                         /* return error */
+        }
+    }
+    else
+    {
+        if (mcp9600_get_reg(&fleet->handle, MCP9600_FLEET_REG_DEVICE_ID_REVISON, 
+                           (uint8_t *)buf, 2) != 0)                                           /* read device id */
+        {
+            fleet->handle.debug_print("mcp9600: read device id failed.\n");                   /* read device id failed */
+            
+            return 1;                                                                         /* return error */
+        }
+        if (buf[0] != 0x40)                                                                   /* check id */
+        {
+            fleet->handle.debug_print("mcp9600: id is invalid.\n");                           /* id is invalid */
+            
+            return 1;                                                                         /* return error */
+        }
+    }
+    if (mcp9600_get_reg(&fleet->handle, MCP9600_FLEET_REG_DEVICE_CONFIGURATION, 
+                       (uint8_t *)&fleet->config[n], 1) != 0)                                 /* read config */
+    {
+        fleet->handle.debug_print("mcp9600: read device configuration failed.\n");            /* read device configuration failed */
+        if (n == 0)                                                                           /* no device holds the bus */
+        {
+            (void)mcp9600_deinit(&fleet->handle);                                             /* close the bus */
+        }
+        
+        return 1;                                                                             /* return error */
+    }
+    fleet->flag[n] = MCP9600_FLEET_FLAG_CONFIG;                                               /* config is valid */
+    fleet->status[n] = 0;                                                                     /* clear the status */
+    fleet->result[n] = 1;                                                                     /* no data yet */
+    fleet->alarm[n] = MCP9600_FLEET_ALARM_NONE;                                               /* clear the alarm */
+    fleet->hot_raw[n] = 0;                                                                    /* clear the data */
+    fleet->delta_raw[n] = 0;                                                                  /* clear the data */
+    fleet->cold_raw[n] = 0;                                                                   /* clear the data */
+    fleet->high_raw[n] = INT16_MAX;                                                           /* no high limit */
+    fleet->low_raw[n] = INT16_MIN;                                                            /* no low limit */
+    fleet->filter[n] = 0;                                                                     /* clear the filter */
+    fleet->num = (uint16_t)(n + 1);                                                           /* add the device */
+    *index = n;                                                                               /* save the index */
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      select one device on the shared handle
+ * @param[in]  *fleet pointer to an mcp9600 fleet structure
+ * @param[in]  index device index
+ * @param[out] **handle pointer to a handle pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 fleet is NULL
+ *             - 3 fleet is not initialized
+ *             - 4 index is invalid
+ * @note       any driver function can be called with the returned handle until the next fleet call,
+ *             the cached device configuration is reloaded by the next mcp9600_fleet_read
+ */
+uint8_t mcp9600_fleet_select(mcp9600_fleet_t *fleet, uint16_t index, mcp9600_handle_t **handle)
+{
+    if (fleet == NULL)                                                  /* check fleet */
+    {
+        return 2;                                                       /* return error */
+    }
+    if (fleet->inited != 1)                                             /* check fleet initialization */
+    {
+        return 3;                                                       /* return error */
+    }
+    if (index >= fleet->num)                                            /* check index */
+    {
+        fleet->handle.debug_print("mcp9600: index is invalid.\n");      /* index is invalid */
+        
+        return 4;                                                       /* return error */
+    }
+    
+    a_mcp9600_fleet_select(fleet, index);                               /* select the device */
+    fleet->flag[index] &= (uint8_t)(~MCP9600_FLEET_FLAG_CONFIG);        /* the config may change */
+    *handle = &fleet->handle;                                           /* return the handle */
+    
+    return 0;                                                           /* success return 0 */
+}
+
+/**
+ * @brief      read the raw temperatures and the status of all the devices
+ * @param[in]  *fleet pointer to an mcp9600 fleet structure
+ * @param[out] *failed pointer to a failed device number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 fleet is NULL
+ *             - 3 fleet is not initialized
+ * @note       each device costs one bus transfer with iic_read_batch linked, a failed device is
+ *             marked in result and keeps its previous data
+ */
+uint8_t mcp9600_fleet_read(mcp9600_fleet_t *fleet, uint16_t *failed)
+{
+    uint16_t i;
+    uint16_t n;
+    
+    if (fleet == NULL)                                                                           /* check fleet */
+    {
+        return 2;                                                                                /* return error */
+    }
+    if (fleet->inited != 1)                                                                      /* check fleet initialization */
+    {
+        return 3;                                                                                /* return error */
+    }
+    
+    n = 0;                                                                                       /* clear the failed number */
+    for (i = 0; i < fleet->num; i++)                                                             /* read all */
+    {
+        a_mcp9600_fleet_select(fleet, i);                                                        /* select the device */
+        if ((fleet->flag[i] & MCP9600_FLEET_FLAG_CONFIG) == 0)                                   /* check the cached config */
+        {
+            if (mcp9600_get_reg(&fleet->handle, MCP9600_FLEET_REG_DEVICE_CONFIGURATION, 
+                               (uint8_t *)&fleet->config[i], 1) != 0)                            /* reload config */
+            {
+                fleet->handle.debug_print("mcp9600: device %d read config failed.\n", i);        /* read config failed */
+                fleet->result[i] = 1;                                                            /* mark failed */
+                n++;                                                                             /* failed number++ */
+                
+                continue;                                                                        /* next device */
+            }
+            fleet->flag[i] |= MCP9600_FLEET_FLAG_CONFIG;                                         /* config is valid */
+        }
+        fleet->result[i] = mcp9600_fast_read_raw(&fleet->handle, &fleet->hot_raw[i], &fleet->delta_raw[i],
+                                                 &fleet->cold_raw[i], &fleet->status[i]);        /* read the data */
+        if (fleet->result[i] != 0)                                                               /* check result */
+        {
+            fleet->handle.debug_print("mcp9600: device %d fast read failed.\n", i);              /* fast read failed */
+            fleet->result[i] = 1;                                                                /* mark failed */
+            n++;                                                                                 /* failed number++ */
+        }
+    }
+    *failed = n;                                                                                 /* save the failed number */
+    
+    return (n != 0) ? 1 : 0;                                                                     /* return the result */
+}
+
+#if (MCP9600_FLOAT_API != 0)
+/**
+ * @brief      convert the last data of all the devices
+ * @param[in]  *fleet pointer to an mcp9600 fleet structure
+ * @param[out] *hot_s pointer to a converted hot temperature list
+ * @param[out] *delta_s pointer to a converted delta temperature list
+ * @param[out] *cold_s pointer to a converted cold temperature list
+ * @return     status code
+ *             - 0 success
+ *             - 1 list is NULL
+ *             - 2 fleet is NULL
+ *             - 3 fleet is not initialized
+ * @note       the lists have at least the device number members, the result is bit identical
+ *             to the single device getters
+ */
+uint8_t mcp9600_fleet_get_temperature(mcp9600_fleet_t *fleet, float *hot_s, float *delta_s, float *cold_s)
+{
+    uint16_t i;
+    
+    if (fleet == NULL)                                                                        /* check fleet */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (fleet->inited != 1)                                                                   /* check fleet initialization */
+    {
+        return 3;                                                                             /* return error */
+    }
+    if ((hot_s == NULL) || (delta_s == NULL) || (cold_s == NULL))                             /* check the lists */
+    {
+        fleet->handle.debug_print("mcp9600: list is null.\n");                                /* list is null */
+        
+        return 1;                                                                             /* return error */
+    }
+    
+    (void)mcp9600_convert_temperature(fleet->hot_raw, fleet->num, hot_s);                     /* convert the hot list */
+    (void)mcp9600_convert_temperature(fleet->delta_raw, fleet->num, delta_s);                 /* convert the delta list */
+    for (i = 0; i < fleet->num; i++)                                                          /* convert the cold list */
+    {
+        cold_s[i] = (float)fleet->cold_raw[i] * 
+                    ((((fleet->config[i] >> 7) & 0x01) != 0) ? 0.25f : 0.0625f);              /* per device resolution */
+    }
+    
+    return 0;                                                                                 /* success return 0 */
+}
+#endif
+
+/**
+ * @brief      convert the last data of all the devices in fixed point
+ * @param[in]  *fleet pointer to an mcp9600 fleet structure
+ * @param[out] *hot_mc pointer to a converted hot temperature list in mC
+ * @param[out] *delta_mc pointer to a converted delta temperature list in mC
+ * @param[out] *cold_mc pointer to a converted cold temperature list in mC
+ * @return     status code
+ *             - 0 success
+ *             - 1 list is NULL
+ *             - 2 fleet is NULL
+ *             - 3 fleet is not initialized
+ * @note       the lists have at least the device number members, the result is identical
+ *             to the single device fixed point getters
+ */
+uint8_t mcp9600_fleet_get_temperature_fixed(mcp9600_fleet_t *fleet, int32_t *hot_mc, int32_t *delta_mc, int32_t *cold_mc)
+{
+    uint16_t i;
+    int32_t m;
+    
+    if (fleet == NULL)                                                                        /* check fleet */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (fleet->inited != 1)                                                                   /* check fleet initialization */
+    {
+        return 3;                                                                             /* return error */
+    }
+    if ((hot_mc == NULL) || (delta_mc == NULL) || (cold_mc == NULL))                          /* check the lists */
+    {
+        fleet->handle.debug_print("mcp9600: list is null.\n");                                /* list is null */
+        
+        return 1;                                                                             /* return error */
+    }
+    
+    for (i = 0; i < fleet->num; i++)                                                          /* convert the hot list */
+    {
+        m = (int32_t)fleet->hot_raw[i] * 125;                                                 /* 2 times the result */
+        hot_mc[i] = (m + ((m < 0) ? -1 : 1)) / 2;                                             /* round away from zero */
+    }
+    for (i = 0; i < fleet->num; i++)                                                          /* convert the delta list */
+    {
+        m = (int32_t)fleet->delta_raw[i] * 125;                                               /* 2 times the result */
+        delta_mc[i] = (m + ((m < 0) ? -1 : 1)) / 2;                                           /* round away from zero */
+    }
+    for (i = 0; i < fleet->num; i++)                                                          /* convert the cold list */
+    {
+        m = (int32_t)fleet->cold_raw[i] * 125;                                                /* 2 times the result */
+        cold_mc[i] = (((fleet->config[i] >> 7) & 0x01) != 0) ? 
+                     (int32_t)fleet->cold_raw[i] * 250 : (m + ((m < 0) ? -1 : 1)) / 2;        /* per device resolution */
+    }
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief      run the hot temperature low pass filter of all the devices
+ * @param[in]  *fleet pointer to an mcp9600 fleet structure
+ * @param[in]  shift filter weight shift, the new sample weight is 1 / 2^shift
+ * @param[out] *hot_mc pointer to a filtered hot temperature list in mC, it can be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 2 fleet is NULL
+ *             - 3 fleet is not initialized
+ *             - 4 shift > 8
+ * @note       the filter of a device is seeded with its first good sample and holds its
+ *             value while the device read fails
+ */
+uint8_t mcp9600_fleet_filter(mcp9600_fleet_t *fleet, uint8_t shift, int32_t *hot_mc)
+{
+    uint16_t i;
+    int32_t x;
+    int32_t f;
+    int32_t m;
+    
+    if (fleet == NULL)                                                                        /* check fleet */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (fleet->inited != 1)                                                                   /* check fleet initialization */
+    {
+        return 3;                                                                             /* return error */
+    }
+    if (shift > 8)                                                                            /* check shift */
+    {
+        fleet->handle.debug_print("mcp9600: shift > 8.\n");                                   /* shift > 8 */
+        
+        return 4;                                                                             /* return error */
+    }
+    
+    for (i = 0; i < fleet->num; i++)                                                          /* filter all */
+    {
+        x = (int32_t)fleet->hot_raw[i] * 256;                                                 /* sample in 1/256 lsb */
+        f = fleet->filter[i];                                                                 /* last output */
+        f = ((fleet->flag[i] & MCP9600_FLEET_FLAG_FILTER) != 0) ? f + ((x - f) >> shift) : x; /* step or seed */
+        fleet->filter[i] = (fleet->result[i] == 0) ? f : fleet->filter[i];                    /* hold on failure */
+        fleet->flag[i] |= (fleet->result[i] == 0) ? MCP9600_FLEET_FLAG_FILTER : 0;            /* seeded */
+    }
+    if (hot_mc != NULL)                                                                       /* check the list */
+    {
+        for (i = 0; i < fleet->num; i++)                                                      /* convert all */
+        {
+            m = fleet->filter[i] * 125;                                                       /* 512 times the result */
+            hot_mc[i] = (m < 0) ? -((256 - m) / 512) : (m + 256) / 512;                       /* round half away from zero */
+        }
+    }
+    
+    return 0;                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     set the hot temperature alarm limits of one device
+ * @param[in] *fleet pointer to an mcp9600 fleet structure
+ * @param[in] index device index
+ * @param[in] low_mc low limit in mC
+ * @param[in] high_mc high limit in mC
+ * @return    status code
+ *            - 0 success
+ *            - 2 fleet is NULL
+ *            - 3 fleet is not initialized
+ *            - 4 index is invalid
+ *            - 5 low_mc > high_mc
+ * @note      an added device has no limit
+ */
+uint8_t mcp9600_fleet_set_limit(mcp9600_fleet_t *fleet, uint16_t index, int32_t low_mc, int32_t high_mc)
+{
+    if (fleet == NULL)                                                         /* check fleet */
+    {
+        return 2;                                                              /* return error */
+    }
+    if (fleet->inited != 1)                                                    /* check fleet initialization */
+    {
+        return 3;                                                              /* return error */
+    }
+    if (index >= fleet->num)                                                   /* check index */
+    {
+        fleet->handle.debug_print("mcp9600: index is invalid.\n");             /* index is invalid */
+        
+        return 4;                                                              /* return error */
+    }
+    if (low_mc > high_mc)                                                      /* check the limits */
+    {
+        fleet->handle.debug_print("mcp9600: low_mc > high_mc.\n");             /* low_mc > high_mc */
+        
+        return 5;                                                              /* return error */
+    }
+    
+    fleet->low_raw[index] = a_mcp9600_fleet_limit(low_mc, 1);                  /* alarm below the next step */
+    fleet->high_raw[index] = a_mcp9600_fleet_limit(high_mc, 0);                /* alarm above the previous step */
+    
+    return 0;                                                                  /* success return 0 */
+}
+
+/**
+ * @brief      evaluate the hot temperature alarms of all the devices
+ * @param[in]  *fleet pointer to an mcp9600 fleet structure
+ * @param[in]  filtered bool value, true to check the filtered temperature
+ * @param[out] *num pointer to an alarmed device number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 fleet is NULL
+ *             - 3 fleet is not initialized
+ * @note       the result of device i is stored in alarm[i] as mcp9600_fleet_alarm_t flags,
+ *             a device which failed its last read is only marked as failed
+ */
+uint8_t mcp9600_fleet_alarm(mcp9600_fleet_t *fleet, mcp9600_bool_t filtered, uint16_t *num)
+{
+    uint16_t i;
+    uint16_t n;
+    int32_t t;
+    uint8_t a;
+    
+    if (fleet == NULL)                                                                        /* check fleet */
+    {
+        return 2;                                                                             /* return error */
+    }
+    if (fleet->inited != 1)                                                                   /* check fleet initialization */
+    {
+        return 3;                                                                             /* return error */
+    }
+    
+    n = 0;                                                                                    /* clear the number */
+    for (i = 0; i < fleet->num; i++)                                                          /* check all */
+    {
+        t = (filtered == MCP9600_BOOL_TRUE) ? fleet->filter[i] : 
+                                              (int32_t)fleet->hot_raw[i] * 256;               /* temperature in 1/256 lsb */
+        a = (uint8_t)(((t > (int32_t)fleet->high_raw[i] * 256) ? MCP9600_FLEET_ALARM_HIGH : 0) |
+                      ((t < (int32_t)fleet->low_raw[i] * 256) ? MCP9600_FLEET_ALARM_LOW : 0));  /* compare the limits */
+        a = (fleet->result[i] == 0) ? a : MCP9600_FLEET_ALARM_FAILED;                         /* mask the failed device */
+        fleet->alarm[i] = a;                                                                  /* save the alarm */
+        n = (uint16_t)(n + ((a != 0) ? 1 : 0));                                               /* alarmed number++ */
+    }
+    *num = n;                                                                                 /* save the number */
+    
+    return 0;                                                                                 /* success return 0 */
+}
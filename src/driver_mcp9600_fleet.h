@@ -0,0 +1,285 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9600_fleet.h
+ * @brief     driver mcp9600 fleet header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MCP9600_FLEET_H
+#define DRIVER_MCP9600_FLEET_H
+
+#include "driver_mcp9600.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mcp9600_fleet_driver mcp9600 fleet driver function
+ * @brief    mcp9600 fleet driver modules
+ * @ingroup  mcp9600_driver
+ * @{
+ */
+
+/**
+ * @brief mcp9600 fleet max device number definition
+ */
+#ifndef MCP9600_FLEET_MAX_DEVICE
+    #define MCP9600_FLEET_MAX_DEVICE        64        /**< max 64 devices */
+#endif
+
+/**
+ * @brief mcp9600 fleet alarm enumeration definition
+ */
+typedef enum
+{
+    MCP9600_FLEET_ALARM_NONE   = 0x00,        /**< in range */
+    MCP9600_FLEET_ALARM_HIGH   = 0x01,        /**< above the high limit */
+    MCP9600_FLEET_ALARM_LOW    = 0x02,        /**< below the low limit */
+    MCP9600_FLEET_ALARM_FAILED = 0x04,        /**< last read failed */
+} mcp9600_fleet_alarm_t;
+
+/**
+ * @brief mcp9600 fleet structure definition
+ * @note  the transport functions are linked once in handle, the per device state is kept in
+ *        parallel lists so that a batch pass reads one contiguous list per field
+ */
+typedef struct mcp9600_fleet_s
+{
+    mcp9600_handle_t handle;                            /**< shared transport handle */
+    void *user[MCP9600_FLEET_MAX_DEVICE];               /**< device bus context list */
+    uint8_t addr[MCP9600_FLEET_MAX_DEVICE];             /**< device iic address list */
+    uint8_t config[MCP9600_FLEET_MAX_DEVICE];           /**< cached device configuration list */
+    uint8_t flag[MCP9600_FLEET_MAX_DEVICE];             /**< config valid and filter seeded flag list */
+    uint8_t status[MCP9600_FLEET_MAX_DEVICE];           /**< last status register list */
+    uint8_t result[MCP9600_FLEET_MAX_DEVICE];           /**< last read result list */
+    uint8_t alarm[MCP9600_FLEET_MAX_DEVICE];            /**< last alarm list */
+    int16_t hot_raw[MCP9600_FLEET_MAX_DEVICE];          /**< raw hot temperature list */
+    int16_t delta_raw[MCP9600_FLEET_MAX_DEVICE];        /**< raw delta temperature list */
+    int16_t cold_raw[MCP9600_FLEET_MAX_DEVICE];         /**< raw cold temperature list */
+    int16_t high_raw[MCP9600_FLEET_MAX_DEVICE];         /**< raw high limit list */
+    int16_t low_raw[MCP9600_FLEET_MAX_DEVICE];          /**< raw low limit list */
+    int32_t filter[MCP9600_FLEET_MAX_DEVICE];           /**< filtered raw hot temperature list in 1/256 lsb */
+    uint16_t num;                                       /**< device number */
+    uint16_t current;                                   /**< selected device index */
+    uint8_t inited;                                     /**< inited flag */
+} mcp9600_fleet_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup mcp9600_fleet_link_driver mcp9600 fleet link driver function
+ * @brief    mcp9600 fleet link driver modules
+ * @ingroup  mcp9600_fleet_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize mcp9600_fleet_t structure
+ * @param[in] FLEET pointer to an mcp9600 fleet structure
+ * @param[in] STRUCTURE mcp9600_fleet_t
+ * @note      the transport functions are then linked to &(FLEET)->handle with the
+ *            DRIVER_MCP9600_LINK_* macros, the handle user is set per device
+ */
+#define DRIVER_MCP9600_FLEET_LINK_INIT(FLEET, STRUCTURE)        memset(FLEET, 0, sizeof(STRUCTURE))
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup mcp9600_fleet_base_driver mcp9600 fleet base driver function
+ * @brief    mcp9600 fleet base driver modules
+ * @ingroup  mcp9600_fleet_driver
+ * @{
+ */
+
+/**
+ * @brief     initialize an empty fleet
+ * @param[in] *fleet pointer to an mcp9600 fleet structure
+ * @return    status code
+ *            - 0 success
+ *            - 2 fleet is NULL
+ *            - 3 linked functions is NULL
+ * @note      the register cache of the shared handle is disabled, the bus is opened by
+ *            the first mcp9600_fleet_add
+ */
+uint8_t mcp9600_fleet_init(mcp9600_fleet_t *fleet);
+
+/**
+ * @brief     shut down all the devices and close the bus
+ * @param[in] *fleet pointer to an mcp9600 fleet structure
+ * @return    status code
+ *            - 0 success
+ *            - 1 deinit failed
+ *            - 2 fleet is NULL
+ *            - 3 fleet is not initialized
+ * @note      every device is shut down even if one of them fails
+ */
+uint8_t mcp9600_fleet_deinit(mcp9600_fleet_t *fleet);
+
+/**
+ * @brief      add one device to a fleet
+ * @param[in]  *fleet pointer to an mcp9600 fleet structure
+ * @param[in]  addr_pin iic address pin of the device
+ * @param[in]  *user device bus context passed to the transport functions
+ * @param[out] *index pointer to a device index buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 add failed
+ *             - 2 fleet is NULL
+ *             - 3 fleet is not initialized
+ *             - 4 fleet is full
+ * @note       the bus is opened with the user of the first device, the later devices only
+ *             select their channel through user, for example a mux port
+ */
+uint8_t mcp9600_fleet_add(mcp9600_fleet_t *fleet, mcp9600_address_t addr_pin, void *user, uint16_t *index);
+
+/**
+ * @brief      select one device on the shared handle
+ * @param[in]  *fleet pointer to an mcp9600 fleet structure
+ * @param[in]  index device index
+ * @param[out] **handle pointer to a handle pointer buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 fleet is NULL
+ *             - 3 fleet is not initialized
+ *             - 4 index is invalid
+ * @note       any driver function can be called with the returned handle until the next fleet call,
+ *             the cached device configuration is reloaded by the next mcp9600_fleet_read
+ */
+uint8_t mcp9600_fleet_select(mcp9600_fleet_t *fleet, uint16_t index, mcp9600_handle_t **handle);
+
+/**
+ * @brief      read the raw temperatures and the status of all the devices
+ * @param[in]  *fleet pointer to an mcp9600 fleet structure
+ * @param[out] *failed pointer to a failed device number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ *             - 2 fleet is NULL
+ *             - 3 fleet is not initialized
+ * @note       each device costs one bus transfer with iic_read_batch linked, a failed device is
+ *             marked in result and keeps its previous data
+ */
+uint8_t mcp9600_fleet_read(mcp9600_fleet_t *fleet, uint16_t *failed);
+
+#if (MCP9600_FLOAT_API != 0)
+/**
+ * @brief      convert the last data of all the devices
+ * @param[in]  *fleet pointer to an mcp9600 fleet structure
+ * @param[out] *hot_s pointer to a converted hot temperature list
+ * @param[out] *delta_s pointer to a converted delta temperature list
+ * @param[out] *cold_s pointer to a converted cold temperature list
+ * @return     status code
+ *             - 0 success
+ *             - 1 list is NULL
+ *             - 2 fleet is NULL
+ *             - 3 fleet is not initialized
+ * @note       the lists have at least the device number members, the result is bit identical
+ *             to the single device getters
+ */
+uint8_t mcp9600_fleet_get_temperature(mcp9600_fleet_t *fleet, float *hot_s, float *delta_s, float *cold_s);
+#endif
+
+/**
+ * @brief      convert the last data of all the devices in fixed point
+ * @param[in]  *fleet pointer to an mcp9600 fleet structure
+ * @param[out] *hot_mc pointer to a converted hot temperature list in mC
+ * @param[out] *delta_mc pointer to a converted delta temperature list in mC
+ * @param[out] *cold_mc pointer to a converted cold temperature list in mC
+ * @return     status code
+ *             - 0 success
+ *             - 1 list is NULL
+ *             - 2 fleet is NULL
+ *             - 3 fleet is not initialized
+ * @note       the lists have at least the device number members, the result is identical
+ *             to the single device fixed point getters
+ */
+uint8_t mcp9600_fleet_get_temperature_fixed(mcp9600_fleet_t *fleet, int32_t *hot_mc, int32_t *delta_mc, int32_t *cold_mc);
+
+/**
+ * @brief      run the hot temperature low pass filter of all the devices
+ * @param[in]  *fleet pointer to an mcp9600 fleet structure
+ * @param[in]  shift filter weight shift, the new sample weight is 1 / 2^shift
+ * @param[out] *hot_mc pointer to a filtered hot temperature list in mC, it can be NULL
+ * @return     status code
+ *             - 0 success
+ *             - 2 fleet is NULL
+ *             - 3 fleet is not initialized
+ *             - 4 shift > 8
+ * @note       the filter of a device is seeded with its first good sample and holds its
+ *             value while the device read fails
+ */
+uint8_t mcp9600_fleet_filter(mcp9600_fleet_t *fleet, uint8_t shift, int32_t *hot_mc);
+
+/**
+ * @brief     set the hot temperature alarm limits of one device
+ * @param[in] *fleet pointer to an mcp9600 fleet structure
+ * @param[in] index device index
+ * @param[in] low_mc low limit in mC
+ * @param[in] high_mc high limit in mC
+ * @return    status code
+ *            - 0 success
+ *            - 2 fleet is NULL
+ *            - 3 fleet is not initialized
+ *            - 4 index is invalid
+ *            - 5 low_mc > high_mc
+ * @note      an added device has no limit
+ */
+uint8_t mcp9600_fleet_set_limit(mcp9600_fleet_t *fleet, uint16_t index, int32_t low_mc, int32_t high_mc);
+
+/**
+ * @brief      evaluate the hot temperature alarms of all the devices
+ * @param[in]  *fleet pointer to an mcp9600 fleet structure
+ * @param[in]  filtered bool value, true to check the filtered temperature
+ * @param[out] *num pointer to an alarmed device number buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 fleet is NULL
+ *             - 3 fleet is not initialized
+ * @note       the result of device i is stored in alarm[i] as mcp9600_fleet_alarm_t flags,
+ *             a device which failed its last read is only marked as failed
+ */
+uint8_t mcp9600_fleet_alarm(mcp9600_fleet_t *fleet, mcp9600_bool_t filtered, uint16_t *num);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
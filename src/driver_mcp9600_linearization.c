@@ -0,0 +1,564 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9600_linearization.c
+ * @brief     driver mcp9600 linearization source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9600_linearization.h"
+#include <math.h>
+
+/**
+ * @brief linearization coefficient max number definition
+ */
+#define MCP9600_LINEARIZATION_COEFFICIENT_MAX        15        /**< max 15 coefficients */
+
+/**
+ * @brief linearization range structure definition
+ * @note  the outer bounds of the inverse ranges are rounded out to hold the emf of the nist range ends
+ */
+typedef struct mcp9600_linearization_range_s
+{
+    double min;                                                    /**< range lower bound */
+    double max;                                                    /**< range upper bound */
+    uint8_t num;                                                   /**< coefficient number */
+    double c[MCP9600_LINEARIZATION_COEFFICIENT_MAX];               /**< coefficients from the lowest order */
+} mcp9600_linearization_range_t;
+
+/**
+ * @brief linearization type structure definition
+ */
+typedef struct mcp9600_linearization_type_s
+{
+    const mcp9600_linearization_range_t *emf;                      /**< reference polynomial ranges */
+    uint8_t emf_num;                                               /**< reference polynomial range number */
+    const mcp9600_linearization_range_t *temperature;              /**< inverse polynomial ranges */
+    uint8_t temperature_num;                                       /**< inverse polynomial range number */
+} mcp9600_linearization_type_t;
+
+/**
+ * @brief type k reference polynomial from C to mV
+ */
+static const mcp9600_linearization_range_t gsc_mcp9600_k_emf[] =
+{
+    {-270.0, 0.0, 11,
+     { 0.0000000000E+00,  3.9450128025E-02,  2.3622373598E-05,
+      -3.2858906784E-07, -4.9904828777E-09, -6.7509059173E-11,
+      -5.7410327428E-13, -3.1088872894E-15, -1.0451609365E-17,
+      -1.9889266878E-20, -1.6322697486E-23}},
+    {0.0, 1372.0, 10,
+     {-1.7600413686E-02,  3.8921204975E-02,  1.8558770032E-05,
+      -9.9457592874E-08,  3.1840945719E-10, -5.6072844889E-13,
+       5.6075059059E-16, -3.2020720003E-19,  9.7151147152E-23,
+      -1.2104721275E-26}}
+};
+
+/**
+ * @brief type k inverse polynomial from mV to C
+ */
+static const mcp9600_linearization_range_t gsc_mcp9600_k_temperature[] =
+{
+    {-5.892, 0.0, 9,
+     { 0.0000000E+00,  2.5173462E+01, -1.1662878E+00,
+      -1.0833638E+00, -8.9773540E-01, -3.7342377E-01,
+      -8.6632643E-02, -1.0450598E-02, -5.1920577E-04}},
+    {0.0, 20.644, 10,
+     { 0.000000E+00,  2.508355E+01,  7.860106E-02,
+      -2.503131E-01,  8.315270E-02, -1.228034E-02,
+       9.804036E-04, -4.413030E-05,  1.057734E-06,
+      -1.052755E-08}},
+    {20.644, 54.887, 7,
+     {-1.318058E+02,  4.830222E+01, -1.646031E+00,
+       5.464731E-02, -9.650715E-04,  8.802193E-06,
+      -3.110810E-08}}
+};
+
+/**
+ * @brief type j reference polynomial from C to mV
+ */
+static const mcp9600_linearization_range_t gsc_mcp9600_j_emf[] =
+{
+    {-210.0, 760.0, 9,
+     { 0.0000000000E+00,  5.0381187815E-02,  3.0475836930E-05,
+      -8.5681065720E-08,  1.3228195295E-10, -1.7052958337E-13,
+       2.0948090697E-16, -1.2538395336E-19,  1.5631725697E-23}},
+    {760.0, 1200.0, 6,
+     { 2.9645625681E+02, -1.4976127786E+00,  3.1787103924E-03,
+      -3.1847686701E-06,  1.5720819004E-09, -3.0691369056E-13}}
+};
+
+/**
+ * @brief type j inverse polynomial from mV to C
+ */
+static const mcp9600_linearization_range_t gsc_mcp9600_j_temperature[] =
+{
+    {-8.096, 0.0, 9,
+     { 0.0000000E+00,  1.9528268E+01, -1.2286185E+00,
+      -1.0752178E+00, -5.9086933E-01, -1.7256713E-01,
+      -2.8131513E-02, -2.3963370E-03, -8.3823321E-05}},
+    {0.0, 42.919, 8,
+     { 0.000000E+00,  1.978425E+01, -2.001204E-01,
+       1.036969E-02, -2.549687E-04,  3.585153E-06,
+      -5.344285E-08,  5.099890E-10}},
+    {42.919, 69.554, 6,
+     {-3.11358187E+03,  3.00543684E+02, -9.94773230E+00,
+       1.70276630E-01, -1.43033468E-03,  4.73886084E-06}}
+};
+
+/**
+ * @brief type t reference polynomial from C to mV
+ */
+static const mcp9600_linearization_range_t gsc_mcp9600_t_emf[] =
+{
+    {-270.0, 0.0, 15,
+     { 0.0000000000E+00,  3.8748106364E-02,  4.4194434347E-05,
+       1.1844323105E-07,  2.0032973554E-08,  9.0138019559E-10,
+       2.2651156593E-11,  3.6071154205E-13,  3.8493939883E-15,
+       2.8213521925E-17,  1.4251594779E-19,  4.8768662286E-22,
+       1.0795539270E-24,  1.3945027062E-27,  7.9795153927E-31}},
+    {0.0, 400.0, 9,
+     { 0.0000000000E+00,  3.8748106364E-02,  3.3292227880E-05,
+       2.0618243404E-07, -2.1882256846E-09,  1.0996880928E-11,
+      -3.0815758772E-14,  4.5479135290E-17, -2.7512901673E-20}}
+};
+
+/**
+ * @brief type t inverse polynomial from mV to C
+ */
+static const mcp9600_linearization_range_t gsc_mcp9600_t_temperature[] =
+{
+    {-5.603, 0.0, 8,
+     { 0.0000000E+00,  2.5949192E+01, -2.1316967E-01,
+       7.9018692E-01,  4.2527777E-01,  1.3304473E-01,
+       2.0241446E-02,  1.2668171E-03}},
+    {0.0, 20.872, 7,
+     { 0.000000E+00,  2.592800E+01, -7.602961E-01,
+       4.637791E-02, -2.165394E-03,  6.048144E-05,
+      -7.293422E-07}}
+};
+
+/**
+ * @brief type n reference polynomial from C to mV
+ */
+static const mcp9600_linearization_range_t gsc_mcp9600_n_emf[] =
+{
+    {-270.0, 0.0, 9,
+     { 0.0000000000E+00,  2.6159105962E-02,  1.0957484228E-05,
+      -9.3841111554E-08, -4.6412039759E-11, -2.6303357716E-12,
+      -2.2653438003E-14, -7.6089300791E-17, -9.3419667835E-20}},
+    {0.0, 1300.0, 11,
+     { 0.0000000000E+00,  2.5929394601E-02,  1.5710141880E-05,
+       4.3825627237E-08, -2.5261169794E-10,  6.4311819339E-13,
+      -1.0063471519E-15,  9.9745338992E-19, -6.0863245607E-22,
+       2.0849229339E-25, -3.0682196151E-29}}
+};
+
+/**
+ * @brief type n inverse polynomial from mV to C
+ */
+static const mcp9600_linearization_range_t gsc_mcp9600_n_temperature[] =
+{
+    {-3.991, 0.0, 10,
+     { 0.0000000E+00,  3.8436847E+01,  1.1010485E+00,
+       5.2229312E+00,  7.2060525E+00,  5.8488586E+00,
+       2.7754916E+00,  7.7075166E-01,  1.1582665E-01,
+       7.3138868E-03}},
+    {0.0, 20.613, 8,
+     { 0.00000E+00,  3.86896E+01, -1.08267E+00,
+       4.70205E-02, -2.12169E-06, -1.17272E-04,
+       5.39280E-06, -7.98156E-08}},
+    {20.613, 47.513, 6,
+     { 1.972485E+01,  3.300943E+01, -3.915159E-01,
+       9.855391E-03, -1.274371E-04,  7.767022E-07}}
+};
+
+/**
+ * @brief type s reference polynomial from C to mV
+ */
+static const mcp9600_linearization_range_t gsc_mcp9600_s_emf[] =
+{
+    {-50.0, 1064.18, 9,
+     { 0.00000000000E+00,  5.40313308631E-03,  1.25934289740E-05,
+      -2.32477968689E-08,  3.22028823036E-11, -3.31465196389E-14,
+       2.55744251786E-17, -1.25068871393E-20,  2.71443176145E-24}},
+    {1064.18, 1664.5, 5,
+     { 1.32900444085E+00,  3.34509311344E-03,  6.54805192818E-06,
+      -1.64856259209E-09,  1.29989605174E-14}},
+    {1664.5, 1768.1, 5,
+     { 1.46628232636E+02, -2.58430516752E-01,  1.63693574641E-04,
+      -3.30439046987E-08, -9.43223690612E-15}}
+};
+
+/**
+ * @brief type s inverse polynomial from mV to C
+ */
+static const mcp9600_linearization_range_t gsc_mcp9600_s_temperature[] =
+{
+    {-0.236, 1.874, 10,
+     { 0.00000000E+00,  1.84949460E+02, -8.00504062E+01,
+       1.02237430E+02, -1.52248592E+02,  1.88821343E+02,
+      -1.59085941E+02,  8.23027880E+01, -2.34181944E+01,
+       2.79786260E+00}},
+    {1.874, 11.95, 10,
+     { 1.291507177E+01,  1.466298863E+02, -1.534713402E+01,
+       3.145945973E+00, -4.163257839E-01,  3.187963771E-02,
+      -1.291637500E-03,  2.183475087E-05, -1.447379511E-07,
+       8.211272125E-09}},
+    {11.95, 17.536, 6,
+     {-8.087801117E+01,  1.621573104E+02, -8.536869453E+00,
+       4.719686976E-01, -1.441693666E-02,  2.081618890E-04}},
+    {17.536, 18.694, 5,
+     { 5.333875126E+04, -1.235892298E+04,  1.092657613E+03,
+      -4.265693686E+01,  6.247205420E-01}}
+};
+
+/**
+ * @brief type e reference polynomial from C to mV
+ */
+static const mcp9600_linearization_range_t gsc_mcp9600_e_emf[] =
+{
+    {-270.0, 0.0, 14,
+     { 0.0000000000E+00,  5.8665508708E-02,  4.5410977124E-05,
+      -7.7998048686E-07, -2.5800160843E-08, -5.9452583057E-10,
+      -9.3214058667E-12, -1.0287605534E-13, -8.0370123621E-16,
+      -4.3979497391E-18, -1.6414776355E-20, -3.9673619516E-23,
+      -5.5827328721E-26, -3.4657842013E-29}},
+    {0.0, 1000.0, 11,
+     { 0.0000000000E+00,  5.8665508710E-02,  4.5032275582E-05,
+       2.8908407212E-08, -3.3056896652E-10,  6.5024403270E-13,
+      -1.9197495504E-16, -1.2536600497E-18,  2.1489217569E-21,
+      -1.4388041782E-24,  3.5960899481E-28}}
+};
+
+/**
+ * @brief type e inverse polynomial from mV to C
+ */
+static const mcp9600_linearization_range_t gsc_mcp9600_e_temperature[] =
+{
+    {-8.825, 0.0, 9,
+     { 0.0000000E+00,  1.6977288E+01, -4.3514970E-01,
+      -1.5859697E-01, -9.2502871E-02, -2.6084314E-02,
+      -4.1360199E-03, -3.4034030E-04, -1.1564890E-05}},
+    {0.0, 76.373, 10,
+     { 0.0000000E+00,  1.7057035E+01, -2.3301759E-01,
+       6.5435585E-03, -7.3562749E-05, -1.7896001E-06,
+       8.4036165E-08, -1.3735879E-09,  1.0629823E-11,
+      -3.2447087E-14}}
+};
+
+/**
+ * @brief type b reference polynomial from C to mV
+ */
+static const mcp9600_linearization_range_t gsc_mcp9600_b_emf[] =
+{
+    {0.0, 630.615, 7,
+     { 0.0000000000E+00, -2.4650818346E-04,  5.9040421171E-06,
+      -1.3257931636E-09,  1.5668291901E-12, -1.6944529240E-15,
+       6.2990347094E-19}},
+    {630.615, 1820.0, 9,
+     {-3.8938168621E+00,  2.8571747470E-02, -8.4885104785E-05,
+       1.5785280164E-07, -1.6835344864E-10,  1.1109794013E-13,
+      -4.4515431033E-17,  9.8975640821E-21, -9.3791330289E-25}}
+};
+
+/**
+ * @brief type b inverse polynomial from mV to C
+ */
+static const mcp9600_linearization_range_t gsc_mcp9600_b_temperature[] =
+{
+    {0.291, 2.431, 9,
+     { 9.8423321E+01,  6.9971500E+02, -8.4765304E+02,
+       1.0052644E+03, -8.3345952E+02,  4.5508542E+02,
+      -1.5523037E+02,  2.9886750E+01, -2.4742860E+00}},
+    {2.431, 13.821, 9,
+     { 2.1315071E+02,  2.8510504E+02, -5.2742887E+01,
+       9.9160804E+00, -1.2965303E+00,  1.1195870E-01,
+      -6.0625199E-03,  1.8661696E-04, -2.4878585E-06}}
+};
+
+/**
+ * @brief type r reference polynomial from C to mV
+ */
+static const mcp9600_linearization_range_t gsc_mcp9600_r_emf[] =
+{
+    {-50.0, 1064.18, 10,
+     { 0.00000000000E+00,  5.28961729765E-03,  1.39166589782E-05,
+      -2.38855693017E-08,  3.56916001063E-11, -4.62347666298E-14,
+       5.00777441034E-17, -3.73105886191E-20,  1.57716482367E-23,
+      -2.81038625251E-27}},
+    {1064.18, 1664.5, 6,
+     { 2.95157925316E+00, -2.52061251332E-03,  1.59564501865E-05,
+      -7.64085947576E-09,  2.05305291024E-12, -2.93359668173E-16}},
+    {1664.5, 1768.1, 5,
+     { 1.52232118209E+02, -2.68819888545E-01,  1.71280280471E-04,
+      -3.45895706453E-08, -9.34633971046E-15}}
+};
+
+/**
+ * @brief type r inverse polynomial from mV to C
+ */
+static const mcp9600_linearization_range_t gsc_mcp9600_r_temperature[] =
+{
+    {-0.227, 1.923, 11,
+     { 0.0000000E+00,  1.8891380E+02, -9.3835290E+01,
+       1.3068619E+02, -2.2703580E+02,  3.5145659E+02,
+      -3.8953900E+02,  2.8239471E+02, -1.2607281E+02,
+       3.1353611E+01, -3.3187769E+00}},
+    {1.923, 13.228, 10,
+     { 1.334584505E+01,  1.472644573E+02, -1.844024844E+01,
+       4.031129726E+00, -6.249428360E-01,  6.468412046E-02,
+      -4.458750426E-03,  1.994710149E-04, -5.313401790E-06,
+       6.481976217E-08}},
+    {13.228, 19.739, 6,
+     {-8.199599416E+01,  1.553962042E+02, -8.342197663E+00,
+       4.279433549E-01, -1.191577910E-02,  1.492290091E-04}},
+    {19.739, 21.103, 5,
+     { 3.406177836E+04, -7.023729171E+03,  5.582903813E+02,
+      -1.952394635E+01,  2.560740231E-01}}
+};
+
+/**
+ * @brief linearization type table, in the order of mcp9600_thermocouple_type_t
+ */
+static const mcp9600_linearization_type_t gsc_mcp9600_linearization[8] =
+{
+    {gsc_mcp9600_k_emf, 2, gsc_mcp9600_k_temperature, 3},
+    {gsc_mcp9600_j_emf, 2, gsc_mcp9600_j_temperature, 3},
+    {gsc_mcp9600_t_emf, 2, gsc_mcp9600_t_temperature, 2},
+    {gsc_mcp9600_n_emf, 2, gsc_mcp9600_n_temperature, 3},
+    {gsc_mcp9600_s_emf, 3, gsc_mcp9600_s_temperature, 4},
+    {gsc_mcp9600_e_emf, 2, gsc_mcp9600_e_temperature, 2},
+    {gsc_mcp9600_b_emf, 2, gsc_mcp9600_b_temperature, 2},
+    {gsc_mcp9600_r_emf, 3, gsc_mcp9600_r_temperature, 4}
+};
+
+/**
+ * @brief type k reference exponential term definition
+ */
+#define MCP9600_LINEARIZATION_K_A0        1.185976E-01         /**< a0 */
+#define MCP9600_LINEARIZATION_K_A1        -1.183432E-04        /**< a1 */
+#define MCP9600_LINEARIZATION_K_A2        1.269686E+02         /**< a2 */
+
+/**
+ * @brief      evaluate a piecewise polynomial
+ * @param[in]  *range pointer to a range list
+ * @param[in]  num range number
+ * @param[in]  x input
+ * @param[out] *y pointer to an output buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 input is out of range
+ * @note       none
+ */
+static uint8_t a_mcp9600_linearization_eval(const mcp9600_linearization_range_t *range, uint8_t num, double x, double *y)
+{
+    uint8_t i;
+    int8_t j;
+    double r;
+    
+    for (i = 0; i < num; i++)                                        /* find the range */
+    {
+        if ((x >= range[i].min) && (x <= range[i].max))              /* check the range */
+        {
+            r = 0.0;                                                 /* init 0 */
+            for (j = (int8_t)(range[i].num - 1); j >= 0; j--)        /* horner */
+            {
+                r = r * x + range[i].c[j];                           /* next order */
+            }
+            *y = r;                                                  /* set output */
+            
+            return 0;                                                /* success return 0 */
+        }
+    }
+    
+    return 1;                                                        /* return error */
+}
+
+/**
+ * @brief      convert a temperature to the thermocouple emf in mV
+ * @param[in]  type thermocouple type
+ * @param[in]  c temperature in C
+ * @param[out] *mv pointer to an emf buffer in mV
+ * @return     status code
+ *             - 0 success
+ *             - 1 temperature is out of range
+ * @note       type is checked by the caller
+ */
+static uint8_t a_mcp9600_linearization_emf(uint8_t type, double c, double *mv)
+{
+    const mcp9600_linearization_type_t *t = &gsc_mcp9600_linearization[type];
+    
+    if (a_mcp9600_linearization_eval(t->emf, t->emf_num, c, mv) != 0)                            /* reference polynomial */
+    {
+        return 1;                                                                                 /* return error */
+    }
+    if ((type == MCP9600_THERMOCOUPLE_TYPE_K) && (c > 0.0))                                       /* type k above 0C */
+    {
+        *mv += MCP9600_LINEARIZATION_K_A0 * 
+               exp(MCP9600_LINEARIZATION_K_A1 * (c - MCP9600_LINEARIZATION_K_A2) * 
+                                                (c - MCP9600_LINEARIZATION_K_A2));                /* add the exponential term */
+    }
+    
+    return 0;                                                                                     /* success return 0 */
+}
+
+/**
+ * @brief      convert a temperature to the thermocouple emf
+ * @param[in]  type thermocouple type
+ * @param[in]  c temperature in C
+ * @param[out] *uv pointer to an emf buffer in uV
+ * @return     status code
+ *             - 0 success
+ *             - 1 temperature is out of the nist range or type is invalid
+ * @note       it uses the nist its-90 reference polynomials
+ */
+uint8_t mcp9600_linearization_emf(mcp9600_thermocouple_type_t type, double c, double *uv)
+{
+    double mv;
+    
+    if ((uint32_t)type > MCP9600_THERMOCOUPLE_TYPE_R)                  /* check type */
+    {
+        return 1;                                                     /* return error */
+    }
+    if (a_mcp9600_linearization_emf((uint8_t)type, c, &mv) != 0)      /* get emf */
+    {
+        return 1;                                                     /* return error */
+    }
+    *uv = mv * 1000.0;                                                /* convert to uV */
+    
+    return 0;                                                         /* success return 0 */
+}
+
+/**
+ * @brief      convert a thermocouple emf to the temperature
+ * @param[in]  type thermocouple type
+ * @param[in]  uv emf in uV
+ * @param[out] *c pointer to a temperature buffer in C
+ * @return     status code
+ *             - 0 success
+ *             - 1 emf is out of the nist range or type is invalid
+ * @note       it uses the nist its-90 inverse polynomials, the emf is referenced to 0C
+ */
+uint8_t mcp9600_linearization_temperature(mcp9600_thermocouple_type_t type, double uv, double *c)
+{
+    const mcp9600_linearization_type_t *t;
+    
+    if ((uint32_t)type > MCP9600_THERMOCOUPLE_TYPE_R)                                             /* check type */
+    {
+        return 1;                                                                                 /* return error */
+    }
+    t = &gsc_mcp9600_linearization[type];                                                        /* get table */
+    
+    return a_mcp9600_linearization_eval(t->temperature, t->temperature_num, uv / 1000.0, c);      /* inverse polynomial */
+}
+
+/**
+ * @brief      convert the raw adc emf to the hot junction temperature
+ * @param[in]  type thermocouple type
+ * @param[in]  uv emf in uV from mcp9600_get_raw_adc
+ * @param[in]  cold_c cold junction temperature in C from mcp9600_get_cold_junction_temperature
+ * @param[out] *hot_c pointer to a hot junction temperature buffer in C
+ * @return     status code
+ *             - 0 success
+ *             - 1 convert failed
+ * @note       the emf of the cold junction is added before the inverse polynomial
+ */
+uint8_t mcp9600_linearization_convert(mcp9600_thermocouple_type_t type, double uv, float cold_c, float *hot_c)
+{
+    double cold_uv;
+    double c;
+    
+    if (mcp9600_linearization_emf(type, (double)cold_c, &cold_uv) != 0)            /* get the cold junction emf */
+    {
+        return 1;                                                                  /* return error */
+    }
+    if (mcp9600_linearization_temperature(type, uv + cold_uv, &c) != 0)            /* get the hot junction */
+    {
+        return 1;                                                                  /* return error */
+    }
+    *hot_c = (float)c;                                                             /* set the temperature */
+    
+    return 0;                                                                      /* success return 0 */
+}
+
+/**
+ * @brief      convert a block of raw adc data to the hot junction temperature
+ * @param[in]  type thermocouple type
+ * @param[in]  resolution adc resolution of the raw data
+ * @param[in]  *raw pointer to a raw adc data buffer from mcp9600_get_raw_adc
+ * @param[in]  num data number
+ * @param[in]  cold_c cold junction temperature in C shared by the block
+ * @param[out] *hot_c pointer to a hot junction temperature buffer in C
+ * @return     status code
+ *             - 0 success
+ *             - 1 convert failed or some data is out of range
+ * @note       the cold junction emf is computed once for the block,
+ *             a sample out of the nist range is set to NAN and the others are still converted
+ */
+uint8_t mcp9600_linearization_convert_batch(mcp9600_thermocouple_type_t type, mcp9600_adc_resolution_t resolution,
+                                            const int32_t *raw, uint32_t num, float cold_c, float *hot_c)
+{
+    uint8_t res;
+    uint32_t i;
+    double lsb;
+    double cold_uv;
+    double c;
+    const mcp9600_linearization_type_t *t;
+    
+    if ((raw == NULL) || (hot_c == NULL))                                                       /* check buffer */
+    {
+        return 1;                                                                               /* return error */
+    }
+    if (mcp9600_linearization_emf(type, (double)cold_c, &cold_uv) != 0)                         /* get the cold junction emf once */
+    {
+        return 1;                                                                               /* return error */
+    }
+    
+    lsb = 2.0 * (double)(1 << ((uint32_t)resolution * 2));                                      /* 2, 8, 32 or 128 uV */
+    t = &gsc_mcp9600_linearization[type];                                                      /* get table */
+    res = 0;                                                                                    /* init 0 */
+    for (i = 0; i < num; i++)                                                                   /* convert all */
+    {
+        if (a_mcp9600_linearization_eval(t->temperature, t->temperature_num, 
+                                         ((double)raw[i] * lsb + cold_uv) / 1000.0, &c) != 0)   /* inverse polynomial */
+        {
+            hot_c[i] = NAN;                                                                     /* out of range */
+            res = 1;                                                                            /* set error */
+        }
+        else
+        {
+            hot_c[i] = (float)c;                                                                /* set the temperature */
+        }
+    }
+    
+    return res;                                                                                 /* return the result */
+}
@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9600_linearization.h
+ * @brief     driver mcp9600 linearization header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MCP9600_LINEARIZATION_H
+#define DRIVER_MCP9600_LINEARIZATION_H
+
+#include "driver_mcp9600.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mcp9600_linearization_driver mcp9600 linearization driver function
+ * @brief    mcp9600 linearization driver modules
+ * @ingroup  mcp9600_driver
+ * @{
+ */
+
+/**
+ * @brief      convert a temperature to the thermocouple emf
+ * @param[in]  type thermocouple type
+ * @param[in]  c temperature in C
+ * @param[out] *uv pointer to an emf buffer in uV
+ * @return     status code
+ *             - 0 success
+ *             - 1 temperature is out of the nist range or type is invalid
+ * @note       it uses the nist its-90 reference polynomials
+ */
+uint8_t mcp9600_linearization_emf(mcp9600_thermocouple_type_t type, double c, double *uv);
+
+/**
+ * @brief      convert a thermocouple emf to the temperature
+ * @param[in]  type thermocouple type
+ * @param[in]  uv emf in uV
+ * @param[out] *c pointer to a temperature buffer in C
+ * @return     status code
+ *             - 0 success
+ *             - 1 emf is out of the nist range or type is invalid
+ * @note       it uses the nist its-90 inverse polynomials, the emf is referenced to 0C
+ */
+uint8_t mcp9600_linearization_temperature(mcp9600_thermocouple_type_t type, double uv, double *c);
+
+/**
+ * @brief      convert the raw adc emf to the hot junction temperature
+ * @param[in]  type thermocouple type
+ * @param[in]  uv emf in uV from mcp9600_get_raw_adc
+ * @param[in]  cold_c cold junction temperature in C from mcp9600_get_cold_junction_temperature
+ * @param[out] *hot_c pointer to a hot junction temperature buffer in C
+ * @return     status code
+ *             - 0 success
+ *             - 1 convert failed
+ * @note       the emf of the cold junction is added before the inverse polynomial
+ */
+uint8_t mcp9600_linearization_convert(mcp9600_thermocouple_type_t type, double uv, float cold_c, float *hot_c);
+
+/**
+ * @brief      convert a block of raw adc data to the hot junction temperature
+ * @param[in]  type thermocouple type
+ * @param[in]  resolution adc resolution of the raw data
+ * @param[in]  *raw pointer to a raw adc data buffer from mcp9600_get_raw_adc
+ * @param[in]  num data number
+ * @param[in]  cold_c cold junction temperature in C shared by the block
+ * @param[out] *hot_c pointer to a hot junction temperature buffer in C
+ * @return     status code
+ *             - 0 success
+ *             - 1 convert failed or some data is out of range
+ * @note       the cold junction emf is computed once for the block,
+ *             a sample out of the nist range is set to NAN and the others are still converted
+ */
+uint8_t mcp9600_linearization_convert_batch(mcp9600_thermocouple_type_t type, mcp9600_adc_resolution_t resolution,
+                                            const int32_t *raw, uint32_t num, float cold_c, float *hot_c);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
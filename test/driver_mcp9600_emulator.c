@@ -0,0 +1,598 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9600_emulator.c
+ * @brief     driver mcp9600 emulator source file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#include "driver_mcp9600_emulator.h"
+
+/**
+ * @brief emulated chip information definition
+ */
+#define EMULATOR_DEVICE_ID              0x40        /**< device id */
+#define EMULATOR_DEVICE_REVISION        0x14        /**< device revision */
+
+/**
+ * @brief sample time of each adc resolution in ms
+ */
+static const uint32_t gsc_emulator_sample_ms[4] = {320, 80, 20, 5};
+
+/**
+ * @brief seebeck coefficient of each thermocouple type in uV/C
+ */
+static const float gsc_emulator_seebeck[8] = {41.0f, 52.0f, 43.0f, 27.0f, 6.0f, 61.0f, 1.0f, 6.0f};
+
+/**
+ * @brief     evaluate the alert comparators
+ * @param[in] *emulator pointer to an mcp9600 emulator structure
+ * @note      none
+ */
+static void a_emulator_alert_update(mcp9600_emulator_t *emulator)
+{
+    uint8_t i;
+    uint8_t cfg;
+    uint8_t cond;
+    uint8_t state;
+    float t;
+    float limit;
+    float hysteresis;
+    
+    for (i = 0; i < 4; i++)                                                                   /* all alerts */
+    {
+        cfg = emulator->alert_config[i];                                                      /* get config */
+        if ((cfg & 0x01) == 0)                                                                /* output disabled */
+        {
+            emulator->alert_condition[i] = 0;                                                 /* clear condition */
+            emulator->alert_latch[i] = 0;                                                     /* clear latch */
+            emulator->status &= ~(1 << i);                                                    /* clear status */
+            
+            continue;                                                                         /* next alert */
+        }
+        if ((cfg & 0x10) != 0)                                                                /* cold junction */
+        {
+            t = (emulator->device_config & 0x80) ? (float)emulator->cold / 4.0f :
+                                                   (float)emulator->cold / 16.0f;             /* cold temperature */
+        }
+        else
+        {
+            t = (float)emulator->hot / 16.0f;                                                 /* hot temperature */
+        }
+        limit = (float)((int16_t)emulator->alert_limit[i]) / 16.0f;                           /* get limit */
+        hysteresis = (float)emulator->alert_hysteresis[i];                                    /* get hysteresis */
+        cond = emulator->alert_condition[i];                                                  /* last condition */
+        if ((cfg & 0x08) != 0)                                                                /* rising */
+        {
+            if (t > limit)                                                                    /* over limit */
+            {
+                cond = 1;                                                                     /* assert */
+            }
+            else if (t < limit - hysteresis)                                                  /* under hysteresis */
+            {
+                cond = 0;                                                                     /* release */
+            }
+        }
+        else                                                                                  /* falling */
+        {
+            if (t < limit)                                                                    /* under limit */
+            {
+                cond = 1;                                                                     /* assert */
+            }
+            else if (t > limit + hysteresis)                                                  /* over hysteresis */
+            {
+                cond = 0;                                                                     /* release */
+            }
+        }
+        if ((cfg & 0x02) != 0)                                                                /* interrupt mode */
+        {
+            if ((cond != 0) && (emulator->alert_condition[i] == 0))                           /* new crossing */
+            {
+                emulator->alert_latch[i] = 1;                                                 /* latch */
+            }
+            state = emulator->alert_latch[i];                                                 /* latched state */
+        }
+        else                                                                                  /* comparator mode */
+        {
+            state = cond;                                                                     /* follow the condition */
+        }
+        emulator->alert_condition[i] = cond;                                                  /* save condition */
+        if (state != 0)                                                                       /* check state */
+        {
+            emulator->status |= (1 << i);                                                     /* set status */
+        }
+        else
+        {
+            emulator->status &= ~(1 << i);                                                    /* clear status */
+        }
+    }
+}
+
+/**
+ * @brief     run one conversion
+ * @param[in] *emulator pointer to an mcp9600 emulator structure
+ * @param[in] t conversion time in ms
+ * @note      the filter is modeled as an exponential average with weight 1 / 2^n
+ */
+static void a_emulator_convert(mcp9600_emulator_t *emulator, uint32_t t)
+{
+    uint8_t shift;
+    uint8_t filter;
+    float hot;
+    float uv;
+    int32_t code;
+    
+    hot = emulator->hot_input + emulator->ramp * (float)(t - emulator->ramp_start) / 1000.0f;     /* hot input */
+    filter = emulator->sensor_config & 0x07;                                                      /* get filter */
+    emulator->hot_filter += (hot - emulator->hot_filter) / (float)(1 << filter);                  /* filter */
+    emulator->hot = (int16_t)(emulator->hot_filter * 16.0f);                                      /* hot register */
+    if ((emulator->device_config & 0x80) != 0)                                                    /* 0.25C */
+    {
+        emulator->cold = (int16_t)(emulator->cold_input * 4.0f);                                  /* cold register */
+        emulator->delta = (int16_t)(emulator->hot - emulator->cold * 4);                          /* delta register */
+    }
+    else                                                                                          /* 0.0625C */
+    {
+        emulator->cold = (int16_t)(emulator->cold_input * 16.0f);                                 /* cold register */
+        emulator->delta = (int16_t)(emulator->hot - emulator->cold);                              /* delta register */
+    }
+    uv = gsc_emulator_seebeck[(emulator->sensor_config >> 4) & 0x07] * 
+         (hot - emulator->cold_input);                                                            /* thermocouple emf */
+    code = (int32_t)(uv / 2.0f);                                                                  /* 2uV lsb */
+    if ((code > 131071) || (code < -131072))                                                      /* check range */
+    {
+        code = (code > 0) ? 131071 : -131072;                                                     /* saturate */
+        emulator->status |= (1 << 4);                                                             /* range exceeds */
+    }
+    else
+    {
+        emulator->status &= ~(1 << 4);                                                            /* range within */
+    }
+    shift = (uint8_t)(((emulator->device_config >> 5) & 0x03) * 2);                               /* resolution shift */
+    emulator->adc = code & ~((int32_t)(1 << shift) - 1);                                          /* drop the low bits */
+    emulator->status |= (1 << 6);                                                                 /* temperature update */
+    a_emulator_alert_update(emulator);                                                            /* update alerts */
+}
+
+/**
+ * @brief     run all the conversions due
+ * @param[in] *emulator pointer to an mcp9600 emulator structure
+ * @note      none
+ */
+static void a_emulator_update(mcp9600_emulator_t *emulator)
+{
+    uint32_t period;
+    
+    period = gsc_emulator_sample_ms[(emulator->device_config >> 5) & 0x03];                 /* sample time */
+    if ((emulator->device_config & 0x03) == 0x00)                                           /* normal mode */
+    {
+        if ((int32_t)(emulator->now - emulator->next) > (int32_t)(period * 1000))           /* long idle */
+        {
+            emulator->next = emulator->now - period * 1000;                                 /* skip the old samples */
+        }
+        while ((int32_t)(emulator->now - emulator->next) >= 0)                              /* all due conversions */
+        {
+            a_emulator_convert(emulator, emulator->next);                                   /* convert */
+            emulator->next += period;                                                       /* next conversion */
+        }
+    }
+    else if (emulator->burst_active != 0)                                                   /* burst mode */
+    {
+        if ((int32_t)(emulator->now - emulator->burst_end) >= 0)                            /* burst complete */
+        {
+            a_emulator_convert(emulator, emulator->burst_end);                              /* convert */
+            emulator->status |= (1 << 7);                                                   /* burst complete */
+            emulator->device_config = (emulator->device_config & ~0x03) | 0x01;             /* back to shutdown */
+            emulator->burst_active = 0;                                                     /* stop burst */
+        }
+    }
+    else
+    {
+        
+    }
+}
+
+/**
+ * @brief     write one register
+ * @param[in] *emulator pointer to an mcp9600 emulator structure
+ * @param[in] reg register address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @note      read only registers ignore the write
+ */
+static void a_emulator_write(mcp9600_emulator_t *emulator, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t mode;
+    
+    if ((reg == 0x04) && (len >= 1))                                                        /* status */
+    {
+        emulator->status &= (buf[0] | 0x3F);                                                /* write 0 to clear the flags */
+    }
+    else if ((reg == 0x05) && (len >= 1))                                                   /* sensor config */
+    {
+        emulator->sensor_config = buf[0] & 0x77;                                            /* set config */
+    }
+    else if ((reg == 0x06) && (len >= 1))                                                   /* device config */
+    {
+        mode = buf[0] & 0x03;                                                               /* get mode */
+        if ((mode == 0x00) && ((emulator->device_config & 0x03) != 0x00))                   /* enter normal mode */
+        {
+            emulator->next = emulator->now + gsc_emulator_sample_ms[(buf[0] >> 5) & 0x03];  /* first conversion */
+        }
+        emulator->burst_active = 0;                                                         /* stop burst */
+        if (mode == 0x02)                                                                   /* burst mode */
+        {
+            emulator->burst_active = 1;                                                     /* start burst */
+            emulator->burst_end = emulator->now + 
+                                  (gsc_emulator_sample_ms[(buf[0] >> 5) & 0x03] << ((buf[0] >> 2) & 0x07));  /* burst time */
+        }
+        emulator->device_config = buf[0];                                                   /* set config */
+    }
+    else if ((reg >= 0x08) && (reg <= 0x0B) && (len >= 1))                                  /* alert config */
+    {
+        if ((buf[0] & 0x80) != 0)                                                           /* interrupt clear */
+        {
+            emulator->alert_latch[reg - 0x08] = 0;                                          /* clear latch */
+        }
+        emulator->alert_config[reg - 0x08] = buf[0] & 0x1F;                                 /* set config */
+        a_emulator_alert_update(emulator);                                                  /* update alerts */
+    }
+    else if ((reg >= 0x0C) && (reg <= 0x0F) && (len >= 1))                                  /* alert hysteresis */
+    {
+        emulator->alert_hysteresis[reg - 0x0C] = buf[0];                                    /* set hysteresis */
+    }
+    else if ((reg >= 0x10) && (reg <= 0x13) && (len >= 2))                                  /* alert limit */
+    {
+        emulator->alert_limit[reg - 0x10] = (uint16_t)(((uint16_t)buf[0] << 8) | buf[1]) & 0xFFFC;  /* set limit */
+    }
+    else
+    {
+        
+    }
+}
+
+/**
+ * @brief      read one register
+ * @param[in]  *emulator pointer to an mcp9600 emulator structure
+ * @param[in]  reg register address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @note       the bytes after the register are read as 0
+ */
+static void a_emulator_read(mcp9600_emulator_t *emulator, uint8_t reg, uint8_t *buf, uint16_t len)
+{
+    uint8_t image[3];
+    uint16_t i;
+    
+    memset(image, 0, sizeof(uint8_t) * 3);                                                  /* clear the image */
+    switch (reg)
+    {
+        case 0x00 :                                                                         /* hot junction */
+        case 0x01 :                                                                         /* delta */
+        case 0x02 :                                                                         /* cold junction */
+        {
+            int16_t v;
+            
+            v = (reg == 0x00) ? emulator->hot : ((reg == 0x01) ? emulator->delta : emulator->cold);
+            image[0] = (uint8_t)(((uint16_t)v >> 8) & 0xFF);                                /* msb */
+            image[1] = (uint8_t)((uint16_t)v & 0xFF);                                       /* lsb */
+            
+            break;
+        }
+        case 0x03 :                                                                         /* raw adc */
+        {
+            image[0] = (uint8_t)(((uint32_t)emulator->adc >> 16) & 0xFF);                   /* upper */
+            image[1] = (uint8_t)(((uint32_t)emulator->adc >> 8) & 0xFF);                    /* middle */
+            image[2] = (uint8_t)((uint32_t)emulator->adc & 0xFF);                           /* lower */
+            
+            break;
+        }
+        case 0x04 :                                                                         /* status */
+        {
+            image[0] = emulator->status;                                                    /* status */
+            
+            break;
+        }
+        case 0x05 :                                                                         /* sensor config */
+        {
+            image[0] = emulator->sensor_config;                                             /* sensor config */
+            
+            break;
+        }
+        case 0x06 :                                                                         /* device config */
+        {
+            image[0] = emulator->device_config;                                             /* device config */
+            
+            break;
+        }
+        case 0x08 :                                                                         /* alert config */
+        case 0x09 :
+        case 0x0A :
+        case 0x0B :
+        {
+            image[0] = emulator->alert_config[reg - 0x08];                                  /* alert config */
+            
+            break;
+        }
+        case 0x0C :                                                                         /* alert hysteresis */
+        case 0x0D :
+        case 0x0E :
+        case 0x0F :
+        {
+            image[0] = emulator->alert_hysteresis[reg - 0x0C];                              /* alert hysteresis */
+            
+            break;
+        }
+        case 0x10 :                                                                         /* alert limit */
+        case 0x11 :
+        case 0x12 :
+        case 0x13 :
+        {
+            image[0] = (uint8_t)(emulator->alert_limit[reg - 0x10] >> 8);                   /* msb */
+            image[1] = (uint8_t)(emulator->alert_limit[reg - 0x10] & 0xFF);                 /* lsb */
+            
+            break;
+        }
+        case 0x20 :                                                                         /* device id */
+        {
+            image[0] = EMULATOR_DEVICE_ID;                                                  /* id */
+            image[1] = EMULATOR_DEVICE_REVISION;                                            /* revision */
+            
+            break;
+        }
+        default :
+        {
+            break;
+        }
+    }
+    for (i = 0; i < len; i++)                                                               /* copy data */
+    {
+        buf[i] = (i < 3) ? image[i] : 0;                                                    /* set data */
+    }
+}
+
+/**
+ * @brief     reset the emulated chip to its power on state
+ * @param[in] *emulator pointer to an mcp9600 emulator structure
+ * @param[in] addr iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 2 emulator is NULL
+ * @note      the inputs are reset to 25C on both junctions without ramp
+ */
+uint8_t mcp9600_emulator_init(mcp9600_emulator_t *emulator, mcp9600_address_t addr)
+{
+    if (emulator == NULL)                                                 /* check emulator */
+    {
+        return 2;                                                         /* return error */
+    }
+    
+    memset(emulator, 0, sizeof(mcp9600_emulator_t));                     /* power on reset */
+    emulator->addr = (uint8_t)addr;                                       /* set address */
+    emulator->hot_input = 25.0f;                                          /* 25C */
+    emulator->cold_input = 25.0f;                                         /* 25C */
+    emulator->hot_filter = 25.0f;                                         /* 25C */
+    emulator->next = gsc_emulator_sample_ms[0];                           /* first conversion */
+    
+    return 0;                                                             /* success return 0 */
+}
+
+/**
+ * @brief     set the junction input temperatures
+ * @param[in] *emulator pointer to an mcp9600 emulator structure
+ * @param[in] hot hot junction temperature in C
+ * @param[in] cold cold junction temperature in C
+ * @return    status code
+ *            - 0 success
+ *            - 2 emulator is NULL
+ * @note      the new input is seen by the next conversion
+ */
+uint8_t mcp9600_emulator_set_temperature(mcp9600_emulator_t *emulator, float hot, float cold)
+{
+    if (emulator == NULL)                             /* check emulator */
+    {
+        return 2;                                     /* return error */
+    }
+    
+    emulator->hot_input = hot;                        /* set hot */
+    emulator->cold_input = cold;                      /* set cold */
+    emulator->ramp_start = emulator->now;             /* restart ramp */
+    
+    return 0;                                         /* success return 0 */
+}
+
+/**
+ * @brief     set the hot junction input ramp
+ * @param[in] *emulator pointer to an mcp9600 emulator structure
+ * @param[in] c_per_s ramp in C/s
+ * @return    status code
+ *            - 0 success
+ *            - 2 emulator is NULL
+ * @note      the ramp starts from the current hot junction input
+ */
+uint8_t mcp9600_emulator_set_ramp(mcp9600_emulator_t *emulator, float c_per_s)
+{
+    if (emulator == NULL)                                                                                     /* check emulator */
+    {
+        return 2;                                                                                             /* return error */
+    }
+    
+    emulator->hot_input += emulator->ramp * (float)(emulator->now - emulator->ramp_start) / 1000.0f;          /* current input */
+    emulator->ramp_start = emulator->now;                                                                     /* restart ramp */
+    emulator->ramp = c_per_s;                                                                                 /* set ramp */
+    
+    return 0;                                                                                                 /* success return 0 */
+}
+
+/**
+ * @brief     advance the emulated time
+ * @param[in] *emulator pointer to an mcp9600 emulator structure
+ * @param[in] ms time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 emulator is NULL
+ * @note      all the conversions due in the time are run
+ */
+uint8_t mcp9600_emulator_advance(mcp9600_emulator_t *emulator, uint32_t ms)
+{
+    if (emulator == NULL)                     /* check emulator */
+    {
+        return 2;                             /* return error */
+    }
+    
+    emulator->now += ms;                      /* advance time */
+    a_emulator_update(emulator);              /* run conversions */
+    
+    return 0;                                 /* success return 0 */
+}
+
+/**
+ * @brief      get the alert pin level
+ * @param[in]  *emulator pointer to an mcp9600 emulator structure
+ * @param[in]  alert alert index
+ * @param[out] *level pointer to a level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 emulator is NULL
+ * @note       a disabled output is reported at its inactive level
+ */
+uint8_t mcp9600_emulator_get_alert_pin(mcp9600_emulator_t *emulator, mcp9600_alert_t alert, uint8_t *level)
+{
+    uint8_t active;
+    uint8_t high;
+    
+    if (emulator == NULL)                                                        /* check emulator */
+    {
+        return 2;                                                                /* return error */
+    }
+    
+    active = (emulator->status >> alert) & 0x01;                                 /* get state */
+    high = (emulator->alert_config[alert] >> 2) & 0x01;                          /* get active level */
+    *level = (active != 0) ? high : (uint8_t)(!high);                            /* set level */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     emulated iic bus init
+ * @param[in] *user pointer to an mcp9600 emulator structure
+ * @return    status code
+ *            - 0 success
+ * @note      it can be linked as iic_init_ctx
+ */
+uint8_t mcp9600_emulator_iic_init(void *user)
+{
+    (void)user;                                                                  /* not used */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     emulated iic bus deinit
+ * @param[in] *user pointer to an mcp9600 emulator structure
+ * @return    status code
+ *            - 0 success
+ * @note      it can be linked as iic_deinit_ctx
+ */
+uint8_t mcp9600_emulator_iic_deinit(void *user)
+{
+    (void)user;                                                                  /* not used */
+    
+    return 0;                                                                    /* success return 0 */
+}
+
+/**
+ * @brief     emulated iic bus write command
+ * @param[in] *user pointer to an mcp9600 emulator structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the first byte sets the register pointer and the rest is written to the register,
+ *            it can be linked as iic_write_cmd_ctx
+ */
+uint8_t mcp9600_emulator_iic_write_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    mcp9600_emulator_t *emulator = (mcp9600_emulator_t *)user;
+    
+    if ((emulator == NULL) || (addr != emulator->addr) || (len == 0))        /* no ack */
+    {
+        return 1;                                                            /* return error */
+    }
+    
+    a_emulator_update(emulator);                                             /* run conversions */
+    emulator->pointer = buf[0];                                              /* set pointer */
+    if (len > 1)                                                             /* check data */
+    {
+        a_emulator_write(emulator, buf[0], buf + 1, len - 1);                /* write register */
+    }
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief      emulated iic bus read command
+ * @param[in]  *user pointer to an mcp9600 emulator structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it reads the register selected by the last write, it can be linked as iic_read_cmd_ctx
+ */
+uint8_t mcp9600_emulator_iic_read_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len)
+{
+    mcp9600_emulator_t *emulator = (mcp9600_emulator_t *)user;
+    
+    if ((emulator == NULL) || (addr != emulator->addr))                      /* no ack */
+    {
+        return 1;                                                            /* return error */
+    }
+    
+    a_emulator_update(emulator);                                             /* run conversions */
+    a_emulator_read(emulator, emulator->pointer, buf, len);                  /* read register */
+    
+    return 0;                                                                /* success return 0 */
+}
+
+/**
+ * @brief     emulated delay ms
+ * @param[in] *user pointer to an mcp9600 emulator structure
+ * @param[in] ms time
+ * @note      it advances the emulated time instead of sleeping, it can be linked as delay_ms_ctx
+ */
+void mcp9600_emulator_delay_ms(void *user, uint32_t ms)
+{
+    (void)mcp9600_emulator_advance((mcp9600_emulator_t *)user, ms);
+}
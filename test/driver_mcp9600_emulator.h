@@ -0,0 +1,212 @@
+/**
+ * Copyright (c) 2015 - present LibDriver All rights reserved
+ * 
+ * The MIT License (MIT)
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE. 
+ *
+ * @file      driver_mcp9600_emulator.h
+ * @brief     driver mcp9600 emulator header file
+ * @version   1.0.0
+ * @author    Shifeng Li
+ * @date      2026-10-17
+ *
+ * <h3>history</h3>
+ * <table>
+ * <tr><th>Date        <th>Version  <th>Author      <th>Description
+ * <tr><td>2026/10/17  <td>1.0      <td>Shifeng Li  <td>first upload
+ * </table>
+ */
+
+#ifndef DRIVER_MCP9600_EMULATOR_H
+#define DRIVER_MCP9600_EMULATOR_H
+
+#include "driver_mcp9600.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+/**
+ * @defgroup mcp9600_emulator_driver mcp9600 emulator driver function
+ * @brief    mcp9600 emulator driver modules
+ * @ingroup  mcp9600_driver
+ * @{
+ */
+
+/**
+ * @brief mcp9600 emulator structure definition
+ */
+typedef struct mcp9600_emulator_s
+{
+    uint8_t addr;                    /**< iic write address */
+    uint8_t pointer;                 /**< register pointer */
+    uint8_t status;                  /**< status register */
+    uint8_t sensor_config;           /**< thermocouple sensor configuration register */
+    uint8_t device_config;           /**< device configuration register */
+    uint8_t alert_config[4];         /**< alert configuration registers */
+    uint8_t alert_hysteresis[4];     /**< alert hysteresis registers */
+    uint16_t alert_limit[4];         /**< alert limit registers */
+    uint8_t alert_condition[4];      /**< alert comparator output */
+    uint8_t alert_latch[4];          /**< alert interrupt latch */
+    int16_t hot;                     /**< hot junction register */
+    int16_t delta;                   /**< delta register */
+    int16_t cold;                    /**< cold junction register */
+    int32_t adc;                     /**< raw adc register */
+    float hot_filter;                /**< filtered hot junction temperature */
+    float hot_input;                 /**< hot junction input temperature */
+    float cold_input;                /**< cold junction input temperature */
+    float ramp;                      /**< hot junction input ramp in C/s */
+    uint32_t ramp_start;             /**< ramp start time in ms */
+    uint32_t now;                    /**< emulated time in ms */
+    uint32_t next;                   /**< next normal mode conversion time in ms */
+    uint32_t burst_end;              /**< burst completion time in ms */
+    uint8_t burst_active;            /**< burst running flag */
+} mcp9600_emulator_t;
+
+/**
+ * @}
+ */
+
+/**
+ * @defgroup mcp9600_emulator_base_driver mcp9600 emulator base driver function
+ * @brief    mcp9600 emulator base driver modules
+ * @ingroup  mcp9600_emulator_driver
+ * @{
+ */
+
+/**
+ * @brief     reset the emulated chip to its power on state
+ * @param[in] *emulator pointer to an mcp9600 emulator structure
+ * @param[in] addr iic device address
+ * @return    status code
+ *            - 0 success
+ *            - 2 emulator is NULL
+ * @note      the inputs are reset to 25C on both junctions without ramp
+ */
+uint8_t mcp9600_emulator_init(mcp9600_emulator_t *emulator, mcp9600_address_t addr);
+
+/**
+ * @brief     set the junction input temperatures
+ * @param[in] *emulator pointer to an mcp9600 emulator structure
+ * @param[in] hot hot junction temperature in C
+ * @param[in] cold cold junction temperature in C
+ * @return    status code
+ *            - 0 success
+ *            - 2 emulator is NULL
+ * @note      the new input is seen by the next conversion
+ */
+uint8_t mcp9600_emulator_set_temperature(mcp9600_emulator_t *emulator, float hot, float cold);
+
+/**
+ * @brief     set the hot junction input ramp
+ * @param[in] *emulator pointer to an mcp9600 emulator structure
+ * @param[in] c_per_s ramp in C/s
+ * @return    status code
+ *            - 0 success
+ *            - 2 emulator is NULL
+ * @note      the ramp starts from the current hot junction input
+ */
+uint8_t mcp9600_emulator_set_ramp(mcp9600_emulator_t *emulator, float c_per_s);
+
+/**
+ * @brief     advance the emulated time
+ * @param[in] *emulator pointer to an mcp9600 emulator structure
+ * @param[in] ms time in ms
+ * @return    status code
+ *            - 0 success
+ *            - 2 emulator is NULL
+ * @note      all the conversions due in the time are run
+ */
+uint8_t mcp9600_emulator_advance(mcp9600_emulator_t *emulator, uint32_t ms);
+
+/**
+ * @brief      get the alert pin level
+ * @param[in]  *emulator pointer to an mcp9600 emulator structure
+ * @param[in]  alert alert index
+ * @param[out] *level pointer to a level buffer
+ * @return     status code
+ *             - 0 success
+ *             - 2 emulator is NULL
+ * @note       a disabled output is reported at its inactive level
+ */
+uint8_t mcp9600_emulator_get_alert_pin(mcp9600_emulator_t *emulator, mcp9600_alert_t alert, uint8_t *level);
+
+/**
+ * @brief     emulated iic bus init
+ * @param[in] *user pointer to an mcp9600 emulator structure
+ * @return    status code
+ *            - 0 success
+ * @note      it can be linked as iic_init_ctx
+ */
+uint8_t mcp9600_emulator_iic_init(void *user);
+
+/**
+ * @brief     emulated iic bus deinit
+ * @param[in] *user pointer to an mcp9600 emulator structure
+ * @return    status code
+ *            - 0 success
+ * @note      it can be linked as iic_deinit_ctx
+ */
+uint8_t mcp9600_emulator_iic_deinit(void *user);
+
+/**
+ * @brief     emulated iic bus write command
+ * @param[in] *user pointer to an mcp9600 emulator structure
+ * @param[in] addr iic device write address
+ * @param[in] *buf pointer to a data buffer
+ * @param[in] len length of data buffer
+ * @return    status code
+ *            - 0 success
+ *            - 1 write failed
+ * @note      the first byte sets the register pointer and the rest is written to the register,
+ *            it can be linked as iic_write_cmd_ctx
+ */
+uint8_t mcp9600_emulator_iic_write_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief      emulated iic bus read command
+ * @param[in]  *user pointer to an mcp9600 emulator structure
+ * @param[in]  addr iic device write address
+ * @param[out] *buf pointer to a data buffer
+ * @param[in]  len length of data buffer
+ * @return     status code
+ *             - 0 success
+ *             - 1 read failed
+ * @note       it reads the register selected by the last write, it can be linked as iic_read_cmd_ctx
+ */
+uint8_t mcp9600_emulator_iic_read_cmd(void *user, uint8_t addr, uint8_t *buf, uint16_t len);
+
+/**
+ * @brief     emulated delay ms
+ * @param[in] *user pointer to an mcp9600 emulator structure
+ * @param[in] ms time
+ * @note      it advances the emulated time instead of sleeping, it can be linked as delay_ms_ctx
+ */
+void mcp9600_emulator_delay_ms(void *user, uint32_t ms);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -35,6 +35,7 @@
  */
 
 #include "driver_mcp9600_read_test.h"
+#include "driver_mcp9600_linearization.h"
 
 static mcp9600_handle_t gs_handle;        /**< mcp9600 handle */
 
@@ -61,6 +62,8 @@ uint8_t mcp9600_read_test(mcp9600_address_t addr_pin, mcp9600_thermocouple_type_
     DRIVER_MCP9600_LINK_IIC_INIT(&gs_handle, mcp9600_interface_iic_init);
     DRIVER_MCP9600_LINK_IIC_DEINIT(&gs_handle, mcp9600_interface_iic_deinit);
     DRIVER_MCP9600_LINK_IIC_READ_COMMAND(&gs_handle, mcp9600_interface_iic_read_cmd);
+    DRIVER_MCP9600_LINK_IIC_READ(&gs_handle, mcp9600_interface_iic_read);
+    DRIVER_MCP9600_LINK_IIC_READ_BATCH(&gs_handle, mcp9600_interface_iic_read_batch);
     DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND(&gs_handle, mcp9600_interface_iic_write_cmd);
     DRIVER_MCP9600_LINK_IIC_DELAY_MS(&gs_handle, mcp9600_interface_delay_ms);
     DRIVER_MCP9600_LINK_DEBUG_PRINT(&gs_handle, mcp9600_interface_debug_print);
@@ -573,6 +576,69 @@ uint8_t mcp9600_read_test(mcp9600_address_t addr_pin, mcp9600_thermocouple_type_
         mcp9600_interface_delay_ms(1000);
     }
     
+    /* start fast read test */
+    mcp9600_interface_debug_print("mcp9600: start fast read test.\n");
+    
+    for (i = 0; i < times; i++)
+    {
+        int16_t hot_raw;
+        float hot_s;
+        int16_t delta_raw;
+        float delta_s;
+        int16_t cold_raw;
+        float cold_s;
+        uint8_t status;
+        
+        /* fast read */
+        res = mcp9600_fast_read(&gs_handle, (int16_t *)&hot_raw, (float *)&hot_s,
+                                (int16_t *)&delta_raw, (float *)&delta_s,
+                                (int16_t *)&cold_raw, (float *)&cold_s, (uint8_t *)&status);
+        if (res != 0)
+        {
+            mcp9600_interface_debug_print("mcp9600: fast read failed.\n");
+            (void)mcp9600_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* print */
+        mcp9600_interface_debug_print("mcp9600: hot %0.2f delta %0.2f cold %0.2f status 0x%02X.\n", hot_s, delta_s, cold_s, status);
+        
+        /* delay 1000 ms */
+        mcp9600_interface_delay_ms(1000);
+    }
+    
+    /* start fixed point read test */
+    mcp9600_interface_debug_print("mcp9600: start fixed point read test.\n");
+    
+    for (i = 0; i < times; i++)
+    {
+        int16_t hot_raw;
+        int32_t hot_mc;
+        int16_t delta_raw;
+        int32_t delta_mc;
+        int16_t cold_raw;
+        int32_t cold_mc;
+        
+        /* continuous read in fixed point */
+        res = mcp9600_continuous_read_fixed(&gs_handle, (int16_t *)&hot_raw, (int32_t *)&hot_mc,
+                                            (int16_t *)&delta_raw, (int32_t *)&delta_mc,
+                                            (int16_t *)&cold_raw, (int32_t *)&cold_mc);
+        if (res != 0)
+        {
+            mcp9600_interface_debug_print("mcp9600: continuous read fixed failed.\n");
+            (void)mcp9600_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* print */
+        mcp9600_interface_debug_print("mcp9600: hot %d mC delta %d mC cold %d mC.\n", (int)hot_mc, (int)delta_mc, (int)cold_mc);
+        
+        /* delay 1000 ms */
+        mcp9600_interface_delay_ms(1000);
+    }
+    
     /* stop continuous read */
     res = mcp9600_stop_continuous_read(&gs_handle);
     if (res != 0)
@@ -594,6 +660,7 @@ uint8_t mcp9600_read_test(mcp9600_address_t addr_pin, mcp9600_thermocouple_type_
         float delta_s;
         int16_t cold_raw;
         float cold_s;
+        uint32_t polls;
         
         /* single read */
         res = mcp9600_single_read(&gs_handle, (int16_t *)&hot_raw, (float *)&hot_s,
@@ -610,6 +677,92 @@ uint8_t mcp9600_read_test(mcp9600_address_t addr_pin, mcp9600_thermocouple_type_
         /* print */
         mcp9600_interface_debug_print("mcp9600: hot %0.2f delta %0.2f cold %0.2f.\n", hot_s, delta_s, cold_s);
         
+        /* get poll count */
+        res = mcp9600_get_single_read_poll_count(&gs_handle, (uint32_t *)&polls);
+        if (res != 0)
+        {
+            mcp9600_interface_debug_print("mcp9600: get single read poll count failed.\n");
+            (void)mcp9600_deinit(&gs_handle);
+            
+            return 1;
+        }
+        mcp9600_interface_debug_print("mcp9600: single read polls %d.\n", polls);
+        
+        /* delay 1000 ms */
+        mcp9600_interface_delay_ms(1000);
+    }
+    
+    /* start non-blocking single read test */
+    mcp9600_interface_debug_print("mcp9600: start non-blocking single read test.\n");
+    
+    for (i = 0; i < times; i++)
+    {
+        int16_t hot_raw;
+        float hot_s;
+        int16_t delta_raw;
+        float delta_s;
+        int16_t cold_raw;
+        float cold_s;
+        uint32_t ms;
+        uint32_t timeout;
+        mcp9600_bool_t ready;
+        
+        /* single read start */
+        res = mcp9600_single_read_start(&gs_handle, (uint32_t *)&ms);
+        if (res != 0)
+        {
+            mcp9600_interface_debug_print("mcp9600: single read start failed.\n");
+            (void)mcp9600_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* wait the expected conversion time */
+        mcp9600_interface_delay_ms(ms);
+        
+        /* poll until ready */
+        ready = MCP9600_BOOL_FALSE;
+        timeout = 10000;
+        while (timeout != 0)
+        {
+            res = mcp9600_single_read_poll(&gs_handle, &ready);
+            if (res != 0)
+            {
+                mcp9600_interface_debug_print("mcp9600: single read poll failed.\n");
+                (void)mcp9600_deinit(&gs_handle);
+                
+                return 1;
+            }
+            if (ready == MCP9600_BOOL_TRUE)
+            {
+                break;
+            }
+            mcp9600_interface_delay_ms(1);
+            timeout--;
+        }
+        if (timeout == 0)
+        {
+            mcp9600_interface_debug_print("mcp9600: single read poll timeout.\n");
+            (void)mcp9600_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* single read collect */
+        res = mcp9600_single_read_collect(&gs_handle, (int16_t *)&hot_raw, (float *)&hot_s,
+                                          (int16_t *)&delta_raw, (float *)&delta_s,
+                                          (int16_t *)&cold_raw, (float *)&cold_s);
+        if (res != 0)
+        {
+            mcp9600_interface_debug_print("mcp9600: single read collect failed.\n");
+            (void)mcp9600_deinit(&gs_handle);
+            
+            return 1;
+        }
+        
+        /* print */
+        mcp9600_interface_debug_print("mcp9600: hot %0.2f delta %0.2f cold %0.2f.\n", hot_s, delta_s, cold_s);
+        
         /* delay 1000 ms */
         mcp9600_interface_delay_ms(1000);
     }
@@ -717,6 +870,16 @@ uint8_t mcp9600_read_test(mcp9600_address_t addr_pin, mcp9600_thermocouple_type_
         /* print */
         mcp9600_interface_debug_print("mcp9600: raw is %d uv is %f.\n", raw, uv);
         
+        /* linearize on the host */
+        if (mcp9600_linearization_convert(type, uv, cold_s, (float *)&hot_s) == 0)
+        {
+            mcp9600_interface_debug_print("mcp9600: linearized hot is %0.2f.\n", hot_s);
+        }
+        else
+        {
+            mcp9600_interface_debug_print("mcp9600: linearized hot is out of range.\n");
+        }
+        
         /* delay 1000 ms */
         mcp9600_interface_delay_ms(1000);
     }
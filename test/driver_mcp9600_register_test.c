@@ -71,12 +71,17 @@ uint8_t mcp9600_register_test(mcp9600_address_t addr_pin)
     mcp9600_bool_t enable;
     mcp9600_input_range_t range;
     mcp9600_alert_status_t s;
+#if (MCP9600_STATS != 0)
+    mcp9600_stats_t stats;
+#endif
     
     /* link interface function */
     DRIVER_MCP9600_LINK_INIT(&gs_handle, mcp9600_handle_t);
     DRIVER_MCP9600_LINK_IIC_INIT(&gs_handle, mcp9600_interface_iic_init);
     DRIVER_MCP9600_LINK_IIC_DEINIT(&gs_handle, mcp9600_interface_iic_deinit);
     DRIVER_MCP9600_LINK_IIC_READ_COMMAND(&gs_handle, mcp9600_interface_iic_read_cmd);
+    DRIVER_MCP9600_LINK_IIC_READ(&gs_handle, mcp9600_interface_iic_read);
+    DRIVER_MCP9600_LINK_IIC_READ_BATCH(&gs_handle, mcp9600_interface_iic_read_batch);
     DRIVER_MCP9600_LINK_IIC_WRITE_COMMAND(&gs_handle, mcp9600_interface_iic_write_cmd);
     DRIVER_MCP9600_LINK_IIC_DELAY_MS(&gs_handle, mcp9600_interface_delay_ms);
     DRIVER_MCP9600_LINK_DEBUG_PRINT(&gs_handle, mcp9600_interface_debug_print);
@@ -2090,6 +2095,119 @@ uint8_t mcp9600_register_test(mcp9600_address_t addr_pin)
     }
     mcp9600_interface_debug_print("mcp9600: check temperature update flag status %s.\n", enable == 0 ? "0" : "1");
     
+    /* mcp9600_set_register_cache/mcp9600_get_register_cache/mcp9600_refresh_register_cache test */
+    mcp9600_interface_debug_print("mcp9600: mcp9600_set_register_cache/mcp9600_get_register_cache/mcp9600_refresh_register_cache test.\n");
+    
+    /* enable register cache */
+    res = mcp9600_set_register_cache(&gs_handle, MCP9600_BOOL_TRUE);
+    if (res != 0)
+    {
+        mcp9600_interface_debug_print("mcp9600: set register cache failed.\n");
+        (void)mcp9600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9600_interface_debug_print("mcp9600: enable register cache.\n");
+    res = mcp9600_get_register_cache(&gs_handle, &enable);
+    if (res != 0)
+    {
+        mcp9600_interface_debug_print("mcp9600: get register cache failed.\n");
+        (void)mcp9600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9600_interface_debug_print("mcp9600: check register cache %s.\n", enable == MCP9600_BOOL_TRUE ? "ok" : "error");
+    
+    /* set adc resolution 14 bit through the cache */
+    res = mcp9600_set_adc_resolution(&gs_handle, MCP9600_ADC_RESOLUTION_14_BIT);
+    if (res != 0)
+    {
+        mcp9600_interface_debug_print("mcp9600: set adc resolution failed.\n");
+        (void)mcp9600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = mcp9600_refresh_register_cache(&gs_handle);
+    if (res != 0)
+    {
+        mcp9600_interface_debug_print("mcp9600: refresh register cache failed.\n");
+        (void)mcp9600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = mcp9600_get_adc_resolution(&gs_handle, &adc_resolution);
+    if (res != 0)
+    {
+        mcp9600_interface_debug_print("mcp9600: get adc resolution failed.\n");
+        (void)mcp9600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9600_interface_debug_print("mcp9600: check cached adc resolution %s.\n", adc_resolution == MCP9600_ADC_RESOLUTION_14_BIT ? "ok" : "error");
+    
+    /* disable register cache */
+    res = mcp9600_set_register_cache(&gs_handle, MCP9600_BOOL_FALSE);
+    if (res != 0)
+    {
+        mcp9600_interface_debug_print("mcp9600: set register cache failed.\n");
+        (void)mcp9600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9600_interface_debug_print("mcp9600: disable register cache.\n");
+    
+#if (MCP9600_STATS != 0)
+    /* mcp9600_set_stats/mcp9600_get_stats/mcp9600_reset_stats test */
+    mcp9600_interface_debug_print("mcp9600: mcp9600_set_stats/mcp9600_get_stats/mcp9600_reset_stats test.\n");
+    
+    /* enable stats */
+    res = mcp9600_set_stats(&gs_handle, MCP9600_BOOL_TRUE);
+    if (res != 0)
+    {
+        mcp9600_interface_debug_print("mcp9600: set stats failed.\n");
+        (void)mcp9600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = mcp9600_reset_stats(&gs_handle);
+    if (res != 0)
+    {
+        mcp9600_interface_debug_print("mcp9600: reset stats failed.\n");
+        (void)mcp9600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = mcp9600_get_adc_resolution(&gs_handle, &adc_resolution);
+    if (res != 0)
+    {
+        mcp9600_interface_debug_print("mcp9600: get adc resolution failed.\n");
+        (void)mcp9600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    res = mcp9600_get_stats(&gs_handle, &stats);
+    if (res != 0)
+    {
+        mcp9600_interface_debug_print("mcp9600: get stats failed.\n");
+        (void)mcp9600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9600_interface_debug_print("mcp9600: read %d times %d bytes %d failed.\n", stats.read_count, stats.read_bytes, stats.read_failed);
+    mcp9600_interface_debug_print("mcp9600: check stats %s.\n", (stats.read_count == 1) && (stats.reg_count[0x06] == 1) ? "ok" : "error");
+    
+    /* disable stats */
+    res = mcp9600_set_stats(&gs_handle, MCP9600_BOOL_FALSE);
+    if (res != 0)
+    {
+        mcp9600_interface_debug_print("mcp9600: set stats failed.\n");
+        (void)mcp9600_deinit(&gs_handle);
+        
+        return 1;
+    }
+    mcp9600_interface_debug_print("mcp9600: disable stats.\n");
+#endif
+    
     /* finish register test */
     mcp9600_interface_debug_print("mcp9600: finish register test.\n");
     (void)mcp9600_deinit(&gs_handle);